@@ -23,15 +23,51 @@ class CrsLinearProblem {
 
   Matrix _A;
   Vector _x, _b;  //left-hand side (solution), right-hand side
+
+  int _preconditionerRefreshInterval = 1;
+  int _updatesSinceRefresh = 0;
+
+ protected:
+  int    _iterationsTaken = -1;
+  double _setupTime = 0.0;  // seconds spent (re)building the solver for the last solve
+  double _solveTime = 0.0;  // seconds spent in the last solve
+
+  // called by concrete subclasses from updateProblem(): true if the
+  // preconditioner should be rebuilt from scratch for the new values
+  bool preconditionerRefreshDue() {
+    ++_updatesSinceRefresh;
+    if (_preconditionerRefreshInterval <= 0) return false;
+    if (_updatesSinceRefresh < _preconditionerRefreshInterval) return false;
+    _updatesSinceRefresh = 0;
+    return true;
+  }
+
  public:
   CrsLinearProblem(const Matrix &Aa, Vector &ex, const Vector &be)
       : _A(Aa), _x(ex), _b(be) {}
+  virtual ~CrsLinearProblem() = default;
 
   Matrix &A() { return _A; }
   Vector &b() { return _b; }
   Vector &x() { return _x; }
 
   virtual void initializeSolver() {}
+  // Tells the solver that the entries of A() and b() have been reassembled
+  // in place.  The sparsity of A() must not have changed; if it has, create
+  // a new solver instead.  The current x() is used as the initial guess for
+  // the next solve, so a solver that is kept alive warm-starts from its
+  // previous solution.
+  virtual void updateProblem() {}
+  // Rebuild the preconditioner from scratch on every interval-th call to
+  // updateProblem(); in between, backends reuse as much of the existing
+  // preconditioner as they can.  An interval of zero (or less) never
+  // rebuilds it from scratch.
+  void setPreconditionerRefreshInterval(int interval) {
+    _preconditionerRefreshInterval = interval;
+  }
+  int getIterationsTaken() const { return _iterationsTaken; }
+  double getSetupTime() const { return _setupTime; }
+  double getSolveTime() const { return _solveTime; }
   // concrete subclasses should know how to solve:
   virtual int solve() = 0;
 };
@@ -8,8 +8,12 @@
 
 #include "Cubature.hpp"
 
+
 #include <Teuchos_TestForException.hpp>
 
+#include <map>
+#include <utility>
+
 namespace lgr {
 
 int Cubature::getNumCubaturePoints(
@@ -228,4 +232,28 @@ void Cubature::getCubature(
   Kokkos::deep_copy(points, pointsHost);
 }
 
+namespace {
+
+std::map<std::pair<int, int>, Cubature::Rule> &cubatureRegistry() {
+  static std::map<std::pair<int, int>, Cubature::Rule> registry;
+  return registry;
+}
+
+}  // namespace
+
+const Cubature::Rule &Cubature::getCachedCubature(int spaceDim, int degree) {
+  auto &registry = cubatureRegistry();
+  const auto key = std::make_pair(spaceDim, degree);
+  auto it = registry.find(key);
+  if (it != registry.end()) return it->second;
+  const int numCubaturePoints = getNumCubaturePoints(spaceDim, degree);
+  Rule rule;
+  rule.points = RefPointsView("quadrature points", numCubaturePoints, spaceDim);
+  rule.weights = WeightsView("quadrature weights", numCubaturePoints);
+  getCubature(spaceDim, degree, rule.points, rule.weights);
+  return registry.emplace(key, rule).first->second;
+}
+
+void Cubature::clearCachedCubature() { cubatureRegistry().clear(); }
+
 }  // namespace lgr
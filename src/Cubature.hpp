@@ -27,6 +27,19 @@ struct Cubature {
       const RefPointsView points,
       const WeightsView   weights);
   static int getNumCubaturePoints(int spaceDim, int degree);
+
+  /*
+   Rules are immutable, so functors that are rebuilt every time step
+   should share one copy per (spaceDim, degree) instead of allocating
+   and filling their own views.  The registry holds device views and
+   must be cleared before Kokkos::finalize().
+   */
+  struct Rule {
+    RefPointsView points;
+    WeightsView   weights;
+  };
+  static const Rule &getCachedCubature(int spaceDim, int degree);
+  static void clearCachedCubature();
 };
 
 }  // namespace lgr
@@ -169,8 +169,13 @@ void run(
 
   double cgTol = 1e-12;
   int    cgMaxIters = 10000;
+  int    preconditionerRefreshInterval = 1;
   Scalar timeIntervalForEMSolve =
       0;  // zero means we will do an EM solve at every time step (if we do one at all)
+  // a positive tolerance replaces the fixed interval: solve when the relative
+  // change in cell conductances since the last solve exceeds it
+  Scalar emConductanceChangeTolerance = 0;
+  Scalar maxTimeIntervalForEMSolve = std::numeric_limits<Scalar>::max();
   Teuchos::RCP<std::ofstream>
       voltageDataFile;  // will be written to at same cadence as viz data
 
@@ -206,7 +211,15 @@ void run(
     Scalar C = lowRmParams.get<Scalar>("C");
     int    m_series = lowRmParams.get<int>("M-Fold Series Symmetry", 1);
     int    m_parallel = lowRmParams.get<int>("M-Fold Parallel Symmetry", 1);
-    timeIntervalForEMSolve = lowRmParams.get<Scalar>("Solve Interval");
+    emConductanceChangeTolerance = lowRmParams.get<Scalar>("Conductance Change Tolerance", 0.0);
+    if (emConductanceChangeTolerance > 0) {
+      maxTimeIntervalForEMSolve = lowRmParams.get<Scalar>(
+          "Maximum Solve Interval", std::numeric_limits<Scalar>::max());
+    } else {
+      timeIntervalForEMSolve = lowRmParams.get<Scalar>("Solve Interval");
+    }
+    preconditionerRefreshInterval =
+        lowRmParams.get<int>("Preconditioner Refresh Interval", 1);
     if (lowRmParams.isSublist("Input Port")) {
       inputPortNodeSetName =
           lowRmParams.sublist("Input Port").get<std::string>("Sides");
@@ -272,7 +285,10 @@ void run(
 
     potentialSolver->setConductivity(Conductivity<Fields>());
 
-    if (timeIntervalForEMSolve == 0)
+    if (emConductanceChangeTolerance > 0)
+      cout << "Will solve the low Rm problem when the relative conductance change exceeds "
+           << emConductanceChangeTolerance << ".\n";
+    else if (timeIntervalForEMSolve == 0)
       cout << "Will solve the low Rm problem at each time step.\n";
     else
       cout << "Will solve the low Rm problem every " << timeIntervalForEMSolve
@@ -416,14 +432,18 @@ void run(
 
   VizOutput viz_output(mesh_io.getMesh(), viz_path, viz_pl, restart_time);
 
+  LagrangianStep<SpatialDim> lagrangianStep(
+      theMaterialModels, *mesh_fields, machine, mesh_io.getMesh());
+
   //write out initial data
+  std::vector<double> globalTallies;
   {
-    GlobalTallies<SpatialDim> globalTally(
-        *mesh_fields, current_state);
+    GlobalTallies<SpatialDim> &globalTally =
+        lagrangianStep.tallies(current_state);
     globalTally.apply();
     const std::vector<double> &localTallies =
         globalTally.contiguousMemoryTallies;
-    std::vector<double> globalTallies(localTallies);
+    globalTallies = localTallies;
     comm::allReduce(
         machine, localTallies.size(), localTallies.data(),
         globalTallies.data());
@@ -450,14 +470,13 @@ void run(
     }
   }
 
-  LagrangianStep<SpatialDim> lagrangianStep(
-      theMaterialModels, *mesh_fields, machine, mesh_io.getMesh());
-
   if (runLowRm) {
     potentialSolver->initialize();
   }
 
   Scalar lastEMSolveTime = -1e12;
+  int    numEMSolves = 0;
+  Scalar emConductanceChange = 0;
   while ((cycle < max_num_steps) && (current_time < terminationTime)) {
 
     //cycle the states
@@ -478,32 +497,55 @@ void run(
         min_energy_density_allowed);
 
     if (runLowRm) {
-      if (current_time > lastEMSolveTime + timeIntervalForEMSolve) {
+      bool solveEM;
+      if (emConductanceChangeTolerance > 0) {
+        // the change needs the current conductivities every step; on solve
+        // steps it is left as it was, so the log shows what triggered the solve
         for (auto conductivityModelPtr : theConductivityModels)
           conductivityModelPtr->updateElements(*mesh_fields, next_state);
+        potentialSolver->setConductivity(Conductivity<Fields>());
+        emConductanceChange = potentialSolver->relativeConductanceChange();
+        solveEM = (emConductanceChange > emConductanceChangeTolerance) ||
+                  (current_time > lastEMSolveTime + maxTimeIntervalForEMSolve);
+        if (!solveEM) potentialSolver->extrapolateSolution(current_time);
+      } else {
+        solveEM = (current_time > lastEMSolveTime + timeIntervalForEMSolve);
+      }
+      if (solveEM) {
+        if (emConductanceChangeTolerance <= 0) {
+          for (auto conductivityModelPtr : theConductivityModels)
+            conductivityModelPtr->updateElements(*mesh_fields, next_state);
+        }
 
         potentialSolver->setConductivity(
             Conductivity<Fields>());  // probably this is redundant
         potentialSolver->assemble();
-        // for now, defensive programming: force recreation of linear solver
-        // (I'm a bit suspicious of the fact that the residual is *exactly* the same each time...
-        //  There may be something we need to do to get AmgX to refresh its data...
-        //  )
-        linearSolver = Teuchos::null;
+        // the linear solver lives until the mesh adapts; between adaptations
+        // only the conductivities change, so it just takes the new values
         if (linearSolver == Teuchos::null) {
           linearSolver = potentialSolver->getDefaultSolver(cgTol, cgMaxIters);
-          // quit if no linear solver is available
-          LGR_THROW_IF(((comm::rank(machine) == 0) && (linearSolver == Teuchos::null)),
+          // quit if no linear solver is available; every rank sees the same
+          // build, so every rank throws before the solver is used
+          LGR_THROW_IF(linearSolver == Teuchos::null,
                          "***************************** USER MESSAGE ************************\n"
                          << "No linear solver is available, and low-Rm was requested.  Exiting…\n"
                          << "*******************************************************************\n");
+          linearSolver->setPreconditionerRefreshInterval(
+              preconditionerRefreshInterval);
         } else {
-          // TODO: give the linear solver a chance to update the matrix here and/or recompute the preconditioner
-          // (ViennaCL, e.g., has its own copy of the matrix; we'll need to copy the newly-assembled matrix there.)
-          linearSolver->initializeSolver();
+          linearSolver->updateProblem();
         }
         linearSolver->solve();
         lastEMSolveTime = current_time;
+        ++numEMSolves;
+        if (emConductanceChangeTolerance > 0) {
+          potentialSolver->recordSolve(current_time);
+        }
+        if (comm::rank(machine) == 0) {
+          std::cout << "Low-Rm solve: " << linearSolver->getIterationsTaken()
+                    << " iterations; setup " << linearSolver->getSetupTime()
+                    << " s; solve " << linearSolver->getSolveTime() << " s\n";
+        }
       }
       auto element_internal_energy = ElementInternalEnergy<Fields>();
       auto element_joule_energy = ElementJouleEnergy<Fields>();
@@ -537,7 +579,10 @@ void run(
       cout << "V2 = " << rlcCircuitSolver->v2() << "; ";
       cout << "V3 = " << rlcCircuitSolver->v3() << " (K11 = " << K11 << "; "
            << potentialSolver->getTotalJoulesAdded()
-           << " total Joules added)\n";
+           << " total Joules added; " << numEMSolves << " EM solves";
+      if (emConductanceChangeTolerance > 0)
+        cout << "; relative conductance change = " << emConductanceChange;
+      cout << ")\n";
     }
 
     // Do adaptivity calculations
@@ -606,6 +651,7 @@ void run(
         linearSolver = Teuchos::
             null;  // force reconstruction of linear solver after next assembly
       }
+      lagrangianStep.updateMesh();
     }
 
     current_time += dt;
@@ -617,11 +663,10 @@ void run(
     internal_force_contribs.update(
         mesh_io.mesh_sets, current_time, mesh_fields->femesh.node_coords);
 
-    GlobalTallies<SpatialDim> globalTally(
-        *mesh_fields, next_state);
+    GlobalTallies<SpatialDim> &globalTally = lagrangianStep.tallies(next_state);
     globalTally.apply();
-    auto &              localTallies = globalTally.contiguousMemoryTallies;
-    std::vector<double> globalTallies(localTallies);
+    auto &localTallies = globalTally.contiguousMemoryTallies;
+    globalTallies = localTallies;
     comm::allReduce(
         machine, localTallies.size(), localTallies.data(),
         globalTallies.data());
@@ -416,7 +416,7 @@ void update_node_mass_after_remap<SpatialDim>::apply(const Fields &mesh_fields,
 
 template <int SpatialDim>
 initialize_time_step_elements<SpatialDim>::initialize_time_step_elements(
-        const Fields &, const int arg_state0, const int arg_state1)
+        const Fields &mesh_fields, const int arg_state0, const int arg_state1)
         : mass_density(MassDensity<Fields>())
           , internal_energy_per_unit_mass(InternalEnergyPerUnitMass<Fields>())
           , planeWaveModulus(PlaneWaveModulus<Fields>())
@@ -426,9 +426,22 @@ initialize_time_step_elements<SpatialDim>::initialize_time_step_elements(
           , Fold(FieldDB<typename Fields::elem_tensor_type>::Self().at(
                   "save the deformation gradient"))
                   , uprime(FineScaleDisplacement<Fields>())
+                  , nelems(mesh_fields.femesh.nelems)
                   , state0(arg_state0)
                   , state1(arg_state1) {}
 
+template <int SpatialDim>
+void initialize_time_step_elements<SpatialDim>::setStates(
+        const int arg_state0, const int arg_state1) {
+    state0 = arg_state0;
+    state1 = arg_state1;
+}
+
+template <int SpatialDim>
+void initialize_time_step_elements<SpatialDim>::apply() const {
+    Kokkos::parallel_for(nelems, *this);
+}
+
 template <int SpatialDim>
 void initialize_time_step_elements<SpatialDim>::apply(
         const Fields &mesh_fields, const int arg_state0, const int arg_state1) {
@@ -459,15 +472,24 @@ grad<SpatialDim>::grad(
         const int     arg_state1,
         const Scalar  arg_alpha)
         : elem_node_connectivity(fields.femesh.elem_node_ids)
+          , velocityStates(Velocity<Fields>())
+          , coordinateStates(Coordinates<Fields>())
           , vel_grad(VelocityGradient<Fields>())
           , elem_volume(ElementVolume<Fields>())
-          , state0(arg_state0)
-          , state1(arg_state1)
-          , alpha(arg_alpha) {
-    velocity[0] = Fields::getGeomFromSA(Velocity<Fields>(), state0);
-    velocity[1] = Fields::getGeomFromSA(Velocity<Fields>(), state1);
-    xn = Fields::getGeomFromSA(Coordinates<Fields>(), state0);
-    xnp1 = Fields::getGeomFromSA(Coordinates<Fields>(), state1);
+          , nelems(fields.femesh.nelems) {
+    setStates(arg_state0, arg_state1, arg_alpha);
+}
+
+template <int SpatialDim>
+void grad<SpatialDim>::setStates(
+        const int arg_state0, const int arg_state1, const Scalar arg_alpha) {
+    state0 = arg_state0;
+    state1 = arg_state1;
+    alpha = arg_alpha;
+    velocity[0] = Fields::getGeomFromSA(velocityStates, state0);
+    velocity[1] = Fields::getGeomFromSA(velocityStates, state1);
+    xn = Fields::getGeomFromSA(coordinateStates, state0);
+    xnp1 = Fields::getGeomFromSA(coordinateStates, state1);
 }
 
 //   Calculate Velocity Gradients
@@ -531,6 +553,28 @@ void grad<2>::v_grad(
 
 }
 
+template <int SpatialDim>
+KOKKOS_INLINE_FUNCTION
+void grad<SpatialDim>::elementKinematics(
+        int     ielem,
+        Scalar *xmid,
+        Scalar *ymid,
+        Scalar *zmid,
+        Scalar *vx,
+        Scalar *vy,
+        Scalar *vz,
+        Scalar *grad_x,
+        Scalar *grad_y,
+        Scalar *grad_z) const {
+    //volume and velocity gradient
+    comp_grad(
+            xmid, ymid, zmid, grad_x, grad_y, grad_z);
+    const Scalar vol = dot4(xmid, grad_x);
+    elem_volume(ielem) = vol;
+    const Scalar inv_vol = 1.0 / vol;
+    v_grad(ielem, vx, vy, vz, grad_x, grad_y, grad_z, inv_vol);
+}
+
 template <int SpatialDim>
 KOKKOS_INLINE_FUNCTION
 void grad<SpatialDim>::operator()(int ielem) const {
@@ -586,14 +630,13 @@ void grad<SpatialDim>::operator()(int ielem) const {
     }
 
     //  Calculate volume from x updatedCoordinates and gradient information
+    elementKinematics(
+            ielem, xmid, ymid, zmid, vx, vy, vz, grad_x, grad_y, grad_z);
+}
 
-    //volume and velocity gradient
-    comp_grad(
-            xmid, ymid, zmid, grad_x, grad_y, grad_z);
-    const Scalar vol = dot4(xmid, grad_x);
-    elem_volume(ielem) = vol;
-    const Scalar inv_vol = 1.0 / vol;
-    v_grad(ielem, vx, vy, vz, grad_x, grad_y, grad_z, inv_vol);
+template <int SpatialDim>
+void grad<SpatialDim>::apply() const {
+    Kokkos::parallel_for(nelems, *this);
 }
 
 template <int SpatialDim>
@@ -613,14 +656,22 @@ GRAD<SpatialDim>::GRAD(
         const int     arg_state1,
         const Scalar  arg_alpha)
         : elem_node_connectivity(fields.femesh.elem_node_ids)
+          , coordinateStates(Coordinates<Fields>())
           , F(DeformationGradient<Fields>())
           , Fold(FieldDB<typename Fields::elem_tensor_type>::Self().at(
                   "save the deformation gradient"))
-                  , state0(arg_state0)
-                  , state1(arg_state1)
-                  , alpha(arg_alpha) {
-    xn = Fields::getGeomFromSA(Coordinates<Fields>(), state0);
-    xnp1 = Fields::getGeomFromSA(Coordinates<Fields>(), state1);
+                  , nelems(fields.femesh.nelems) {
+    setStates(arg_state0, arg_state1, arg_alpha);
+}
+
+template <int SpatialDim>
+void GRAD<SpatialDim>::setStates(
+        const int arg_state0, const int arg_state1, const Scalar arg_alpha) {
+    state0 = arg_state0;
+    state1 = arg_state1;
+    alpha = arg_alpha;
+    xn = Fields::getGeomFromSA(coordinateStates, state0);
+    xnp1 = Fields::getGeomFromSA(coordinateStates, state1);
 }
 
 //   Calculate deformation gradient
@@ -742,6 +793,26 @@ void GRAD<2>::deformationGradient(
 
 }
 
+template <int SpatialDim>
+KOKKOS_INLINE_FUNCTION
+void GRAD<SpatialDim>::elementDeformationGradient(
+        int     ielem,
+        Scalar *X,
+        Scalar *Y,
+        Scalar *Z,
+        Scalar *xmid,
+        Scalar *ymid,
+        Scalar *zmid) const {
+    Scalar GRAD_X[ElemNodeCount], GRAD_Y[ElemNodeCount], GRAD_Z[ElemNodeCount];
+
+    //deformation gradient
+    comp_grad(X, Y, Z, GRAD_X, GRAD_Y, GRAD_Z);
+    const Scalar VOL = dot4(X, GRAD_X);
+    const Scalar INV_VOL = 1.0 / VOL;
+    deformationGradient(
+            ielem, xmid, ymid, zmid, GRAD_X, GRAD_Y, GRAD_Z, INV_VOL);
+}
+
 //--------------------------------------------------------------------------
 // Functor operator() which calls the three member functions.
 
@@ -760,8 +831,6 @@ void GRAD<SpatialDim>::operator()(int ielem) const {
 
     Scalar xmid[ElemNodeCount], ymid[ElemNodeCount], zmid[ElemNodeCount];
 
-    Scalar GRAD_X[ElemNodeCount], GRAD_Y[ElemNodeCount], GRAD_Z[ElemNodeCount];
-
     // Read global velocity once and use many times
     // via local registers / L1 cache.
     //  store the velocity information in local memory before using,
@@ -790,12 +859,12 @@ void GRAD<SpatialDim>::operator()(int ielem) const {
         zmid[i] = (1.0 - alpha) * Z[i] + alpha * z[i];
     }
 
-    //deformation gradient
-    comp_grad(X, Y, Z, GRAD_X, GRAD_Y, GRAD_Z);
-    const Scalar VOL = dot4(X, GRAD_X);
-    const Scalar INV_VOL = 1.0 / VOL;
-    deformationGradient(
-            ielem, xmid, ymid, zmid, GRAD_X, GRAD_Y, GRAD_Z, INV_VOL);
+    elementDeformationGradient(ielem, X, Y, Z, xmid, ymid, zmid);
+}
+
+template <int SpatialDim>
+void GRAD<SpatialDim>::apply() const {
+    Kokkos::parallel_for(nelems, *this);
 }
 
 template <int SpatialDim>
@@ -819,13 +888,25 @@ internal_force<SpatialDim>::internal_force(
 	, vel_grad(VelocityGradient<Fields>())
 	, pprime(FineScalePressure<Fields>())
 	, nodal_pressure(NodalPressure<Fields>())
-	, state0(arg_state0)
-	, state1(arg_state1)
+	, velocityStates(Velocity<Fields>())
+	, nelems(mesh_fields.femesh.nelems)
 	, artificialViscosityModel(mesh_fields) 
 	, mhd(mesh_fields)
 {
-    velocity[0] = Fields::getGeomFromSA(Velocity<Fields>(), arg_state0);
-    velocity[1] = Fields::getGeomFromSA(Velocity<Fields>(), arg_state1);
+    setStates(arg_state0, arg_state1);
+}
+
+template <int SpatialDim>
+void internal_force<SpatialDim>::setStates(const int arg_state0, const int arg_state1) {
+    state0 = arg_state0;
+    state1 = arg_state1;
+    velocity[0] = Fields::getGeomFromSA(velocityStates, arg_state0);
+    velocity[1] = Fields::getGeomFromSA(velocityStates, arg_state1);
+}
+
+template <int SpatialDim>
+void internal_force<SpatialDim>::apply() const {
+    Kokkos::parallel_for(nelems, *this);
 }
 
 template <int SpatialDim>
@@ -879,6 +960,20 @@ void internal_force<SpatialDim>::operator()(int ielem) const {
     //Gradient:
     comp_grad(x, y, z, grad_x, grad_y, grad_z);
 
+    elementForce(ielem, x, y, z, grad_x, grad_y, grad_z, ph);
+}
+
+template <int SpatialDim>
+KOKKOS_INLINE_FUNCTION
+void internal_force<SpatialDim>::elementForce(
+        int           ielem,
+        const Scalar *x,
+        const Scalar *y,
+        const Scalar *z,
+        const Scalar *grad_x,
+        const Scalar *grad_y,
+        const Scalar *grad_z,
+        const Scalar  ph) const {
     //use stored vel_grad object to compute bulk viscosity
     const Omega_h::Few<Scalar, Fields::SymTensorLength> q = 
       artificialViscosityModel.kineticViscosity( ielem, 
@@ -914,6 +1009,7 @@ energy_step<SpatialDim>::energy_step(
         const int     arg_state1)
         : elem_node_connectivity(mesh_fields.femesh.elem_node_ids)
           , updatedCoordinates(Coordinates<Fields>())
+          , velocityStates(Velocity<Fields>())
           , elem_mass(ElementMass<Fields>())
           , elem_energy(ElementInternalEnergy<Fields>())
           , elem_volume(ElementVolume<Fields>())
@@ -926,12 +1022,24 @@ energy_step<SpatialDim>::energy_step(
           , nodal_pressure(NodalPressure<Fields>())
           , uprime(FineScaleDisplacement<Fields>())
           , shockHeatFlux(ElementShockHeatFlux<Fields>())
-          , dt_vel(arg_dt)
-          , state0(arg_state0)
-          , state1(arg_state1)
+          , nelems(mesh_fields.femesh.nelems)
           , artificialViscosityModel(mesh_fields) {
-    velocity[0] = Fields::getGeomFromSA(Velocity<Fields>(), arg_state0);
-    velocity[1] = Fields::getGeomFromSA(Velocity<Fields>(), arg_state1);
+    setStates(arg_dt, arg_state0, arg_state1);
+}
+
+template <int SpatialDim>
+void energy_step<SpatialDim>::setStates(
+        const Scalar arg_dt, const int arg_state0, const int arg_state1) {
+    dt_vel = arg_dt;
+    state0 = arg_state0;
+    state1 = arg_state1;
+    velocity[0] = Fields::getGeomFromSA(velocityStates, arg_state0);
+    velocity[1] = Fields::getGeomFromSA(velocityStates, arg_state1);
+}
+
+template <int SpatialDim>
+void energy_step<SpatialDim>::apply() const {
+    Kokkos::parallel_for(nelems, *this);
 }
 
 template <int SpatialDim>
@@ -1177,6 +1285,15 @@ void element_step<SpatialDim>::operator()(int ielem) const {
     // Gradient:
     comp_grad(x, y, z, grad_x, grad_y, grad_z);
 
+    elementUpdate(ielem, x, grad_x);
+}
+
+template <int SpatialDim>
+KOKKOS_INLINE_FUNCTION
+void element_step<SpatialDim>::elementUpdate(
+        int           ielem,
+        const Scalar *x,
+        const Scalar *grad_x) const {
     // lagrangian conservation of mass
     const Scalar vol = dot<ElemNodeCount>(x, grad_x);
     elem_volume(ielem) = vol;
@@ -1184,12 +1301,117 @@ void element_step<SpatialDim>::operator()(int ielem) const {
     elem_energy(ielem) = elem_mass(ielem) * internalEnergy(ielem, state1);
 }
 
+template <int SpatialDim>
+fused_element_step<SpatialDim>::fused_element_step(const Fields &mesh_fields)
+: elem_node_connectivity(mesh_fields.femesh.elem_node_ids)
+  , nodal_pressure(NodalPressure<Fields>())
+  , nelems(mesh_fields.femesh.nelems)
+  , kinematics(mesh_fields, 0, 1, 1.0)
+  , deformation(mesh_fields, 0, 1, 1.0)
+  , force(mesh_fields, 0, 1)
+  , elementStep(mesh_fields) {
+    setStates(0, 1);
+}
+
+template <int SpatialDim>
+void fused_element_step<SpatialDim>::setStates(const int arg_state0, const int arg_state1) {
+    velocity[0] = Fields::getGeomFromSA(kinematics.velocityStates, arg_state0);
+    velocity[1] = Fields::getGeomFromSA(kinematics.velocityStates, arg_state1);
+    xn = Fields::getGeomFromSA(kinematics.coordinateStates, arg_state0);
+    xnp1 = Fields::getGeomFromSA(kinematics.coordinateStates, arg_state1);
+    force.setStates(arg_state0, arg_state1);
+    elementStep.state1 = arg_state1;
+}
+
+template <int SpatialDim>
+KOKKOS_INLINE_FUNCTION
+void fused_element_step<SpatialDim>::operator()(MidpointTag, int ielem) const {
+    const Scalar alpha(0.5);
+
+    Scalar xmid[ElemNodeCount], ymid[ElemNodeCount], zmid[ElemNodeCount];
+    Scalar vx[ElemNodeCount], vy[ElemNodeCount], vz[ElemNodeCount];
+    Scalar grad_x[ElemNodeCount], grad_y[ElemNodeCount], grad_z[ElemNodeCount];
+
+    Scalar ph(0.0);
+    for (int i = 0; i < ElemNodeCount; ++i) {
+        const int n = elem_node_connectivity(ielem, i);
+
+        xmid[i] = (1.0 - alpha) * xn(n, 0) + alpha * xnp1(n, 0);
+        ymid[i] = (1.0 - alpha) * xn(n, 1) + alpha * xnp1(n, 1);
+        zmid[i] = (1.0 - alpha) * xn(n, 2) + alpha * xnp1(n, 2);
+
+        vx[i] = (1.0 - alpha) * velocity[0](n, 0) + alpha * velocity[1](n, 0);
+        vy[i] = (1.0 - alpha) * velocity[0](n, 1) + alpha * velocity[1](n, 1);
+        vz[i] = (1.0 - alpha) * velocity[0](n, 2) + alpha * velocity[1](n, 2);
+
+        ph += nodal_pressure(n);
+    }
+    ph /= ElemNodeCount;
+
+    //volume and velocity gradient at x_{n+1/2}, then the element force
+    //from the same gradients
+    kinematics.elementKinematics(
+            ielem, xmid, ymid, zmid, vx, vy, vz, grad_x, grad_y, grad_z);
+    force.elementForce(
+            ielem, xmid, ymid, zmid, grad_x, grad_y, grad_z, ph);
+}
+
+template <int SpatialDim>
+KOKKOS_INLINE_FUNCTION
+void fused_element_step<SpatialDim>::operator()(EndpointTag, int ielem) const {
+    Scalar X[ElemNodeCount], Y[ElemNodeCount], Z[ElemNodeCount];
+    Scalar x[ElemNodeCount], y[ElemNodeCount], z[ElemNodeCount];
+    Scalar vx[ElemNodeCount], vy[ElemNodeCount], vz[ElemNodeCount];
+    Scalar grad_x[ElemNodeCount], grad_y[ElemNodeCount], grad_z[ElemNodeCount];
+
+    for (int i = 0; i < ElemNodeCount; ++i) {
+        const int n = elem_node_connectivity(ielem, i);
+
+        X[i] = xn(n, 0);
+        Y[i] = xn(n, 1);
+        Z[i] = xn(n, 2);
+
+        x[i] = xnp1(n, 0);
+        y[i] = xnp1(n, 1);
+        z[i] = xnp1(n, 2);
+
+        vx[i] = velocity[1](n, 0);
+        vy[i] = velocity[1](n, 1);
+        vz[i] = velocity[1](n, 2);
+    }
+
+    //volume, velocity gradient and deformation gradient at x_{n+1},
+    //then conservation of mass with the same gradients
+    kinematics.elementKinematics(
+            ielem, x, y, z, vx, vy, vz, grad_x, grad_y, grad_z);
+    deformation.elementDeformationGradient(ielem, X, Y, Z, x, y, z);
+    elementStep.elementUpdate(ielem, x, grad_x);
+}
+
+template <int SpatialDim>
+void fused_element_step<SpatialDim>::applyMidpoint() {
+    Kokkos::parallel_for(
+            Kokkos::RangePolicy<ExecSpace, MidpointTag>(0, nelems), *this);
+}
+
+template <int SpatialDim>
+void fused_element_step<SpatialDim>::applyEndpoint() {
+    Kokkos::parallel_for(
+            Kokkos::RangePolicy<ExecSpace, EndpointTag>(0, nelems), *this);
+}
+
 template <int SpatialDim>
 assemble_forces<SpatialDim>::assemble_forces(const Fields &mesh_fields)
 : node_elem_connectivity(mesh_fields.femesh.node_elem_ids)
   , nodal_mass(NodalMass<Fields>())
   , internal_force(InternalForce<Fields>())
-  , element_force(ElementForce<Fields>()) {}
+  , element_force(ElementForce<Fields>())
+  , nnodes(mesh_fields.femesh.nnodes) {}
+
+template <int SpatialDim>
+void assemble_forces<SpatialDim>::apply() const {
+    Kokkos::parallel_for(nnodes, *this);
+}
 
 template <int SpatialDim>
 void assemble_forces<SpatialDim>::apply(const Fields &mesh_fields) {
@@ -1261,7 +1483,8 @@ GlobalTallies<SpatialDim>::GlobalTallies(const Fields &arg_mesh_fields, const in
 : numElements(arg_mesh_fields.femesh.nelems)
   , elem_node_connectivity(arg_mesh_fields.femesh.elem_node_ids)
   , updatedCoordinates(Coordinates<Fields>())
-  , velocity(Fields::getGeomFromSA(Velocity<Fields>(), arg_state))
+  , velocityStates(Velocity<Fields>())
+  , velocity(Fields::getGeomFromSA(velocityStates, arg_state))
   , elem_mass(ElementMass<Fields>())
   , internalEnergy(InternalEnergyPerUnitMass<Fields>())
   , owned(arg_mesh_fields.femesh.omega_h_mesh->owned(SpatialDim))
@@ -1275,6 +1498,12 @@ GlobalTallies<SpatialDim>::GlobalTallies(const Fields &arg_mesh_fields, const in
     contiguousMemoryTallies.resize(dataLength);
 }
 
+template <int SpatialDim>
+void GlobalTallies<SpatialDim>::setState(const int arg_state) {
+    state = arg_state;
+    velocity = Fields::getGeomFromSA(velocityStates, arg_state);
+}
+
 template<int SpatialDim>
 KOKKOS_INLINE_FUNCTION 
 Scalar 
@@ -1392,6 +1621,7 @@ void check_densities(
     template struct energy_step<SpatialDim>; \
     template struct shock_heat_flux_step<SpatialDim>; \
     template struct element_step<SpatialDim>; \
+    template struct fused_element_step<SpatialDim>; \
     template struct assemble_forces<SpatialDim>; \
     template struct GlobalTallies<SpatialDim>; \
     template struct ElementTallies<SpatialDim>; \
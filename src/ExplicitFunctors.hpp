@@ -230,12 +230,17 @@ struct initialize_time_step_elements {
     typename Fields::elem_tensor_type                 Fold;
     const typename Fields::elem_vector_state_type     uprime;
 
-    const int state0;
-    const int state1;
+    const int nelems;
+    int state0;
+    int state1;
 
     initialize_time_step_elements(
             const Fields &mesh_fields, const int arg_state0, const int arg_state1);
 
+    void setStates(const int arg_state0, const int arg_state1);
+
+    void apply() const;
+
     static void apply(
             const Fields &mesh_fields, const int arg_state0, const int arg_state1);
 
@@ -253,13 +258,16 @@ struct grad {
 
     // Global arrays used by this functor.
 
-    const typename Fields::elem_node_ids_type elem_node_connectivity;
-    typename Fields::geom_array_type          velocity[2];
-    typename Fields::geom_array_type          xn;
-    typename Fields::geom_array_type          xnp1;
-    const typename Fields::elem_tensor_type   vel_grad;
-    const typename Fields::array_type         elem_volume;
+    const typename Fields::elem_node_ids_type    elem_node_connectivity;
+    const typename Fields::geom_state_array_type velocityStates;
+    const typename Fields::geom_state_array_type coordinateStates;
+    typename Fields::geom_array_type             velocity[2];
+    typename Fields::geom_array_type             xn;
+    typename Fields::geom_array_type             xnp1;
+    const typename Fields::elem_tensor_type      vel_grad;
+    const typename Fields::array_type            elem_volume;
 
+    const int nelems;
     int    state0;
     int    state1;
     Scalar alpha;
@@ -272,6 +280,8 @@ struct grad {
             const int     arg_state1,
             const Scalar  arg_alpha);
 
+    void setStates(const int arg_state0, const int arg_state1, const Scalar arg_alpha);
+
     //   Calculate Velocity Gradients
     KOKKOS_INLINE_FUNCTION
     void v_grad(
@@ -284,9 +294,26 @@ struct grad {
             Scalar *grad_z,
             Scalar  inv_vol) const;
 
+    //   Volume, shape function gradients and velocity gradient
+    //   from gathered nodal coordinates and velocities
+    KOKKOS_INLINE_FUNCTION
+    void elementKinematics(
+            int     ielem,
+            Scalar *xmid,
+            Scalar *ymid,
+            Scalar *zmid,
+            Scalar *vx,
+            Scalar *vy,
+            Scalar *vz,
+            Scalar *grad_x,
+            Scalar *grad_y,
+            Scalar *grad_z) const;
+
     KOKKOS_INLINE_FUNCTION
     void operator()(int ielem) const;
 
+    void apply() const;
+
     static void apply(
             const Fields &fields,
             const int     arg_state0,
@@ -304,12 +331,14 @@ struct GRAD {
 
     // Global arrays used by this functor.
 
-    const typename Fields::elem_node_ids_type elem_node_connectivity;
-    typename Fields::geom_array_type          xn;
-    typename Fields::geom_array_type          xnp1;
-    const typename Fields::elem_tensor_type   F;
-    const typename Fields::elem_tensor_type   Fold;
+    const typename Fields::elem_node_ids_type    elem_node_connectivity;
+    const typename Fields::geom_state_array_type coordinateStates;
+    typename Fields::geom_array_type             xn;
+    typename Fields::geom_array_type             xnp1;
+    const typename Fields::elem_tensor_type      F;
+    const typename Fields::elem_tensor_type      Fold;
 
+    const int nelems;
     int    state0;
     int    state1;
     Scalar alpha;
@@ -322,6 +351,8 @@ struct GRAD {
             const int     arg_state1,
             const Scalar  arg_alpha);
 
+    void setStates(const int arg_state0, const int arg_state1, const Scalar arg_alpha);
+
     //   Calculate deformation gradient
     KOKKOS_INLINE_FUNCTION
     void deformationGradient(
@@ -334,12 +365,26 @@ struct GRAD {
             Scalar *GRAD_Z,
             Scalar  inv_vol) const;
 
+    //   Deformation gradient from gathered coordinates at time n
+    //   and at the (1-alpha,alpha) averaged configuration
+    KOKKOS_INLINE_FUNCTION
+    void elementDeformationGradient(
+            int     ielem,
+            Scalar *X,
+            Scalar *Y,
+            Scalar *Z,
+            Scalar *xmid,
+            Scalar *ymid,
+            Scalar *zmid) const;
+
     //--------------------------------------------------------------------------
     // Functor operator() which calls the three member functions.
 
     KOKKOS_INLINE_FUNCTION
     void operator()(int ielem) const;
 
+    void apply() const;
+
     static void apply(
             const Fields &fields,
             const int     arg_state0,
@@ -371,10 +416,12 @@ struct internal_force {
     const typename Fields::elem_tensor_type           vel_grad;
     const typename Fields::array_type                 pprime;
     const typename Fields::array_type                 nodal_pressure;
+    const typename Fields::geom_state_array_type      velocityStates;
     typename Fields::geom_array_type                  velocity[2];
 
-    const int state0;
-    const int state1;
+    const int nelems;
+    int state0;
+    int state1;
 
     const ArtificialViscosity<SpatialDim> artificialViscosityModel;
 
@@ -382,6 +429,10 @@ struct internal_force {
 
     internal_force(const Fields &mesh_fields, const int arg_state0, const int arg_state1);
 
+    void setStates(const int arg_state0, const int arg_state1);
+
+    void apply() const;
+
     static void apply(const Fields &mesh_fields, const int arg_state0, const int arg_state1);
 
     KOKKOS_INLINE_FUNCTION
@@ -391,6 +442,19 @@ struct internal_force {
 		     const Scalar *const grad_z,
 		     Scalar *algoStress) const;
 
+    //   Element force from gathered mid-configuration coordinates,
+    //   their shape function gradients and the element-averaged
+    //   nodal pressure
+    KOKKOS_INLINE_FUNCTION
+    void elementForce( int ielem,
+		       const Scalar *x,
+		       const Scalar *y,
+		       const Scalar *z,
+		       const Scalar *grad_x,
+		       const Scalar *grad_y,
+		       const Scalar *grad_z,
+		       const Scalar  ph) const;
+
     KOKKOS_INLINE_FUNCTION
     void operator()(int ielem) const;
 };
@@ -407,6 +471,7 @@ struct energy_step {
 
     const typename Fields::elem_node_ids_type    elem_node_connectivity;
     const typename Fields::geom_state_array_type updatedCoordinates;
+    const typename Fields::geom_state_array_type velocityStates;
     typename Fields::geom_array_type             velocity[2];
     const typename Fields::array_type            elem_mass;
     const typename Fields::array_type            elem_energy;
@@ -421,9 +486,10 @@ struct energy_step {
     const typename Fields::elem_vector_state_type     uprime;
     const typename Fields::elem_vector_type           shockHeatFlux;
 
-    const Scalar dt_vel;
-    const int    state0;
-    const int    state1;
+    const int nelems;
+    Scalar    dt_vel;
+    int       state0;
+    int       state1;
 
     const ArtificialViscosity<SpatialDim>
     artificialViscosityModel;
@@ -434,6 +500,10 @@ struct energy_step {
             const int     arg_state0,
             const int     arg_state1);
 
+    void setStates(const Scalar arg_dt, const int arg_state0, const int arg_state1);
+
+    void apply() const;
+
     static void apply(
             const Fields &mesh_fields,
             const Scalar  arg_dt,
@@ -498,10 +568,65 @@ struct element_step {
 
     void apply(const Fields &mesh_fields, const int arg_state1);
 
+    //   Lagrangian conservation of mass from gathered coordinates at
+    //   the next state and their shape function gradients
+    KOKKOS_INLINE_FUNCTION
+    void elementUpdate(
+            int           ielem,
+            const Scalar *x,
+            const Scalar *grad_x) const;
+
     KOKKOS_INLINE_FUNCTION
     void operator()(int ielem) const;
 };
 
+/*
+  Fused element passes of the Lagrangian step.  Each pass gathers the
+  element's nodal coordinates, velocities and pressures once and calls
+  the per-element parts of the functors it replaces, so the gradients
+  stay in registers:
+    MidpointTag:  grad (alpha = 1/2) followed by internal_force
+    EndpointTag:  grad and GRAD (alpha = 1) followed by element_step
+  The unfused functors remain the reference path.
+*/
+template <int SpatialDim>
+struct fused_element_step {
+    typedef ExecSpace execution_space;
+
+    typedef lgr::Fields<SpatialDim> Fields;
+
+    static const int ElemNodeCount = Fields::ElemNodeCount;
+
+    const typename Fields::elem_node_ids_type elem_node_connectivity;
+    const typename Fields::array_type         nodal_pressure;
+    typename Fields::geom_array_type          velocity[2];
+    typename Fields::geom_array_type          xn;
+    typename Fields::geom_array_type          xnp1;
+
+    const int nelems;
+
+    grad<SpatialDim>           kinematics;
+    GRAD<SpatialDim>           deformation;
+    internal_force<SpatialDim> force;
+    element_step<SpatialDim>   elementStep;
+
+    fused_element_step(const Fields &mesh_fields);
+
+    void setStates(const int arg_state0, const int arg_state1);
+
+    struct MidpointTag {};
+    KOKKOS_INLINE_FUNCTION
+    void operator()(MidpointTag, int ielem) const;
+
+    struct EndpointTag {};
+    KOKKOS_INLINE_FUNCTION
+    void operator()(EndpointTag, int ielem) const;
+
+    void applyMidpoint();
+
+    void applyEndpoint();
+};
+
 template <int SpatialDim>
 struct assemble_forces {
     typedef ExecSpace                          execution_space;
@@ -513,9 +638,12 @@ struct assemble_forces {
     const typename Fields::array_type          nodal_mass;
     const typename Fields::geom_array_type     internal_force;
     const typename Fields::elem_node_geom_type element_force;
+    const int                                  nnodes;
 
     assemble_forces(const Fields &mesh_fields);
 
+    void apply() const;
+
     static void apply(const Fields &mesh_fields);
 
     KOKKOS_INLINE_FUNCTION
@@ -546,13 +674,14 @@ struct GlobalTallies {
     const int                                 numElements;
     const typename Fields::elem_node_ids_type elem_node_connectivity;
     const typename Fields::geom_state_array_type updatedCoordinates;
-    const typename Fields::geom_array_type    velocity;
+    const typename Fields::geom_state_array_type velocityStates;
+    typename Fields::geom_array_type          velocity;
     const typename Fields::array_type         elem_mass;
     const typename Fields::state_array_type   internalEnergy;
 
     Omega_h::Bytes                            owned;
 
-    const int state;
+    int state;
 
     const MHD<SpatialDim> mhd;
 
@@ -561,6 +690,9 @@ struct GlobalTallies {
 
     GlobalTallies(const Fields &arg_mesh_fields, const int arg_state);
 
+    /* reuse one instance per mesh instead of rebuilding every step */
+    void setState(const int arg_state);
+
     KOKKOS_INLINE_FUNCTION 
     Scalar 
     elementMagneticEnergy( const int ielem ) const;
@@ -598,6 +730,7 @@ void check_densities(
     extern template struct energy_step<SpatialDim>; \
     extern template struct shock_heat_flux_step<SpatialDim>; \
     extern template struct element_step<SpatialDim>; \
+    extern template struct fused_element_step<SpatialDim>; \
     extern template struct assemble_forces<SpatialDim>; \
     extern template struct GlobalTallies<SpatialDim>; \
     extern template struct ElementTallies<SpatialDim>; \
@@ -1,4 +1,5 @@
 #include "FieldDB.hpp"
+#include "Cubature.hpp"
 #include "Fields.hpp"
 #include "MaterialModels.hpp"
 
@@ -16,6 +17,7 @@ void FieldDB_Finalize() {
   FieldDB<typename Fields::geom_state_array_type>::Self().clear();
   FieldDB<typename Fields::elem_vector_state_type>::Self().clear();
   FieldDB<typename Fields::elem_sym_tensor_state_type>::Self().clear();
+  Cubature::clearCachedCubature();
 }
 
 template void FieldDB_Finalize<1>();
@@ -156,6 +156,8 @@ void Fields<SpatialDim>::allocate_and_resize_fields() {
     Kokkos::realloc(
         FieldDB<geom_array_type>::Self()["element momentum"], layout);
   }
+
+  buildNodeHalo();
 }
 
 template <int SpatialDim>
@@ -282,22 +284,128 @@ void Fields<SpatialDim>::copyElemScalarToMesh(
   femesh.addFieldView(SpatialDim, name, 1, into);
 }
 
+template <int SpatialDim>
+void Fields<SpatialDim>::buildNodeHalo() {
+  nodeHalo = NodeHalo();
+  int nsend = 0, nrecv = 0;
+  if (femesh.omega_h_mesh != nullptr) {
+    auto mesh = femesh.omega_h_mesh;
+    auto comm = mesh->comm()->get_impl();
+    const int self = mesh->comm()->rank();
+    const int nranks = mesh->comm()->size();
+    auto owners = mesh->ask_owners(0);
+    Omega_h::HostRead<Omega_h::I32> ownerRanks(owners.ranks);
+    Omega_h::HostRead<Omega_h::LO>  ownerIdxs(owners.idxs);
+    const int nnodes = ownerRanks.size();
+
+    /* group the copies by owner rank and ask each owner for its values */
+    std::vector<int> recvCounts(nranks, 0), sendCounts(nranks, 0);
+    for (int node = 0; node < nnodes; ++node)
+      if (ownerRanks[node] != self) ++recvCounts[ownerRanks[node]];
+    MPI_Alltoall(recvCounts.data(), 1, MPI_INT, sendCounts.data(), 1, MPI_INT, comm);
+    std::vector<int> recvDispls(nranks + 1, 0), sendDispls(nranks + 1, 0);
+    for (int r = 0; r < nranks; ++r) {
+      recvDispls[r + 1] = recvDispls[r] + recvCounts[r];
+      sendDispls[r + 1] = sendDispls[r] + sendCounts[r];
+    }
+    nrecv = recvDispls[nranks];
+    nsend = sendDispls[nranks];
+    std::vector<int> recvNodes(nrecv), requested(nrecv), sendNodes(nsend);
+    std::vector<int> fill(recvDispls.begin(), recvDispls.end() - 1);
+    for (int node = 0; node < nnodes; ++node) {
+      if (ownerRanks[node] == self) continue;
+      const int slot = fill[ownerRanks[node]]++;
+      recvNodes[slot] = node;
+      requested[slot] = ownerIdxs[node];
+    }
+    MPI_Alltoallv(requested.data(), recvCounts.data(), recvDispls.data(), MPI_INT,
+        sendNodes.data(), sendCounts.data(), sendDispls.data(), MPI_INT, comm);
+
+    for (int r = 0; r < nranks; ++r) {
+      if (sendCounts[r]) {
+        nodeHalo.sendRanks.push_back(r);
+        nodeHalo.sendOffsets.push_back(sendDispls[r + 1]);
+      }
+      if (recvCounts[r]) {
+        nodeHalo.recvRanks.push_back(r);
+        nodeHalo.recvOffsets.push_back(recvDispls[r + 1]);
+      }
+    }
+    nodeHalo.requests.resize(nodeHalo.sendRanks.size() + nodeHalo.recvRanks.size());
+    nodeHalo.sendNodes = Kokkos::View<int*, execution_space>("halo send nodes", nsend);
+    nodeHalo.recvNodes = Kokkos::View<int*, execution_space>("halo recv nodes", nrecv);
+    auto sendNodesHost = Kokkos::create_mirror_view(nodeHalo.sendNodes);
+    auto recvNodesHost = Kokkos::create_mirror_view(nodeHalo.recvNodes);
+    for (int i = 0; i < nsend; ++i) sendNodesHost(i) = sendNodes[i];
+    for (int i = 0; i < nrecv; ++i) recvNodesHost(i) = recvNodes[i];
+    Kokkos::deep_copy(nodeHalo.sendNodes, sendNodesHost);
+    Kokkos::deep_copy(nodeHalo.recvNodes, recvNodesHost);
+  }
+  nodeHalo.sendBuffer = Kokkos::View<Scalar*, execution_space>("halo send", nsend * SpatialDim);
+  nodeHalo.recvBuffer = Kokkos::View<Scalar*, execution_space>("halo recv", nrecv * SpatialDim);
+  nodeHalo.sendHost = Kokkos::create_mirror_view(nodeHalo.sendBuffer);
+  nodeHalo.recvHost = Kokkos::create_mirror_view(nodeHalo.recvBuffer);
+}
+
+template <int SpatialDim>
+void Fields<SpatialDim>::exchangeNodeHalo(int width) {
+  if (nodeHalo.requests.empty()) return;
+  auto comm = femesh.omega_h_mesh->comm()->get_impl();
+  Kokkos::deep_copy(nodeHalo.sendHost, nodeHalo.sendBuffer);
+  int nreq = 0, begin = 0;
+  for (size_t m = 0; m < nodeHalo.recvRanks.size(); ++m) {
+    const int end = nodeHalo.recvOffsets[m];
+    MPI_Irecv(nodeHalo.recvHost.data() + width * begin, width * (end - begin),
+        MPI_DOUBLE, nodeHalo.recvRanks[m], 42, comm, &nodeHalo.requests[nreq++]);
+    begin = end;
+  }
+  begin = 0;
+  for (size_t m = 0; m < nodeHalo.sendRanks.size(); ++m) {
+    const int end = nodeHalo.sendOffsets[m];
+    MPI_Isend(nodeHalo.sendHost.data() + width * begin, width * (end - begin),
+        MPI_DOUBLE, nodeHalo.sendRanks[m], 42, comm, &nodeHalo.requests[nreq++]);
+    begin = end;
+  }
+  MPI_Waitall(nreq, nodeHalo.requests.data(), MPI_STATUSES_IGNORE);
+  Kokkos::deep_copy(nodeHalo.recvBuffer, nodeHalo.recvHost);
+}
+
 template <int SpatialDim>
 void Fields<SpatialDim>::conformGeom(
-    char const* name, geom_array_type a) {
-  copyGeomToMesh(name, a);
-  femesh.omega_h_mesh->sync_tag(0, name);
-  copyGeomFromMesh(name, a);
-  femesh.omega_h_mesh->remove_tag(0, name);
+    char const*, geom_array_type a) {
+  auto sendNodes = nodeHalo.sendNodes;
+  auto sendBuffer = nodeHalo.sendBuffer;
+  auto pack = LAMBDA_EXPRESSION(int i) {
+    for (int j = 0; j < SpatialDim; ++j)
+      sendBuffer(i * SpatialDim + j) = a(sendNodes(i), j);
+  };
+  Kokkos::parallel_for(sendNodes.size(), pack);
+  exchangeNodeHalo(SpatialDim);
+  auto recvNodes = nodeHalo.recvNodes;
+  auto recvBuffer = nodeHalo.recvBuffer;
+  auto unpack = LAMBDA_EXPRESSION(int i) {
+    for (int j = 0; j < SpatialDim; ++j)
+      a(recvNodes(i), j) = recvBuffer(i * SpatialDim + j);
+  };
+  Kokkos::parallel_for(recvNodes.size(), unpack);
 }
 
 template <int SpatialDim>
 void Fields<SpatialDim>::conform(
-    char const* name, array_type a) {
-  copyToMesh(name, a);
-  femesh.omega_h_mesh->sync_tag(0, name);
-  copyFromMesh(name, a);
-  femesh.omega_h_mesh->remove_tag(0, name);
+    char const*, array_type a) {
+  auto sendNodes = nodeHalo.sendNodes;
+  auto sendBuffer = nodeHalo.sendBuffer;
+  auto pack = LAMBDA_EXPRESSION(int i) {
+    sendBuffer(i) = a(sendNodes(i));
+  };
+  Kokkos::parallel_for(sendNodes.size(), pack);
+  exchangeNodeHalo(1);
+  auto recvNodes = nodeHalo.recvNodes;
+  auto recvBuffer = nodeHalo.recvBuffer;
+  auto unpack = LAMBDA_EXPRESSION(int i) {
+    a(recvNodes(i)) = recvBuffer(i);
+  };
+  Kokkos::parallel_for(recvNodes.size(), unpack);
 }
 
 template <int SpatialDim>
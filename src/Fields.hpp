@@ -48,6 +48,7 @@
 #include "FEMesh.hpp"
 #include <Teuchos_ParameterList.hpp>
 #include <Omega_h_mesh.hpp>
+#include <vector>
 
 namespace lgr {
 
@@ -152,10 +153,32 @@ struct Fields {
       char const* name, const elem_tensor_type from) const;
   void copyElemSymTensorToMesh(
       char const* name, const elem_sym_tensor_type from) const;
-  // Parallel field synchronization via Omega_h
+  // Parallel field synchronization: owned node values overwrite their copies
   void conformGeom(char const* name, geom_array_type a);
   void conform(char const* name, array_type a);
 
+  /* Owner to copy exchange plan for nodal fields.  It is built once per
+     mesh, with buffers sized for SpatialDim values per node, so conform()
+     and conformGeom() only pack, post the messages and unpack.  On one rank
+     the plan is empty and the exchange touches no memory. */
+  struct NodeHalo {
+    std::vector<int>         sendRanks;
+    std::vector<int>         sendOffsets;  // nodes, one past each message
+    std::vector<int>         recvRanks;
+    std::vector<int>         recvOffsets;
+    std::vector<MPI_Request> requests;
+    Kokkos::View<int*, execution_space>    sendNodes;
+    Kokkos::View<int*, execution_space>    recvNodes;
+    Kokkos::View<Scalar*, execution_space> sendBuffer;
+    Kokkos::View<Scalar*, execution_space> recvBuffer;
+    typename Kokkos::View<Scalar*, execution_space>::HostMirror sendHost;
+    typename Kokkos::View<Scalar*, execution_space>::HostMirror recvHost;
+  };
+  NodeHalo nodeHalo;
+
+  void buildNodeHalo();
+  void exchangeNodeHalo(int width);
+
   void copyTagsFromMesh(
       Omega_h::TagSet const& tags,
       int                    state,
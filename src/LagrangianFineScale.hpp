@@ -70,6 +70,7 @@ class LagrangianFineScale {
   const typename Fields::state_array_type       planeWaveModulus;
   const typename Fields::array_type             nodal_pressure;
   const typename Fields::array_type             nodal_pressure_increment;
+  typename Fields::geom_state_array_type        velocityStates;
   int                                           state0_;
   int                                           state1_;
   Scalar                                        c_tau_;
@@ -81,6 +82,41 @@ class LagrangianFineScale {
   LagrangianFineScale(
       Fields &mesh_fields, int state0_in, int state1_in, Scalar c_tau_in);
 
+  void setStates(int state0_in, int state1_in);
+
+  void setTimeStep(Scalar timeStep);
+
+  /* mid-configuration coordinates and velocities, element-averaged
+     velocity and nodal pressure rates, and nodal pressures */
+  KOKKOS_INLINE_FUNCTION
+  void gather(
+      int     ielem,
+      Scalar *x,
+      Scalar *y,
+      Scalar *z,
+      Scalar *vx,
+      Scalar *vy,
+      Scalar *vz,
+      Scalar *vdot,
+      Scalar *pressure,
+      Scalar &pdot) const;
+
+  /* fine scale velocity, displacement and pressure from gathered data
+     and the mid-configuration shape function gradients */
+  KOKKOS_INLINE_FUNCTION
+  void elementFineScale(
+      int           ielem,
+      const Scalar *vx,
+      const Scalar *vy,
+      const Scalar *vz,
+      const Scalar *vdot,
+      const Scalar *pressure,
+      const Scalar  pdot,
+      const Scalar *grad_x,
+      const Scalar *grad_y,
+      const Scalar *grad_z,
+      const Scalar  elem_volume) const;
+
   KOKKOS_INLINE_FUNCTION
   void operator()(int ielem) const;
 
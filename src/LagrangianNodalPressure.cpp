@@ -42,6 +42,7 @@
 */
 
 #include "LagrangianNodalPressure.hpp"
+#include "LagrangianFineScale_inline.hpp"
 #include "FieldDB.hpp"
 #include "LGRLambda.hpp"
 #include "ElementHelpers.hpp"
@@ -84,8 +85,19 @@ void AssembleNodalPressureEquation<SpatialDim>::operator()(ElemLoopTag, int iele
     z[i] = 0.5 * (oc(n, 2) + nc(n, 2));
   }
   comp_grad(x, y, z, grad_x, grad_y, grad_z);
-  Scalar volume = dot4(x, grad_x);
+  const Scalar volume = dot4(x, grad_x);
 
+  elementContribution(ielem, grad_x, grad_y, grad_z, volume);
+}
+
+template <int SpatialDim>
+KOKKOS_INLINE_FUNCTION
+void AssembleNodalPressureEquation<SpatialDim>::elementContribution(
+    int           ielem,
+    const Scalar *grad_x,
+    const Scalar *grad_y,
+    const Scalar *grad_z,
+    Scalar        volume) const {
   //pressure projection terms
   Scalar pressure = 0;
 
@@ -121,9 +133,9 @@ void AssembleNodalPressureEquation<SpatialDim>::operator()(ElemLoopTag, int iele
   deltaPressure /= ElemNodeCount;
 
   for (int i = 0; i < Fields::ElemNodeCount; ++i) {
-    volume_contribution(ielem, i) += volume;
-    pressure_contribution(ielem, i) += pressure;
-    pressure_increment_contribution(ielem, i) += deltaPressure;
+    volume_contribution(ielem, i) = volume;
+    pressure_contribution(ielem, i) = pressure;
+    pressure_increment_contribution(ielem, i) = deltaPressure;
   }
 
   //uprime terms
@@ -172,46 +184,101 @@ void AssembleNodalPressureEquation<SpaceDim>::apply(const Fields &mesh_fields) {
       Kokkos::RangePolicy<ExecSpace, ElemLoopTag>(
           0, mesh_fields.femesh.nelems),
       *this);
+  assembleNodes(mesh_fields);
+}
+
+template <int SpaceDim>
+void AssembleNodalPressureEquation<SpaceDim>::assembleNodes(const Fields &mesh_fields) {
   Kokkos::parallel_for(
       Kokkos::RangePolicy<ExecSpace, NodeLoopTag>(
           0, mesh_fields.femesh.nnodes),
       *this);
 }
 
+template <int SpatialDim>
+FineScaleNodalPressureEquation<SpatialDim>::FineScaleNodalPressureEquation(
+      const LagrangianFineScale<SpatialDim> &          arg_fineScale,
+      const AssembleNodalPressureEquation<SpatialDim> &arg_assembler)
+      : fineScale(arg_fineScale)
+      , assembler(arg_assembler) {}
+
+template <int SpatialDim>
+KOKKOS_INLINE_FUNCTION
+void FineScaleNodalPressureEquation<SpatialDim>::operator()(int ielem) const {
+  Scalar x[ElemNodeCount], y[ElemNodeCount], z[ElemNodeCount];
+  Scalar vx[ElemNodeCount], vy[ElemNodeCount], vz[ElemNodeCount];
+  Scalar grad_x[ElemNodeCount], grad_y[ElemNodeCount], grad_z[ElemNodeCount];
+  Scalar vdot[3];
+  Scalar pressure[ElemNodeCount];
+  Scalar pdot;
+
+  fineScale.gather(ielem, x, y, z, vx, vy, vz, vdot, pressure, pdot);
+
+  comp_grad(x, y, z, grad_x, grad_y, grad_z);
+  const Scalar volume = dot4(x, grad_x);
+
+  //the pressure contributions read the fine scale displacement just
+  //written for this element
+  fineScale.elementFineScale(ielem, vx, vy, vz, vdot, pressure, pdot,
+                             grad_x, grad_y, grad_z, volume);
+  assembler.elementContribution(ielem, grad_x, grad_y, grad_z, volume);
+}
+
 template <int SpatialDim>
 LagrangianNodalPressure<SpatialDim>::LagrangianNodalPressure(Fields &mesh_fields, int arg_state0, int arg_state1)
-      : meshFields_(mesh_fields), state0_(arg_state0), state1_(arg_state1) {}
+      : meshFields_(mesh_fields), state0_(arg_state0), state1_(arg_state1)
+      , assembler_(mesh_fields, arg_state0, arg_state1) {}
+
+template <int SpatialDim>
+void LagrangianNodalPressure<SpatialDim>::setStates(int arg_state0, int arg_state1) {
+  state0_ = arg_state0;
+  state1_ = arg_state1;
+  assembler_.setStates(arg_state0, arg_state1);
+}
 
 template <int SpatialDim>
 void LagrangianNodalPressure<SpatialDim>::zeroData() {
   //initialize nodal volume and pressure fields
-  const typename Fields::array_type &nodal_volume = NodalVolume<Fields>();
-  const typename Fields::array_type &nodal_pressure = NodalPressure<Fields>();
-  const typename Fields::array_type &nodal_pressure_increment =
-      NodalPressureIncrement<Fields>();
-  Kokkos::deep_copy(nodal_volume, 0.0);
-  Kokkos::deep_copy(nodal_pressure, 0.0);
-  Kokkos::deep_copy(nodal_pressure_increment, 0.0);
+  Kokkos::deep_copy(assembler_.nodal_volume, 0.0);
+  Kokkos::deep_copy(assembler_.nodal_pressure, 0.0);
+  Kokkos::deep_copy(assembler_.nodal_pressure_increment, 0.0);
 }
 
 template <int SpatialDim>
 void LagrangianNodalPressure<SpatialDim>::computeNodalPressure() {
   this->zeroData();
 
-  AssembleNodalPressureEquation<SpatialDim> anpe(
-      meshFields_, state0_, state1_);
-  anpe.apply(meshFields_);
+  assembler_.apply(meshFields_);
+
+  solvePressureEquation();
+}
+
+template <int SpatialDim>
+void LagrangianNodalPressure<SpatialDim>::computeNodalPressure(
+    const LagrangianFineScale<SpatialDim> &fineScale) {
+  FineScaleNodalPressureEquation<SpatialDim> op(fineScale, assembler_);
+  Kokkos::parallel_for(meshFields_.femesh.nelems, op);
+
+  //the element pass reads the old nodal pressure, so zero it afterwards
+  this->zeroData();
+
+  assembler_.assembleNodes(meshFields_);
+
+  solvePressureEquation();
+}
 
-  meshFields_.conform("nodal_volume", NodalVolume<Fields>());
-  meshFields_.conform("nodal_pressure", NodalPressure<Fields>());
+template <int SpatialDim>
+void LagrangianNodalPressure<SpatialDim>::solvePressureEquation() {
+  meshFields_.conform("nodal_volume", assembler_.nodal_volume);
+  meshFields_.conform("nodal_pressure", assembler_.nodal_pressure);
   meshFields_.conform(
-      "nodal_pressure_increment", NodalPressureIncrement<Fields>());
+      "nodal_pressure_increment", assembler_.nodal_pressure_increment);
 
   //compute nodal presssure (solve pressure equation)
   {
-    auto nodal_volume = NodalVolume<Fields>();
-    auto nodal_pressure = NodalPressure<Fields>();
-    auto nodal_pressure_increment = NodalPressureIncrement<Fields>();
+    auto nodal_volume = assembler_.nodal_volume;
+    auto nodal_pressure = assembler_.nodal_pressure;
+    auto nodal_pressure_increment = assembler_.nodal_pressure_increment;
     auto computePressure = LAMBDA_EXPRESSION(int inode) {
       const Scalar v = nodal_volume(inode);
       Scalar &     p = nodal_pressure(inode);
@@ -225,6 +292,7 @@ void LagrangianNodalPressure<SpatialDim>::computeNodalPressure() {
 
 #define LGR_EXPL_INST(SpatialDim) \
 template struct AssembleNodalPressureEquation<SpatialDim>; \
+template struct FineScaleNodalPressureEquation<SpatialDim>; \
 template class LagrangianNodalPressure<SpatialDim>;
 LGR_EXPL_INST(3)
 LGR_EXPL_INST(2)
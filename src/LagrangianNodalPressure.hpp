@@ -47,6 +47,7 @@
 #include "Fields.hpp"
 #include "FieldsEnum.hpp"
 #include "MeshFixture.hpp"
+#include "LagrangianFineScale.hpp"
 
 namespace lgr {
 
@@ -80,6 +81,23 @@ struct AssembleNodalPressureEquation {
   AssembleNodalPressureEquation(
       const Fields &mesh_fields, int arg_state0, int arg_state1);
 
+  /* the contribution temporaries are fully overwritten by the element
+     loop, so one instance can be reused across time steps */
+  void setStates(int arg_state0, int arg_state1) {
+    state0 = arg_state0;
+    state1 = arg_state1;
+  }
+
+  /* volume, pressure and pressure increment contributions from the
+     mid-configuration shape function gradients and volume */
+  KOKKOS_INLINE_FUNCTION
+  void elementContribution(
+      int           ielem,
+      const Scalar *grad_x,
+      const Scalar *grad_y,
+      const Scalar *grad_z,
+      Scalar        volume) const;
+
   struct ElemLoopTag {};
   KOKKOS_INLINE_FUNCTION
   void operator()(ElemLoopTag, int ielem) const;
@@ -90,8 +108,33 @@ struct AssembleNodalPressureEquation {
 
   void apply(const Fields &mesh_fields);
 
+  /* node loop only, for contributions left by a fused element pass */
+  void assembleNodes(const Fields &mesh_fields);
+
 };  //end struct AssembleNodalPressureEquation
 
+/* Fused element pass: gathers the element once and computes the fine
+   scale fields followed by the nodal pressure contributions from the
+   same gradients.  The fine scale fields are read from the nodal
+   pressure before it is reassembled, as in the unfused sequence. */
+template <int SpatialDim>
+struct FineScaleNodalPressureEquation {
+  typedef lgr::Fields<SpatialDim> Fields;
+
+  static const int ElemNodeCount = Fields::ElemNodeCount;
+
+  const LagrangianFineScale<SpatialDim>           fineScale;
+  const AssembleNodalPressureEquation<SpatialDim> assembler;
+
+  FineScaleNodalPressureEquation(
+      const LagrangianFineScale<SpatialDim> &          arg_fineScale,
+      const AssembleNodalPressureEquation<SpatialDim> &arg_assembler);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int ielem) const;
+
+};  //end struct FineScaleNodalPressureEquation
+
 template <int SpatialDim>
 class LagrangianNodalPressure {
  public:
@@ -103,18 +146,28 @@ class LagrangianNodalPressure {
   Fields &meshFields_;
   int     state0_;
   int     state1_;
+  AssembleNodalPressureEquation<SpatialDim> assembler_;
+
+  void solvePressureEquation();
 
  public:
   LagrangianNodalPressure(Fields &mesh_fields, int arg_state0, int arg_state1);
 
+  void setStates(int arg_state0, int arg_state1);
+
   void zeroData();
 
   void computeNodalPressure();
 
+  /* updates the fine scale fields in the same element pass;
+     replaces fineScale.apply(dt) followed by computeNodalPressure() */
+  void computeNodalPressure(const LagrangianFineScale<SpatialDim> &fineScale);
+
 };  //end class LagrangianNodalPressure
 
 #define LGR_EXPL_INST_DECL(SpatialDim) \
 extern template struct AssembleNodalPressureEquation<SpatialDim>; \
+extern template struct FineScaleNodalPressureEquation<SpatialDim>; \
 extern template class LagrangianNodalPressure<SpatialDim>;
 LGR_EXPL_INST_DECL(3)
 LGR_EXPL_INST_DECL(2)
@@ -79,7 +79,66 @@ LagrangianStep<SpatialDim>::LagrangianStep(
       : theMaterialModels_(material_models)
       , meshFields_(mesh_fields)
       , machine_(machine)
-      , mesh_(mesh) {}
+      , mesh_(mesh)
+      , c_tau_(1.0) {
+  buildHelpers();
+}
+
+template <int SpatialDim>
+LagrangianStep<SpatialDim>::~LagrangianStep() {}
+
+template <int SpatialDim>
+void LagrangianStep<SpatialDim>::buildHelpers() {
+  // get VMS stabilization parameter
+  Teuchos::ParameterList &fieldData = meshFields_.fieldData;
+  c_tau_ = fieldData.get<double>("vms stabilization parameter", 1.0);
+  fineScale_.reset(new LagrangianFineScale<SpatialDim>(meshFields_, 0, 1, c_tau_));
+  nodalPressure_.reset(new LagrangianNodalPressure<SpatialDim>(meshFields_, 0, 1));
+  initializeElements_.reset(
+      new initialize_time_step_elements<SpatialDim>(meshFields_, 0, 1));
+  kinematics_.reset(new grad<SpatialDim>(meshFields_, 0, 1, 0.5));
+  deformation_.reset(new GRAD<SpatialDim>(meshFields_, 0, 1, 1.0));
+  internalForce_.reset(new internal_force<SpatialDim>(meshFields_, 0, 1));
+  assembleForces_.reset(new assemble_forces<SpatialDim>(meshFields_));
+  energyStep_.reset(new energy_step<SpatialDim>(meshFields_, 0.0, 0, 1));
+  elementStep_.reset(new element_step<SpatialDim>(meshFields_));
+  tallies_.reset(new GlobalTallies<SpatialDim>(meshFields_, 0));
+  velocity_ = Velocity<Fields>();
+  coordinates_ = Coordinates<Fields>();
+  displacement_ = Displacement<Fields>();
+  acceleration_ = Acceleration<Fields>();
+  internalForceField_ = InternalForce<Fields>();
+  nodalMass_ = NodalMass<Fields>();
+  if (fieldData.get<bool>("Fused Element Step", false))
+    fusedStep_.reset(new fused_element_step<SpatialDim>(meshFields_));
+  else
+    fusedStep_.reset();
+}
+
+template <int SpatialDim>
+void LagrangianStep<SpatialDim>::updateFineScaleAndPressure(const Scalar dt) {
+  if (fusedStep_) {
+    fineScale_->setTimeStep(dt);
+    nodalPressure_->computeNodalPressure(*fineScale_);
+  } else {
+    //compute fine scale fields
+    fineScale_->apply(dt);
+
+    //compute nodal pressure
+    nodalPressure_->computeNodalPressure();
+  }
+}
+
+template <int SpatialDim>
+void LagrangianStep<SpatialDim>::updateMesh() {
+  buildHelpers();
+}
+
+template <int SpatialDim>
+GlobalTallies<SpatialDim> &LagrangianStep<SpatialDim>::tallies(int state) {
+  tallies_->setState(state);
+  return *tallies_;
+}
 
 template <int SpatialDim>
 PerformanceData LagrangianStep<SpatialDim>::advanceTime(
@@ -88,95 +147,86 @@ PerformanceData LagrangianStep<SpatialDim>::advanceTime(
     const Scalar                      simtime,
     const Scalar                      dt,
     const int                         current_state,
-    const int                         next_state) const {
+    const int                         next_state) {
   PerformanceData     perfData;
   Kokkos::Timer wall_clock;
   wall_clock.reset();
 
+  fineScale_->setStates(current_state, next_state);
+  nodalPressure_->setStates(current_state, next_state);
+  initializeElements_->setStates(current_state, next_state);
+  internalForce_->setStates(current_state, next_state);
+  energyStep_->setStates(dt, current_state, next_state);
+  if (fusedStep_) fusedStep_->setStates(current_state, next_state);
+
+  const typename Fields::geom_array_type cur_vel(
+      Fields::getGeomFromSA(velocity_, current_state));
+  const typename Fields::geom_array_type next_vel(
+      Fields::getGeomFromSA(velocity_, next_state));
+  const typename Fields::geom_array_type xn(
+      Fields::getGeomFromSA(coordinates_, current_state));
+  const typename Fields::geom_array_type xnp1(
+      Fields::getGeomFromSA(coordinates_, next_state));
+
   //initialize time step nodes
-  {
-    const typename Fields::geom_array_type cur_vel(
-        Fields::getGeomFromSA(Velocity<Fields>(), current_state));
-    const typename Fields::geom_array_type next_vel(
-        Fields::getGeomFromSA(Velocity<Fields>(), next_state));
-    const typename Fields::geom_array_type disp(Displacement<Fields>());
-    const typename Fields::geom_array_type xn(
-        Fields::getGeomFromSA(Coordinates<Fields>(), current_state));
-    const typename Fields::geom_array_type xnp1(
-        Fields::getGeomFromSA(Coordinates<Fields>(), next_state));
-    Kokkos::deep_copy(next_vel, cur_vel);
-    Kokkos::deep_copy(xnp1, xn);
-    Kokkos::deep_copy(disp, 0.0);
-  }
-  //zero nodal pressure data
-  {
-    LagrangianNodalPressure<SpatialDim> lnp(
-        meshFields_, current_state, next_state);
-    lnp.zeroData();
-  }
+  Kokkos::deep_copy(next_vel, cur_vel);
+  Kokkos::deep_copy(xnp1, xn);
+  Kokkos::deep_copy(displacement_, 0.0);
 
-  initialize_time_step_elements<SpatialDim>::apply(
-      meshFields_, current_state, next_state);
+  //zero nodal pressure data
+  nodalPressure_->zeroData();
 
-  // get VMS stabilization parameter
-  Teuchos::ParameterList &fieldData = meshFields_.fieldData;
-  Scalar c_tau = fieldData.get<double>("vms stabilization parameter", 1.0);
-  //compute fine scale fields
-  {
-    LagrangianFineScale<SpatialDim> lfs(
-        meshFields_, current_state, next_state, c_tau);
-    lfs.apply(dt);
-  }
+  initializeElements_->apply();
 
-  //compute/initialize nodal pressure before beginning fixed point iteration
-  {
-    LagrangianNodalPressure<SpatialDim> lnp(
-        meshFields_, current_state, next_state);
-    lnp.computeNodalPressure();
-  }
+  //compute fine scale fields and initialize nodal pressure before
+  //beginning fixed point iteration
+  updateFineScaleAndPressure(dt);
 
   perfData.internal_force_time = 0.0;
   perfData.comm_time = 0.0;
   for (int iterationCount = 0; iterationCount < 2; ++iterationCount) {
-    //volume, gradient, velocity gradient, mid-configuration x_{n+1/2}.
-    //the artificial viscosity uses the velocity gradient.
-    {
-      const Scalar alpha(0.5);
-      grad<SpatialDim>::apply(
-          meshFields_, current_state, next_state, alpha);
-    }
-
-    //calculate and store internal forces for each element.
-    {
+    if (fusedStep_) {
+      //volume, gradients and internal forces at x_{n+1/2} in one pass
       const double t0 = wall_clock.seconds();
-      internal_force<SpatialDim>::apply(
-          meshFields_, current_state, next_state);
+      fusedStep_->applyMidpoint();
       const double t1 = wall_clock.seconds();
       perfData.internal_force_time += comm::max(machine_, t1 - t0);
+    } else {
+      //volume, gradient, velocity gradient, mid-configuration x_{n+1/2}.
+      //the artificial viscosity uses the velocity gradient.
+      kinematics_->setStates(current_state, next_state, 0.5);
+      kinematics_->apply();
+
+      //calculate and store internal forces for each element.
+      {
+        const double t0 = wall_clock.seconds();
+        internalForce_->apply();
+        const double t1 = wall_clock.seconds();
+        perfData.internal_force_time += comm::max(machine_, t1 - t0);
+      }
     }
     execution_space::fence();
 
     //Assemble element contributions to nodal force into a nodal force vector.
-    assemble_forces<SpatialDim>::apply(meshFields_);
+    assembleForces_->apply();
 
     // Apply force-based boundary conditions
-    internal_force_contribs.add_to(InternalForce<Fields>());
+    internal_force_contribs.add_to(internalForceField_);
 
     //mpi swap and add nodal forces
     {
       const double t0 = wall_clock.seconds();
-      meshFields_.conformGeom("force", InternalForce<Fields>());
+      meshFields_.conformGeom("force", internalForceField_);
       const double t1 = wall_clock.seconds();
       perfData.comm_time += comm::max(machine_, t1 - t0);
     }
 
     //compute acceleration
     {
-      const typename Fields::array_type &nodal_mass = NodalMass<Fields>();
-      const typename Fields::geom_array_type &acceleration =
-          Acceleration<Fields>();
+      const typename Fields::array_type &nodal_mass = nodalMass_;
+      const typename Fields::geom_array_type &acceleration = acceleration_;
       const typename Fields::geom_array_type &internal_force =
-          InternalForce<Fields>();
+          internalForceField_;
       auto updateAcceleration =
           LAMBDA_EXPRESSION(int inode) {
         const Scalar m = nodal_mass(inode);
@@ -187,16 +237,11 @@ PerformanceData LagrangianStep<SpatialDim>::advanceTime(
     }
 
     //Apply zero acceleration boundary conditions
-    accel_contribs.add_to(Acceleration<Fields>());
+    accel_contribs.add_to(acceleration_);
 
     //update velocity
     {
-      const typename Fields::geom_array_type cur_vel(
-          Fields::getGeomFromSA(Velocity<Fields>(), current_state));
-      const typename Fields::geom_array_type next_vel(
-          Fields::getGeomFromSA(Velocity<Fields>(), next_state));
-      const typename Fields::geom_array_type acceleration(
-          Acceleration<Fields>());
+      const typename Fields::geom_array_type acceleration(acceleration_);
       auto updateVelocity = LAMBDA_EXPRESSION(int inode) {
         const Scalar dt_vel = dt;
         for (int slot = 0; slot < 3; ++slot) {
@@ -210,27 +255,17 @@ PerformanceData LagrangianStep<SpatialDim>::advanceTime(
     //mpi conform nodal velocity
     {
       const double t0 = wall_clock.seconds();
-      meshFields_.conformGeom(
-          "vel", Fields::getGeomFromSA(Velocity<Fields>(), next_state));
+      meshFields_.conformGeom("vel", next_vel);
       const double t1 = wall_clock.seconds();
       perfData.comm_time += comm::max(machine_, t1 - t0);
     }
 
     //update element internal energy
-    energy_step<SpatialDim>::apply(
-        meshFields_, dt, current_state, next_state);
+    energyStep_->apply();
 
     //update coordinates
     {
-      const typename Fields::geom_array_type xn(
-          Fields::getGeomFromSA(Coordinates<Fields>(), current_state));
-      const typename Fields::geom_array_type xnp1(
-          Fields::getGeomFromSA(Coordinates<Fields>(), next_state));
-      const typename Fields::geom_array_type cur_vel(
-          Fields::getGeomFromSA(Velocity<Fields>(), current_state));
-      const typename Fields::geom_array_type next_vel(
-          Fields::getGeomFromSA(Velocity<Fields>(), next_state));
-      const typename Fields::geom_array_type cur_disp(Displacement<Fields>());
+      const typename Fields::geom_array_type cur_disp(displacement_);
       auto updateCoordinates = LAMBDA_EXPRESSION(int inode) {
         const Scalar dt_disp = dt;
         for (int slot = 0; slot < 3; ++slot) {
@@ -260,40 +295,29 @@ PerformanceData LagrangianStep<SpatialDim>::advanceTime(
 
       volume, gradient, velocity gradient, deformation gradient F at end-configuration x_{n+1}.
     */
-    {
-      const Scalar alpha(1.0);
-      grad<SpatialDim>::apply(
-          meshFields_, current_state, next_state, alpha);
-      //deformation gradient
-      GRAD<SpatialDim>::apply(
-          meshFields_, current_state, next_state, alpha);
-    }
-
     /*
       update element data(volume,density,stress,...).
       this uses the pre-computed deformation gradient F, but not the velocity gradient,
       since all materials are currently HYPER-elastic.
     */
-    element_step<SpatialDim> theElementStep(meshFields_);
-    theElementStep.apply(meshFields_, next_state);
+    if (fusedStep_) {
+      fusedStep_->applyEndpoint();
+    } else {
+      kinematics_->setStates(current_state, next_state, 1.0);
+      kinematics_->apply();
+      //deformation gradient
+      deformation_->setStates(current_state, next_state, 1.0);
+      deformation_->apply();
 
-    for (auto matPtr : theMaterialModels_) {
-      matPtr->updateElements(meshFields_, next_state, simtime, dt);
+      elementStep_->apply(meshFields_, next_state);
     }
 
-    //compute fine scale fields
-    {
-      LagrangianFineScale<SpatialDim> lfs(
-          meshFields_, current_state, next_state, c_tau);
-      lfs.apply(dt);
+    for (auto matPtr : theMaterialModels_) {
+      matPtr->updateElements(meshFields_, next_state, simtime, dt);
     }
 
-    //compute nodal pressure
-    {
-      LagrangianNodalPressure<SpatialDim> lnp(
-          meshFields_, current_state, next_state);
-      lnp.computeNodalPressure();
-    }
+    //compute fine scale fields and nodal pressure
+    updateFineScaleAndPressure(dt);
 
     execution_space::fence();
   }  //end for (int iterationCount=0; iterationCount<2; ++iterationCount)
@@ -49,6 +49,7 @@
 #include "MaterialModels.hpp"
 #include "VectorContribution.hpp"
 #include <list>
+#include <memory>
 
 namespace lgr {
 
@@ -65,6 +66,18 @@ struct PerformanceData {
   void best(const PerformanceData &rhs);
 };  //end struct PerformanceData
 
+template <int SpatialDim> class LagrangianFineScale;
+template <int SpatialDim> class LagrangianNodalPressure;
+template <int SpatialDim> struct initialize_time_step_elements;
+template <int SpatialDim> struct grad;
+template <int SpatialDim> struct GRAD;
+template <int SpatialDim> struct internal_force;
+template <int SpatialDim> struct assemble_forces;
+template <int SpatialDim> struct energy_step;
+template <int SpatialDim> struct element_step;
+template <int SpatialDim> struct fused_element_step;
+template <int SpatialDim> struct GlobalTallies;
+
 template <int SpatialDim>
 class LagrangianStep {
  public:
@@ -79,6 +92,37 @@ class LagrangianStep {
   Fields &       meshFields_;
   comm::Machine  machine_;
   Omega_h::Mesh *mesh_;
+  Scalar         c_tau_;
+
+  /* functors that hold views of the FieldDB fields; they are built once
+     per mesh and only have their states switched during a step, so a
+     step does no FieldDB lookups */
+  std::unique_ptr<LagrangianFineScale<SpatialDim>>           fineScale_;
+  std::unique_ptr<LagrangianNodalPressure<SpatialDim>>       nodalPressure_;
+  std::unique_ptr<initialize_time_step_elements<SpatialDim>> initializeElements_;
+  std::unique_ptr<grad<SpatialDim>>                          kinematics_;
+  std::unique_ptr<GRAD<SpatialDim>>                          deformation_;
+  std::unique_ptr<internal_force<SpatialDim>>                internalForce_;
+  std::unique_ptr<assemble_forces<SpatialDim>>               assembleForces_;
+  std::unique_ptr<energy_step<SpatialDim>>                   energyStep_;
+  std::unique_ptr<element_step<SpatialDim>>                  elementStep_;
+  std::unique_ptr<GlobalTallies<SpatialDim>>                 tallies_;
+
+  /* nodal fields updated directly by the step, resolved with the helpers */
+  typename Fields::geom_state_array_type velocity_;
+  typename Fields::geom_state_array_type coordinates_;
+  typename Fields::geom_array_type       displacement_;
+  typename Fields::geom_array_type       acceleration_;
+  typename Fields::geom_array_type       internalForceField_;
+  typename Fields::array_type            nodalMass_;
+
+  /* optional fused element passes ("Fused Element Step" in the field
+     data); when absent the unfused functors above are used */
+  std::unique_ptr<fused_element_step<SpatialDim>>      fusedStep_;
+
+  void buildHelpers();
+
+  void updateFineScaleAndPressure(const Scalar dt);
 
  public:
   LagrangianStep(
@@ -89,13 +133,20 @@ class LagrangianStep {
       comm::Machine  machine,
       Omega_h::Mesh *mesh);
 
+  ~LagrangianStep();
+
+  /* must be called after the mesh is adapted and the fields are remapped */
+  void updateMesh();
+
+  GlobalTallies<SpatialDim> &tallies(int state);
+
   PerformanceData advanceTime(
       const VectorContributions<SpatialDim>& accel_contribs,
       const VectorContributions<SpatialDim>& internal_force_contribs,
       const Scalar                      simtime,
       const Scalar                      dt,
       const int                         current_state,
-      const int                         next_state) const;
+      const int                         next_state);
 
 };  //end class LagrangianStep
 
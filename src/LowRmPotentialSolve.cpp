@@ -17,7 +17,9 @@
 #include "AmgXSparseLinearProblem.hpp"
 #endif
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 namespace lgr {
 
@@ -1124,6 +1126,129 @@ void LowRmPotentialSolve<spaceDim>::initialize() {
   int numSolves = _numConductors + 1;  // +1 : particular solve
   _lhs = ScalarMultiVector("solution", numSolves, numRows);
   _rhs = ScalarMultiVector("load", numSolves, numRows);
+
+  int numCells = _meshFields->femesh.nelems;
+  _lastLhs = ScalarMultiVector("last solution", numSolves, numRows);
+  _previousLhs = ScalarMultiVector("previous solution", numSolves, numRows);
+  _cellConductances = ScalarVector("cell conductances", numCells);
+  _lastCellConductances = ScalarVector("last cell conductances", numCells);
+  _numRecordedSolves = 0;
+}
+
+template <int spaceDim>
+void LowRmPotentialSolve<spaceDim>::computeCellConductances(
+    ScalarVector cellConductances) {
+  const int nodesPerCell = spaceDim + 1;
+
+  auto mesh = _meshFields->femesh.omega_h_mesh;
+  auto cells2nodes = mesh->ask_elem_verts();
+  auto coords = mesh->coords();
+
+  int numCells = _meshFields->femesh.nelems;
+
+  Scalar quadratureWeight = 1.0;  // for a 1-point quadrature rule for simplices
+  for (int d = 2; d <= spaceDim; d++) {
+    quadratureWeight /= Scalar(d);
+  }
+
+  auto conductivity = _conductivity;
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<int>(0, numCells),
+      LAMBDA_EXPRESSION(int cellOrdinal) {
+        Omega_h::Matrix<spaceDim, spaceDim> jacobian;
+        DefaultLocalOrdinal lastVertex =
+            cells2nodes[cellOrdinal * nodesPerCell + spaceDim];
+        for (int d1 = 0; d1 < spaceDim; d1++) {
+          for (int d2 = 0; d2 < spaceDim; d2++) {
+            DefaultLocalOrdinal vertex =
+                cells2nodes[cellOrdinal * nodesPerCell + d2];
+            jacobian[d1][d2] = coords[vertex * spaceDim + d1] -
+                               coords[lastVertex * spaceDim + d1];
+          }
+        }
+        auto jacobianDet = Omega_h::determinant(jacobian);
+        auto jacobianInverse = Omega_h::invert(jacobian);
+        auto cellVolume = fabs(jacobianDet) * quadratureWeight;
+
+        // same gradients as in determineJouleHeating(): the last one is minus the sum of the others
+        Scalar gradientsSquared = 0.0;
+        for (int d = 0; d < spaceDim; d++) {
+          Scalar lastGradient = 0.0;
+          for (int nodeOrdinal = 0; nodeOrdinal < spaceDim; nodeOrdinal++) {
+            Scalar gradient = jacobianInverse[nodeOrdinal][d];
+            gradientsSquared += gradient * gradient;
+            lastGradient -= gradient;
+          }
+          gradientsSquared += lastGradient * lastGradient;
+        }
+        cellConductances(cellOrdinal) =
+            conductivity(cellOrdinal) * cellVolume * gradientsSquared;
+      },
+      "cell conductances");
+}
+
+template <int spaceDim>
+void LowRmPotentialSolve<spaceDim>::recordSolve(Scalar time) {
+  if (_numRecordedSolves > 0) {
+    Kokkos::deep_copy(_previousLhs, _lastLhs);
+    _previousSolveTime = _lastSolveTime;
+  }
+  Kokkos::deep_copy(_lastLhs, _lhs);
+  _lastSolveTime = time;
+  computeCellConductances(_lastCellConductances);
+  ++_numRecordedSolves;
+}
+
+template <int spaceDim>
+Scalar LowRmPotentialSolve<spaceDim>::relativeConductanceChange() {
+  if (_numRecordedSolves == 0) return std::numeric_limits<Scalar>::max();
+
+  computeCellConductances(_cellConductances);
+
+  auto   cellConductances = _cellConductances;
+  auto   lastCellConductances = _lastCellConductances;
+  int    numCells = _meshFields->femesh.nelems;
+  Scalar change = 0.0;
+  Kokkos::parallel_reduce(
+      "conductance change", numCells,
+      LAMBDA_EXPRESSION(int cellOrdinal, Scalar &localChange) {
+        localChange += fabs(
+            cellConductances(cellOrdinal) - lastCellConductances(cellOrdinal));
+      },
+      change);
+  Scalar total = 0.0;
+  Kokkos::parallel_reduce(
+      "last conductance", numCells,
+      LAMBDA_EXPRESSION(int cellOrdinal, Scalar &localTotal) {
+        localTotal += fabs(lastCellConductances(cellOrdinal));
+      },
+      total);
+
+  if (total == 0.0) return (change == 0.0) ? 0.0 : std::numeric_limits<Scalar>::max();
+  return change / total;
+}
+
+template <int spaceDim>
+void LowRmPotentialSolve<spaceDim>::extrapolateSolution(Scalar time) {
+  if (_numRecordedSolves < 2) return;
+  Scalar interval = _lastSolveTime - _previousSolveTime;
+  if (!(interval > 0.0)) return;
+  Scalar theta = std::min((time - _lastSolveTime) / interval, Scalar(1.0));
+
+  auto lhs = _lhs;
+  auto lastLhs = _lastLhs;
+  auto previousLhs = _previousLhs;
+  int  numSolves = lhs.extent(0);
+  int  numRows = lhs.extent(1);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<int>(0, numRows),
+      LAMBDA_EXPRESSION(int row) {
+        for (int solve = 0; solve < numSolves; solve++) {
+          lhs(solve, row) = lastLhs(solve, row) +
+                            theta * (lastLhs(solve, row) - previousLhs(solve, row));
+        }
+      },
+      "extrapolate potential");
 }
 
 template <int spaceDim>
@@ -113,6 +113,10 @@ class LowRmPotentialSolve {
   // ! Accumulate into the stiffness matrix and RHSes -- new version meant to eliminate nearly all temporary allocations on device
   void fusedAssemble();
 
+  // ! computes conductivity * volume * (sum of squared basis gradients) for each cell: a scalar measure of each cell's
+  // ! contribution to the stiffness matrix, which changes with both the conductivity and the cell geometry
+  void computeCellConductances(ScalarVector cellConductances);
+
  private:
   comm::Machine               _machine;
   Teuchos::RCP<DefaultFields> _meshFields;
@@ -133,6 +137,12 @@ class LowRmPotentialSolve {
   Scalar _K11 = 0.0;
   Scalar _totalJoulesAdded =
       0.0;  // cumulative over all calls to determineJouleHeating
+
+  // the last two recorded solves, for solve scheduling and extrapolation (reset by initialize())
+  ScalarMultiVector _lastLhs, _previousLhs;
+  ScalarVector      _cellConductances, _lastCellConductances;
+  Scalar            _lastSolveTime = 0.0, _previousSolveTime = 0.0;
+  int               _numRecordedSolves = 0;
  public:
   LowRmPotentialSolve(
       Teuchos::ParameterList const &paramList,
@@ -203,10 +213,21 @@ class LowRmPotentialSolve {
   // ! convenience function that returns a constant diagonal conductivity tensor with value on the diagonal = constantValue
   ConductivityType getConstantConductivity(Scalar constantValue);
 
-  // ! get a default solver for the problem.  Should be called after first call to assemble().  (After the first call, we should have some mechanism for letting the solver object know that the matrix/vector entries have changed, without recreating everything from scratch.  But as of this writing, 8/31/17, we don't have that yet.)
+  // ! get a default solver for the problem.  Should be called after first call to assemble().  After later calls to assemble(), call updateProblem() on the solver instead of creating a new one; a new solver is only needed after initialize() has rebuilt the matrix.
   Teuchos::RCP<CrsLinearSolver> getDefaultSolver(double tol, int maxIters);
 
   Scalar getTotalJoulesAdded();
+
+  // ! remember the current solution and cell conductances as those of a solve at the given time.
+  void recordSolve(Scalar time);
+
+  // ! the relative (L1) change in the cell conductances since the last recorded solve.  This is a proxy for how stale
+  // ! the solution is, not an estimate of its residual.  Returns the largest Scalar if no solve has been recorded.
+  Scalar relativeConductanceChange();
+
+  // ! replace the solution with a linear extrapolation in time from the last two recorded solves.  Extrapolates at most
+  // ! one solve interval past the last solve, and leaves the solution alone until two solves have been recorded.
+  void extrapolateSolution(Scalar time);
 };
 }  // namespace lgr
 
@@ -47,6 +47,8 @@
 #include "FieldDB.hpp"
 #include "PhysicalConstants.hpp"
 
+#include <Teuchos_TestForException.hpp>
+
 namespace lgr{
 
   template<int SpatialDim>
@@ -71,10 +73,17 @@ namespace lgr{
       : magneticFaceFlux(MagneticFaceFlux<Fields>())
       , elemFaceIDs(arg_mesh_fields.femesh.elem_face_ids)
       , elemFaceOrientations(arg_mesh_fields.femesh.elem_face_orientations)
-      , points_("quadrature points", 4, SpatialDim)
-      , weights_("quadrature weights", 4)
+      , points_(Cubature::getCachedCubature(SpatialDim, 2).points)
+      , weights_(Cubature::getCachedCubature(SpatialDim, 2).weights)
     {
-      Cubature::getCubature( SpatialDim, 2, points_, weights_);
+      // the element loops below are written for the four-point tet rule;
+      // the cached rule is sized by the cubature itself, so reject other
+      // rules here as the fixed-size views used to
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          points_.extent(0) != unsigned(numberGaussPoints()),
+          std::invalid_argument,
+          "MHD: quadrature rule has " << points_.extent(0)
+          << " points, expected " << numberGaussPoints());
     }
 
     KOKKOS_INLINE_FUNCTION constexpr int numberGaussPoints() const {return 4;}
@@ -1,7 +1,293 @@
 #include "MatrixIO.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Teuchos_TestForException.hpp"
+
 namespace lgr {
 
+namespace {
+
+typedef Kokkos::DefaultHostExecutionSpace  HostExecSpace;
+typedef Kokkos::RangePolicy<HostExecSpace> HostRangePolicy;
+
+char const binaryCrsMagic[8] = {'L', 'G', 'R', 'C', 'R', 'S', '0', '1'};
+
+// split text into a few tasks per host thread, but don't bother for small inputs
+int numberOfChunks(std::size_t bytes) {
+  std::size_t const minChunkBytes = std::size_t(1) << 16;
+  std::size_t const maxChunks = std::size_t(HostExecSpace().concurrency()) * 4;
+  return int(std::max(std::size_t(1), std::min(bytes / minChunkBytes + 1, maxChunks)));
+}
+
+std::string readWholeStream(std::istream& inStream) {
+  std::string text;
+  char        buffer[1 << 16];
+  while (inStream.read(buffer, sizeof(buffer)) || inStream.gcount() > 0) {
+    text.append(buffer, std::size_t(inStream.gcount()));
+  }
+  return text;
+}
+
+char const* skipLine(char const* p, char const* end) {
+  while (p < end && *p != '\n') p++;
+  return p < end ? p + 1 : end;
+}
+
+// first character of the next line that is neither blank nor a '%' comment
+char const* nextDataLine(char const* p, char const* end) {
+  while (p < end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+    if (p < end && *p != '\n' && *p != '%') return p;
+    p = skipLine(p, end);
+  }
+  return end;
+}
+
+// byte offsets splitting text[begin, end) into chunks that start on line boundaries
+std::vector<std::size_t> chunkBoundaries(std::string const& text, std::size_t begin) {
+  int const                numChunks = numberOfChunks(text.size() - begin);
+  std::vector<std::size_t> bounds(numChunks + 1);
+  char const*              base = text.c_str();
+  char const*              end = base + text.size();
+  for (int chunk = 0; chunk <= numChunks; chunk++) {
+    std::size_t offset = begin + (text.size() - begin) * chunk / numChunks;
+    if (offset > begin && offset < text.size() && text[offset - 1] != '\n') {
+      offset = skipLine(base + offset, end) - base;
+    }
+    bounds[chunk] = offset;
+  }
+  return bounds;
+}
+
+template <class Ordinal>
+struct Triplets {
+  std::vector<Ordinal> rows;
+  std::vector<Ordinal> cols;
+  std::vector<Scalar>  values;
+};
+
+// parses "row col value" lines with 1-based indices, starting at text[begin].
+// each chunk is counted, then parsed into its slot of the triplet arrays.
+template <class Ordinal>
+Triplets<Ordinal> parseTriplets(std::string const& text, std::size_t begin) {
+  auto const               bounds = chunkBoundaries(text, begin);
+  int const                numChunks = int(bounds.size()) - 1;
+  char const*              base = text.c_str();
+  std::vector<std::size_t> offsets(numChunks + 1, 0);
+  Kokkos::parallel_for(HostRangePolicy(0, numChunks), [&](int chunk) {
+    char const* end = base + bounds[chunk + 1];
+    std::size_t count = 0;
+    for (char const* p = nextDataLine(base + bounds[chunk], end); p < end;
+         p = nextDataLine(skipLine(p, end), end)) {
+      count++;
+    }
+    offsets[chunk + 1] = count;
+  });
+  for (int chunk = 0; chunk < numChunks; chunk++) {
+    offsets[chunk + 1] += offsets[chunk];
+  }
+
+  Triplets<Ordinal> triplets;
+  triplets.rows.resize(offsets[numChunks]);
+  triplets.cols.resize(offsets[numChunks]);
+  triplets.values.resize(offsets[numChunks]);
+  Kokkos::parallel_for(HostRangePolicy(0, numChunks), [&](int chunk) {
+    char const* end = base + bounds[chunk + 1];
+    std::size_t entry = offsets[chunk];
+    for (char const* p = nextDataLine(base + bounds[chunk], end); p < end;
+         p = nextDataLine(skipLine(p, end), end)) {
+      char* next;
+      // subtract 1 from row and col because MATLAB is 1-based and we're 0-based:
+      triplets.rows[entry] = Ordinal(std::strtoll(p, &next, 10) - 1);
+      triplets.cols[entry] = Ordinal(std::strtoll(next, &next, 10) - 1);
+      triplets.values[entry] = std::strtod(next, &next);
+      p = next;
+      entry++;
+    }
+  });
+  return triplets;
+}
+
+/*
+   Builds CSR from triplets with a counting sort by row.  Within each row,
+   entries are sorted by column; redundant entries keep the value that
+   appeared last in the input.
+   */
+template <class Ordinal, class SizeType>
+CrsMatrix<Ordinal, SizeType> assembleCrsMatrix(
+    Triplets<Ordinal> const& triplets, Ordinal rowCount) {
+  typedef Kokkos::View<SizeType*, Kokkos::HostSpace>    HostSizeTypeVector;
+  typedef Kokkos::View<std::size_t*, Kokkos::HostSpace> HostEntryVector;
+
+  std::size_t const numTriplets = triplets.rows.size();
+
+  std::size_t outOfRange = 0;
+  Kokkos::parallel_reduce(HostRangePolicy(0, numTriplets),
+      [&](std::size_t entry, std::size_t& count) {
+        Ordinal row = triplets.rows[entry];
+        if (row < 0 || row >= rowCount) count++;
+      },
+      outOfRange);
+  TEUCHOS_TEST_FOR_EXCEPTION(outOfRange > 0, std::invalid_argument,
+      outOfRange << " matrix entries have row indices outside of [1, "
+                 << rowCount << "]");
+
+  // rowStarts(row + 1) counts the entries of row, then is scanned in place
+  HostSizeTypeVector rowStarts("rowStarts", rowCount + 1);
+  Kokkos::parallel_for(HostRangePolicy(0, numTriplets), [&](std::size_t entry) {
+    Kokkos::atomic_increment(&rowStarts(triplets.rows[entry] + 1));
+  });
+  Kokkos::parallel_scan(HostRangePolicy(0, rowCount),
+      [&](Ordinal row, SizeType& partial, bool final) {
+        partial += rowStarts(row + 1);
+        if (final) rowStarts(row + 1) = partial;
+      });
+
+  HostSizeTypeVector cursor("cursor", rowCount);
+  Kokkos::deep_copy(
+      cursor, Kokkos::subview(rowStarts, std::make_pair(Ordinal(0), rowCount)));
+  HostEntryVector byRow("byRow", numTriplets);
+  Kokkos::parallel_for(HostRangePolicy(0, numTriplets), [&](std::size_t entry) {
+    SizeType slot =
+        Kokkos::atomic_fetch_add(&cursor(triplets.rows[entry]), SizeType(1));
+    byRow(slot) = entry;
+  });
+
+  // sort each row by column, keeping input order among redundant entries,
+  // and compact the row so that only the last of each column remains
+  HostSizeTypeVector rowCounts("rowCounts", rowCount);
+  std::size_t        numRedundant = 0;
+  Kokkos::parallel_reduce(HostRangePolicy(0, rowCount),
+      [&](Ordinal row, std::size_t& redundant) {
+        std::size_t* first = byRow.data() + rowStarts(row);
+        std::size_t* last = byRow.data() + rowStarts(row + 1);
+        std::sort(first, last, [&](std::size_t a, std::size_t b) {
+          return triplets.cols[a] < triplets.cols[b] ||
+                 (triplets.cols[a] == triplets.cols[b] && a < b);
+        });
+        std::size_t* kept = first;
+        for (std::size_t* p = first; p < last; p++) {
+          if (p + 1 < last && triplets.cols[*(p + 1)] == triplets.cols[*p]) {
+            continue;
+          }
+          *kept++ = *p;
+        }
+        rowCounts(row) = SizeType(kept - first);
+        redundant += std::size_t(last - kept);
+      },
+      numRedundant);
+  if (numRedundant > 0) {
+    std::cout << "Warning: " << numRedundant << " redundant matrix entries";
+    std::cout << ".  (will use the last value specified)\n";
+  }
+
+  typedef Kokkos::View<Ordinal*, MemSpace>  OrdinalVector;
+  typedef Kokkos::View<Scalar*, MemSpace>   ScalarVector;
+  typedef Kokkos::View<SizeType*, MemSpace> SizeTypeVector;
+
+  SizeTypeVector rowMap("rowMap", rowCount + 1);
+  typename SizeTypeVector::HostMirror rowMapHost =
+      Kokkos::create_mirror_view(rowMap);
+  rowMapHost(0) = 0;
+  Kokkos::parallel_scan(HostRangePolicy(0, rowCount),
+      [&](Ordinal row, SizeType& partial, bool final) {
+        partial += rowCounts(row);
+        if (final) rowMapHost(row + 1) = partial;
+      });
+
+  SizeType const nnz = rowMapHost(rowCount);
+  OrdinalVector  columnIndices("columnIndices", nnz);
+  ScalarVector   entries("entries", nnz);
+  typename OrdinalVector::HostMirror columnIndicesHost =
+      Kokkos::create_mirror_view(columnIndices);
+  typename ScalarVector::HostMirror entriesHost =
+      Kokkos::create_mirror_view(entries);
+  Kokkos::parallel_for(HostRangePolicy(0, rowCount), [&](Ordinal row) {
+    std::size_t const* kept = byRow.data() + rowStarts(row);
+    for (SizeType offset = rowMapHost(row); offset < rowMapHost(row + 1);
+         offset++) {
+      std::size_t entry = *kept++;
+      columnIndicesHost(offset) = triplets.cols[entry];
+      entriesHost(offset) = triplets.values[entry];
+    }
+  });
+
+  Kokkos::deep_copy(rowMap, rowMapHost);
+  Kokkos::deep_copy(columnIndices, columnIndicesHost);
+  Kokkos::deep_copy(entries, entriesHost);
+
+  return CrsMatrix<Ordinal, SizeType>(rowMap, columnIndices, entries);
+}
+
+// formats "row col value" lines with 1-based indices, one string per chunk of rows
+template <class Ordinal, class SizeType>
+void writeTriplets(std::ostream& out, CrsMatrix<Ordinal, SizeType> matrix) {
+  auto rowMapHost = Kokkos::create_mirror_view(matrix.rowMap());
+  auto columnIndicesHost = Kokkos::create_mirror_view(matrix.columnIndices());
+  auto entriesHost = Kokkos::create_mirror_view(matrix.entries());
+
+  Kokkos::deep_copy(rowMapHost, matrix.rowMap());
+  Kokkos::deep_copy(columnIndicesHost, matrix.columnIndices());
+  Kokkos::deep_copy(entriesHost, matrix.entries());
+
+  // roughly the width of one formatted line
+  std::size_t const lineBytes = 48;
+  SizeType const    rowCount = rowMapHost.size() > 0 ? rowMapHost.size() - 1 : 0;
+  int const numChunks = numberOfChunks(entriesHost.size() * lineBytes);
+  std::vector<std::string> text(numChunks);
+  Kokkos::parallel_for(HostRangePolicy(0, numChunks), [&](int chunk) {
+    SizeType const firstRow = SizeType(std::int64_t(rowCount) * chunk / numChunks);
+    SizeType const lastRow =
+        SizeType(std::int64_t(rowCount) * (chunk + 1) / numChunks);
+    text[chunk].reserve(
+        std::size_t(rowMapHost(lastRow) - rowMapHost(firstRow)) * lineBytes);
+    char line[96];
+    for (SizeType row = firstRow; row < lastRow; row++) {
+      for (SizeType entry = rowMapHost(row); entry < rowMapHost(row + 1);
+           entry++) {
+        // same as std::scientific with a precision of 17 (see TempSetScientific)
+        int length = std::snprintf(line, sizeof(line), "%lld %lld %.17e\n",
+            static_cast<long long>(row) + 1,
+            static_cast<long long>(columnIndicesHost(entry)) + 1,
+            entriesHost(entry));
+        text[chunk].append(line, std::size_t(length));
+      }
+    }
+  });
+  for (auto const& chunkText : text) {
+    out.write(chunkText.data(), std::streamsize(chunkText.size()));
+  }
+}
+
+template <class T>
+void writeRaw(std::ostream& out, T const& value) {
+  out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <class T>
+T readRaw(std::istream& inStream) {
+  T value;
+  inStream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+std::string lowercase(std::string word) {
+  std::transform(word.begin(), word.end(), word.begin(),
+      [](unsigned char c) { return char(std::tolower(c)); });
+  return word;
+}
+
+}  // anonymous namespace
+
+
 TempSetScientific::TempSetScientific(std::ostream& out)
     : out_(out), originalFlags_(out.flags()) {
   out << std::scientific;
@@ -26,93 +312,178 @@ readSparseMatlabMatrix(std::istream& inStream) {
      ...
      */
 
-  std::string line;
+  std::string const       text = readWholeStream(inStream);
+  Triplets<Ordinal> const triplets = parseTriplets<Ordinal>(text, 0);
+
+  Ordinal rowCount = 0;
+  if (!triplets.rows.empty()) {
+    rowCount = *std::max_element(triplets.rows.begin(), triplets.rows.end()) + 1;
+  }
+  return assembleCrsMatrix<Ordinal, SizeType>(triplets, rowCount);
+}
+
+template <class Ordinal, class SizeType>
+void
+MatrixIO<Ordinal, SizeType>::
+writeSparseMatlabMatrix(
+    std::ostream&                                          out,
+    CrsMatrix<Ordinal, SizeType> matrix) {
+  writeTriplets<Ordinal, SizeType>(out, matrix);
+}
 
-  // outer key: row #
-  // inner key: col #
-  // inner value: matrix entry
-  std::map<Ordinal, std::map<Ordinal, Scalar>> rowsToColumnValues;
+template <class Ordinal, class SizeType>
+CrsMatrix<Ordinal, SizeType>
+MatrixIO<Ordinal, SizeType>::
+readMatrixMarket(std::istream& inStream) {
+  /*
+     Expects a real (or integer) coordinate Matrix Market stream:
+     %%MatrixMarket matrix coordinate real general
+     % comments
+     rowCount colCount entryCount
+     row1 col1 value1
+     ...
+     Symmetric matrices store one triangle; the other is filled in here.
+     */
 
-  int nnz = 0;
+  std::string const text = readWholeStream(inStream);
+  char const*       base = text.c_str();
+  char const*       end = base + text.size();
 
-  while (std::getline(inStream, line)) {
-    std::istringstream iss(line);
-    Ordinal            row, col;
-    Scalar             value;
+  std::istringstream bannerStream(text.substr(0, text.find('\n')));
+  std::string        banner, object, format, field, symmetry;
+  bannerStream >> banner >> object >> format >> field >> symmetry;
+  object = lowercase(object);
+  format = lowercase(format);
+  field = lowercase(field);
+  symmetry = lowercase(symmetry);
+  TEUCHOS_TEST_FOR_EXCEPTION(banner != "%%MatrixMarket", std::invalid_argument,
+      "Matrix Market stream must begin with a %%MatrixMarket banner");
+  TEUCHOS_TEST_FOR_EXCEPTION(object != "matrix" || format != "coordinate",
+      std::invalid_argument, "only coordinate matrices are supported");
+  TEUCHOS_TEST_FOR_EXCEPTION(field != "real" && field != "integer",
+      std::invalid_argument, "only real and integer matrices are supported");
+  TEUCHOS_TEST_FOR_EXCEPTION(symmetry != "general" && symmetry != "symmetric",
+      std::invalid_argument, "only general and symmetric matrices are supported");
 
-    iss >> row;
-    iss >> col;
-    iss >> value;
+  char const* sizeLine = nextDataLine(skipLine(base, end), end);
+  TEUCHOS_TEST_FOR_EXCEPTION(sizeLine == end, std::invalid_argument,
+      "Matrix Market stream is missing its size line");
+  char*           next;
+  Ordinal const   rowCount = Ordinal(std::strtoll(sizeLine, &next, 10));
+  std::strtoll(next, &next, 10);  // column count; CrsMatrix does not store it
+  std::size_t const entryCount = std::size_t(std::strtoll(next, &next, 10));
 
-    // subtract 1 from row and col because MATLAB is 1-based and we're 0-based:
-    row--;
-    col--;
+  Triplets<Ordinal> triplets =
+      parseTriplets<Ordinal>(text, std::size_t(skipLine(sizeLine, end) - base));
+  TEUCHOS_TEST_FOR_EXCEPTION(triplets.rows.size() != entryCount,
+      std::invalid_argument,
+      "Matrix Market size line promises " << entryCount << " entries but "
+                                          << triplets.rows.size()
+                                          << " were found");
 
-    bool redundantEntry =
-        rowsToColumnValues[row].find(col) != rowsToColumnValues[row].end();
-    if (!redundantEntry) {
-      nnz++;
-    } else {
-      std::cout << "Warning: redundant entries for row " << row << ", col "
-                << col;
-      std::cout << ".  (will use the last value specified)\n";
+  if (symmetry == "symmetric") {
+    for (std::size_t entry = 0; entry < entryCount; entry++) {
+      if (triplets.rows[entry] == triplets.cols[entry]) continue;
+      triplets.rows.push_back(triplets.cols[entry]);
+      triplets.cols.push_back(triplets.rows[entry]);
+      triplets.values.push_back(triplets.values[entry]);
     }
-    rowsToColumnValues[row][col] = value;
   }
 
-  int rowCount = rowsToColumnValues.size();
+  return assembleCrsMatrix<Ordinal, SizeType>(triplets, rowCount);
+}
+
+template <class Ordinal, class SizeType>
+void
+MatrixIO<Ordinal, SizeType>::
+writeMatrixMarket(
+    std::ostream&                                          out,
+    CrsMatrix<Ordinal, SizeType> matrix) {
+  auto columnIndicesHost = Kokkos::create_mirror_view(matrix.columnIndices());
+  Kokkos::deep_copy(columnIndicesHost, matrix.columnIndices());
+
+  Ordinal colCount = 0;
+  for (std::size_t entry = 0; entry < columnIndicesHost.size(); entry++) {
+    colCount = std::max(colCount, Ordinal(columnIndicesHost(entry) + 1));
+  }
+  std::size_t const rowCount =
+      matrix.rowMap().size() > 0 ? matrix.rowMap().size() - 1 : 0;
+
+  out << "%%MatrixMarket matrix coordinate real general\n";
+  out << rowCount << " " << colCount << " " << columnIndicesHost.size() << "\n";
+  writeTriplets<Ordinal, SizeType>(out, matrix);
+}
+
+/*
+   Binary CSR layout (native byte order):
+     char[8]       magic "LGRCRS01"
+     std::uint32_t sizeof(Ordinal), sizeof(SizeType), sizeof(Scalar)
+     std::int64_t  rowCount, entryCount
+     std::int32_t  blockSizeRow, blockSizeCol
+     SizeType      rowMap[rowCount + 1]
+     Ordinal       columnIndices[entryCount]
+     Scalar        entries[entryCount]
+   */
+template <class Ordinal, class SizeType>
+CrsMatrix<Ordinal, SizeType>
+MatrixIO<Ordinal, SizeType>::
+readBinaryCrsMatrix(std::istream& inStream) {
+  char magic[sizeof(binaryCrsMagic)];
+  inStream.read(magic, sizeof(magic));
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !inStream || !std::equal(magic, magic + sizeof(magic), binaryCrsMagic),
+      std::invalid_argument, "stream does not hold a binary CrsMatrix");
+  auto const ordinalSize = readRaw<std::uint32_t>(inStream);
+  auto const sizeTypeSize = readRaw<std::uint32_t>(inStream);
+  auto const scalarSize = readRaw<std::uint32_t>(inStream);
+  TEUCHOS_TEST_FOR_EXCEPTION(ordinalSize != sizeof(Ordinal) ||
+                                 sizeTypeSize != sizeof(SizeType) ||
+                                 scalarSize != sizeof(Scalar),
+      std::invalid_argument,
+      "binary CrsMatrix was written with different Ordinal, SizeType, or "
+      "Scalar sizes");
+  auto const rowCount = readRaw<std::int64_t>(inStream);
+  auto const entryCount = readRaw<std::int64_t>(inStream);
+  auto const blockSizeRow = readRaw<std::int32_t>(inStream);
+  auto const blockSizeCol = readRaw<std::int32_t>(inStream);
+  TEUCHOS_TEST_FOR_EXCEPTION(!inStream || rowCount < 0 || entryCount < 0,
+      std::invalid_argument, "binary CrsMatrix header is truncated or corrupt");
 
   typedef Kokkos::View<Ordinal*, MemSpace>  OrdinalVector;
   typedef Kokkos::View<Scalar*, MemSpace>   ScalarVector;
   typedef Kokkos::View<SizeType*, MemSpace> SizeTypeVector;
 
-  SizeTypeVector rowMap(
-      "rowMap", rowCount + 1);  // entry offsets for each row
-  OrdinalVector columnIndices(
-      "columnIndices", nnz);             // column indices for each entry
-  ScalarVector entries("entries", nnz);  // matrix values
+  SizeTypeVector rowMap("rowMap", rowCount + 1);
+  OrdinalVector  columnIndices("columnIndices", entryCount);
+  ScalarVector   entries("entries", entryCount);
 
-  typename SizeTypeVector::HostMirror rowMapHost =
-      Kokkos::create_mirror_view(rowMap);
-  typename OrdinalVector::HostMirror columnIndicesHost =
-      Kokkos::create_mirror_view(columnIndices);
-  typename ScalarVector::HostMirror entriesHost =
-      Kokkos::create_mirror_view(entries);
+  auto rowMapHost = Kokkos::create_mirror_view(rowMap);
+  auto columnIndicesHost = Kokkos::create_mirror_view(columnIndices);
+  auto entriesHost = Kokkos::create_mirror_view(entries);
 
-  int entryOffset = 0;
-  rowMapHost(0) = 0;
-  for (int row = 0; row < rowCount; row++) {
-    int numColsForRow = rowsToColumnValues[row].size();
-    rowMapHost(row + 1) = rowMapHost(row) + numColsForRow;
-    for (auto entry : rowsToColumnValues[row]) {
-      Ordinal columnIndex = entry.first;
-      Scalar  value = entry.second;
-      columnIndicesHost(entryOffset) = columnIndex;
-      entriesHost(entryOffset) = value;
-      entryOffset++;
-    }
-  }
+  inStream.read(reinterpret_cast<char*>(rowMapHost.data()),
+      std::streamsize(sizeof(SizeType) * rowMapHost.size()));
+  inStream.read(reinterpret_cast<char*>(columnIndicesHost.data()),
+      std::streamsize(sizeof(Ordinal) * columnIndicesHost.size()));
+  inStream.read(reinterpret_cast<char*>(entriesHost.data()),
+      std::streamsize(sizeof(Scalar) * entriesHost.size()));
+  TEUCHOS_TEST_FOR_EXCEPTION(!inStream, std::invalid_argument,
+      "binary CrsMatrix data is truncated");
 
   Kokkos::deep_copy(rowMap, rowMapHost);
   Kokkos::deep_copy(columnIndices, columnIndicesHost);
   Kokkos::deep_copy(entries, entriesHost);
 
-  return CrsMatrix<Ordinal, SizeType>(rowMap, columnIndices, entries);
+  return CrsMatrix<Ordinal, SizeType>(
+      rowMap, columnIndices, entries, blockSizeCol, blockSizeRow);
 }
 
 template <class Ordinal, class SizeType>
 void
 MatrixIO<Ordinal, SizeType>::
-writeSparseMatlabMatrix(
+writeBinaryCrsMatrix(
     std::ostream&                                          out,
     CrsMatrix<Ordinal, SizeType> matrix) {
-  // Make the output stream write floating-point numbers in
-  // scientific notation.  It will politely put the output
-  // stream back to its state on input, when this scope
-  // terminates.
-  //      Teuchos::MatrixMarket::details::SetScientific<Scalar> sci(out);
-  TempSetScientific sci(out);
-
   auto rowMapHost = Kokkos::create_mirror_view(matrix.rowMap());
   auto columnIndicesHost = Kokkos::create_mirror_view(matrix.columnIndices());
   auto entriesHost = Kokkos::create_mirror_view(matrix.entries());
@@ -121,17 +492,28 @@ writeSparseMatlabMatrix(
   Kokkos::deep_copy(columnIndicesHost, matrix.columnIndices());
   Kokkos::deep_copy(entriesHost, matrix.entries());
 
-  SizeType rowCount = rowMapHost.size() - 1;
-  int      entry = 0;
-  for (SizeType row = 0; row < rowCount; row++) {
-    int colsForRow = rowMapHost(row + 1) - rowMapHost(row);
-    for (int colOrdinal = 0; colOrdinal < colsForRow; colOrdinal++) {
-      int    col = columnIndicesHost(entry);
-      Scalar value = entriesHost(entry);
-      out << row + 1 << " " << col + 1 << " " << value << "\n";
-      entry++;
-    }
+  std::int64_t const rowCount =
+      rowMapHost.size() > 0 ? std::int64_t(rowMapHost.size()) - 1 : 0;
+  SizeType const emptyRowMap = 0;
+
+  out.write(binaryCrsMagic, sizeof(binaryCrsMagic));
+  writeRaw(out, std::uint32_t(sizeof(Ordinal)));
+  writeRaw(out, std::uint32_t(sizeof(SizeType)));
+  writeRaw(out, std::uint32_t(sizeof(Scalar)));
+  writeRaw(out, rowCount);
+  writeRaw(out, std::int64_t(entriesHost.size()));
+  writeRaw(out, std::int32_t(matrix.blockSizeRow()));
+  writeRaw(out, std::int32_t(matrix.blockSizeCol()));
+  if (rowMapHost.size() > 0) {
+    out.write(reinterpret_cast<char const*>(rowMapHost.data()),
+        std::streamsize(sizeof(SizeType) * rowMapHost.size()));
+  } else {
+    writeRaw(out, emptyRowMap);
   }
+  out.write(reinterpret_cast<char const*>(columnIndicesHost.data()),
+      std::streamsize(sizeof(Ordinal) * columnIndicesHost.size()));
+  out.write(reinterpret_cast<char const*>(entriesHost.data()),
+      std::streamsize(sizeof(Scalar) * entriesHost.size()));
 }
 
 template <class Ordinal, class SizeType>
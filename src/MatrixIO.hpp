@@ -19,9 +19,14 @@
 
 namespace lgr {
 /*
-   The MatrixIO utilities are primarily intended for debugging.  (We are not too concerned with performance here; we are also not too concerned with robust error handling when e.g. the input stream is not as we expect it to be.)
+   The MatrixIO utilities are intended for debugging and for dumping matrices for offline solver tuning.
    
-   Right now, there is not support for MPI-distributed matrices, and all work is done in a single thread.
+   Text formats (MATLAB triplets and Matrix Market coordinate) are parsed and formatted in parallel on the
+   host execution space, and CSR is assembled with a counting sort by row.  The binary format is a fixed
+   header followed by the raw rowMap, columnIndices, and entries arrays, so it is read and written directly
+   from/to the CrsMatrix views; it is only portable between builds with the same type sizes and byte order.
+   
+   Right now, there is not support for MPI-distributed matrices.
    
    */
 
@@ -55,6 +60,20 @@ class MatrixIO {
       std::ostream&                                          out,
       CrsMatrix<Ordinal, SizeType> matrix);
 
+  static CrsMatrix<Ordinal, SizeType>
+  readMatrixMarket(std::istream& inStream);
+
+  static void writeMatrixMarket(
+      std::ostream&                                          out,
+      CrsMatrix<Ordinal, SizeType> matrix);
+
+  static CrsMatrix<Ordinal, SizeType>
+  readBinaryCrsMatrix(std::istream& inStream);
+
+  static void writeBinaryCrsMatrix(
+      std::ostream&                                          out,
+      CrsMatrix<Ordinal, SizeType> matrix);
+
   static void writeDenseMatlabVector(
       std::ostream& out, Kokkos::View<Scalar*, Layout, MemSpace> vectorView);
 };
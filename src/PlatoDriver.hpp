@@ -22,6 +22,7 @@
 
 #include "plato/PlatoUtilities.hpp"
 #include "plato/PlatoProblemFactory.hpp"
+#include "plato/FrequencySweepOutput.hpp"
 //#include "plato/StructuralDynamicsOutput.hpp"
 
 namespace Plato
@@ -31,7 +32,8 @@ template<const Plato::OrdinalType SpatialDim>
 void output(Teuchos::ParameterList & aParamList,
             const std::string & aOutputFilePath,
             const Plato::ScalarMultiVector & aState,
-            Omega_h::Mesh& aMesh)
+            Omega_h::Mesh& aMesh,
+            Omega_h::MeshSets& aMeshSets)
 {
     auto tProblemSpecs = aParamList.sublist("Plato Problem");
     assert(tProblemSpecs.isParameter("Physics"));
@@ -58,6 +60,25 @@ void output(Teuchos::ParameterList & aParamList,
     }
     if(tPhysics == "StructuralDynamics")
     {
+        // the whole sweep goes to one container: the mesh once, then the complex displacement per frequency
+        if(tProblemSpecs.isSublist("Frequency Sweep Output") && tProblemSpecs.isSublist("Frequency Steps"))
+        {
+            auto tSweepParams = tProblemSpecs.sublist("Frequency Sweep Output");
+            auto tFileName = aOutputFilePath + "/" + tSweepParams.get<std::string>("File Name", "frequency_sweep.bin");
+            auto tSinglePrecision = tSweepParams.get<bool>("Single Precision", false);
+            auto tFrequencies = tProblemSpecs.sublist("Frequency Steps").get<Teuchos::Array<Plato::Scalar>>("Values");
+            std::shared_ptr<Plato::FrequencySweepWriter<SpatialDim>> tWriter;
+            if(tSweepParams.isParameter("Node Set"))
+            {
+                auto tNodeSetName = tSweepParams.get<std::string>("Node Set");
+                tWriter = std::make_shared<Plato::FrequencySweepWriter<SpatialDim>>(aMesh, aMeshSets, tNodeSetName, tFileName, tSinglePrecision);
+            }
+            else
+            {
+                tWriter = std::make_shared<Plato::FrequencySweepWriter<SpatialDim>>(aMesh, tFileName, tSinglePrecision);
+            }
+            tWriter->append(tFrequencies, aState);
+        }
         /*assert(tPlatoProblemSpec.isSublist("Frequency Steps"));
         auto tFreqParams = tPlatoProblemSpec.sublist("Frequency Steps");
         auto tFrequencies = tFreqParams.get<Teuchos::Array<Plato::Scalar>>("Values");
@@ -100,7 +121,7 @@ void run(Teuchos::ParameterList& aProblemSpec,
     std::shared_ptr<::Plato::AbstractProblem> tPlatoProblem = tProblemFactory.create(aMesh, aMeshSets, aProblemSpec);
     auto tSolution = tPlatoProblem->solution(tControl);
 
-    Plato::output<SpatialDim>(aProblemSpec, aVizFilePath, tSolution, aMesh);
+    Plato::output<SpatialDim>(aProblemSpec, aVizFilePath, tSolution, aMesh, aMeshSets);
 }
 
 template<const Plato::OrdinalType SpatialDim>
@@ -1,6 +1,8 @@
 #ifndef PLATO_PROBLEM_HPP
 #define PLATO_PROBLEM_HPP
 
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <sstream>
 
@@ -463,6 +465,77 @@ public:
         return mConstraint->gradient_x(tStatesSubView, aControl);
     }
 
+    /******************************************************************************/
+    Plato::ScalarVector objectiveHessianTimesVector(const Plato::ScalarVector & aControl,
+                                                    const Plato::ScalarMultiVector & aState,
+                                                    const Plato::ScalarVector & aDirection)
+    /******************************************************************************/
+    {
+        assert(aState.extent(0) == mStates.extent(0));
+        assert(aState.extent(1) == mStates.extent(1));
+
+        if(mObjective == nullptr)
+        {
+            std::ostringstream tErrorMessage;
+            tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                    << ", LINE: " << __LINE__
+                    << ", MESSAGE: OBJECTIVE HESSIAN REQUESTED BUT OBJECTIVE PTR WAS NOT DEFINED BY THE USER."
+                    << " USER SHOULD MAKE SURE THAT OBJECTIVE FUNCTION IS DEFINED IN INPUT FILE. **************\n\n";
+            throw std::runtime_error(tErrorMessage.str().c_str());
+        }
+
+        const Plato::OrdinalType tTIME_STEP_INDEX = 0;
+        Plato::ScalarVector tStatesSubView = Kokkos::subview(aState, tTIME_STEP_INDEX, Kokkos::ALL());
+        return this->criterionHessianTimesVector(*mObjective, mIsSelfAdjoint, tStatesSubView, aControl, aDirection);
+    }
+
+    /******************************************************************************/
+    Plato::ScalarVector constraintHessianTimesVector(const Plato::ScalarVector & aControl,
+                                                     const Plato::ScalarMultiVector & aState,
+                                                     const Plato::ScalarVector & aDirection)
+    /******************************************************************************/
+    {
+        assert(aState.extent(0) == mStates.extent(0));
+        assert(aState.extent(1) == mStates.extent(1));
+
+        if(mConstraint == nullptr)
+        {
+            std::ostringstream tErrorMessage;
+            tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                    << ", LINE: " << __LINE__
+                    << ", MESSAGE: CONSTRAINT HESSIAN REQUESTED BUT CONSTRAINT PTR WAS NOT DEFINED BY THE USER."
+                    << " USER SHOULD MAKE SURE THAT CONSTRAINT FUNCTION IS DEFINED IN INPUT FILE. **************\n\n";
+            throw std::runtime_error(tErrorMessage.str().c_str());
+        }
+
+        const Plato::OrdinalType tTIME_STEP_INDEX = 0;
+        Plato::ScalarVector tStatesSubView = Kokkos::subview(aState, tTIME_STEP_INDEX, Kokkos::ALL());
+
+        // a constraint that depends on the state gets the full second-order adjoint treatment
+        auto tPartialConstraintWRT_State = mConstraint->gradient_u(tStatesSubView, aControl);
+        if(Plato::norm_inf(tPartialConstraintWRT_State) > static_cast<Plato::Scalar>(0))
+        {
+            const bool tIsSelfAdjoint = false;
+            return this->criterionHessianTimesVector(*mConstraint, tIsSelfAdjoint, tStatesSubView, aControl, aDirection);
+        }
+
+        // otherwise only its control-control block contributes
+        auto tStep = this->directionStep(aControl, aDirection);
+        auto tNumControls = aControl.size();
+        Plato::ScalarVector tControlPlus("Control Plus", tNumControls);
+        Plato::ScalarVector tControlMinus("Control Minus", tNumControls);
+        Plato::update(static_cast<Plato::Scalar>(1), aControl, static_cast<Plato::Scalar>(0), tControlPlus);
+        Plato::axpy(tStep, aDirection, tControlPlus);
+        Plato::update(static_cast<Plato::Scalar>(1), aControl, static_cast<Plato::Scalar>(0), tControlMinus);
+        Plato::axpy(-tStep, aDirection, tControlMinus);
+
+        auto tOutput = mConstraint->gradient_z(tStatesSubView, tControlPlus);
+        auto tGradientMinus = mConstraint->gradient_z(tStatesSubView, tControlMinus);
+        Plato::update(static_cast<Plato::Scalar>(-1) / (2 * tStep), tGradientMinus,
+                      static_cast<Plato::Scalar>(1) / (2 * tStep), tOutput);
+        return tOutput;
+    }
+
 private:
     /******************************************************************************/
     void initialize(Omega_h::Mesh& aMesh, Omega_h::MeshSets& aMeshSets, Teuchos::ParameterList& aParamList)
@@ -496,6 +569,169 @@ private:
             tNaturalBoundaryConditions(aParamList.sublist("Natural Boundary Conditions", false));
         tNaturalBoundaryConditions.get(&aMesh, aMeshSets, mBoundaryLoads);
     }
+
+    /******************************************************************************/
+    Plato::ScalarVector criterionHessianTimesVector(const ScalarFunction<SimplexPhysics> & aCriterion,
+                                                    bool aIsSelfAdjoint,
+                                                    const Plato::ScalarVector & aState,
+                                                    const Plato::ScalarVector & aControl,
+                                                    const Plato::ScalarVector & aDirection)
+    /******************************************************************************/
+    {
+        // The reduced Hessian of f(z) = F(u(z),z) with R(u(z),z) = 0 applied to v is
+        //   H v = L_zu du + L_zz v + (dR/dz)^T dlambda,
+        // where L = F + lambda^T R, K du = -(dR/dz) v and K^T dlambda = -(L_uu du + L_uz v).
+        auto tNumDofs = mEqualityConstraint.size();
+
+        // adjoint at the current state
+        Plato::ScalarVector tAdjoint("Hessian Adjoint", tNumDofs);
+        if(aIsSelfAdjoint)
+        {
+            Plato::update(static_cast<Plato::Scalar>(-1), aState, static_cast<Plato::Scalar>(0), tAdjoint);
+        }
+        else
+        {
+            auto tPartialCriterionWRT_State = aCriterion.gradient_u(aState, aControl);
+            Plato::scale(static_cast<Plato::Scalar>(-1), tPartialCriterionWRT_State);
+            this->solveHomogeneous(aState, aControl, tAdjoint, tPartialCriterionWRT_State);
+        }
+
+        // incremental state: K du = -(dR/dz) v
+        auto tStateRhs = mEqualityConstraint.gradient_z_times(aState, aControl, aDirection);
+        Plato::scale(static_cast<Plato::Scalar>(-1), tStateRhs);
+        Plato::ScalarVector tStateDirection("Incremental State", tNumDofs);
+        this->solveHomogeneous(aState, aControl, tStateDirection, tStateRhs);
+
+        // second-order terms, directional derivatives of the Lagrangian gradients
+        Plato::ScalarVector tLagrangianGradientU_Direction("Lagrangian Gradient U Direction", tNumDofs);
+        Plato::ScalarVector tLagrangianGradientZ_Direction("Lagrangian Gradient Z Direction", aControl.size());
+        this->lagrangianGradientsDirection(aCriterion, aState, aControl, tAdjoint, tStateDirection, aDirection,
+                                           tLagrangianGradientU_Direction, tLagrangianGradientZ_Direction);
+
+        // incremental adjoint: K^T dlambda = -(L_uu du + L_uz v)
+        Plato::ScalarVector tAdjointDirection("Incremental Adjoint", tNumDofs);
+        if(aIsSelfAdjoint)
+        {
+            Plato::update(static_cast<Plato::Scalar>(-1), tStateDirection, static_cast<Plato::Scalar>(0), tAdjointDirection);
+        }
+        else
+        {
+            Plato::scale(static_cast<Plato::Scalar>(-1), tLagrangianGradientU_Direction);
+            this->solveHomogeneous(aState, aControl, tAdjointDirection, tLagrangianGradientU_Direction);
+        }
+
+        // H v = L_zu du + L_zz v + (dR/dz)^T dlambda
+        auto tPartialPDE_WRT_Control = mEqualityConstraint.gradient_z(aState, aControl);
+        Plato::MatrixTimesVectorPlusVector(tPartialPDE_WRT_Control, tAdjointDirection, tLagrangianGradientZ_Direction);
+        return tLagrangianGradientZ_Direction;
+    }
+
+    /******************************************************************************/
+    void solveHomogeneous(const Plato::ScalarVector & aState,
+                          const Plato::ScalarVector & aControl,
+                          const Plato::ScalarVector & aSolution,
+                          const Plato::ScalarVector & aRhs)
+    /******************************************************************************/
+    {
+        // incremental and adjoint solves see zero essential boundary values
+        Plato::ScalarVector tZeroBcValues("Zero Essential Values", mBcValues.size());
+        auto tJacobian = mEqualityConstraint.gradient_u(aState, aControl);
+        if(tJacobian->isBlockMatrix())
+        {
+            Plato::applyBlockConstraints<SpatialDim>(tJacobian, aRhs, mBcDofs, tZeroBcValues);
+        }
+        else
+        {
+            Plato::applyConstraints<SpatialDim>(tJacobian, aRhs, mBcDofs, tZeroBcValues);
+        }
+
+        // the constrained system is assumed symmetric, as in the adjoint solves above
+#ifdef HAVE_AMGX
+        using AmgXLinearProblem = lgr::AmgXSparseLinearProblem< Plato::OrdinalType, SimplexPhysics::m_numDofsPerNode>;
+        auto tConfigString = AmgXLinearProblem::getConfigString();
+        auto tSolver = Teuchos::rcp(new AmgXLinearProblem(*tJacobian, aSolution, aRhs, tConfigString));
+        tSolver->solve();
+        tSolver = Teuchos::null;
+#endif
+    }
+
+    /******************************************************************************/
+    Plato::Scalar directionStep(const Plato::ScalarVector & aControl, const Plato::ScalarVector & aDirection)
+    /******************************************************************************/
+    {
+        // cube root of machine epsilon balances truncation and round-off
+        // errors of the central differences
+        const Plato::Scalar tRelativeStep = std::cbrt(std::numeric_limits<Plato::Scalar>::epsilon());
+        auto tDirectionNorm = Plato::norm_inf(aDirection);
+        if(tDirectionNorm == static_cast<Plato::Scalar>(0))
+        {
+            return static_cast<Plato::Scalar>(1);
+        }
+        return tRelativeStep * (static_cast<Plato::Scalar>(1) + Plato::norm_inf(aControl)) / tDirectionNorm;
+    }
+
+    /******************************************************************************/
+    void lagrangianGradients(const ScalarFunction<SimplexPhysics> & aCriterion,
+                             const Plato::ScalarVector & aState,
+                             const Plato::ScalarVector & aControl,
+                             const Plato::ScalarVector & aAdjoint,
+                             Plato::ScalarVector & aGradientU,
+                             Plato::ScalarVector & aGradientZ)
+    /******************************************************************************/
+    {
+        // L_u = F_u + K^T lambda, with K symmetric
+        aGradientU = aCriterion.gradient_u(aState, aControl);
+        auto tPartialPDE_WRT_State = mEqualityConstraint.gradient_u(aState, aControl);
+        Plato::MatrixTimesVectorPlusVector(tPartialPDE_WRT_State, aAdjoint, aGradientU);
+
+        // L_z = F_z + (dR/dz)^T lambda
+        aGradientZ = aCriterion.gradient_z(aState, aControl);
+        auto tPartialPDE_WRT_Control = mEqualityConstraint.gradient_z(aState, aControl);
+        Plato::MatrixTimesVectorPlusVector(tPartialPDE_WRT_Control, aAdjoint, aGradientZ);
+    }
+
+    /******************************************************************************/
+    void lagrangianGradientsDirection(const ScalarFunction<SimplexPhysics> & aCriterion,
+                                      const Plato::ScalarVector & aState,
+                                      const Plato::ScalarVector & aControl,
+                                      const Plato::ScalarVector & aAdjoint,
+                                      const Plato::ScalarVector & aStateDirection,
+                                      const Plato::ScalarVector & aControlDirection,
+                                      const Plato::ScalarVector & aGradientU_Direction,
+                                      const Plato::ScalarVector & aGradientZ_Direction)
+    /******************************************************************************/
+    {
+        // The element kernels only carry first derivatives, so the forward
+        // derivative of the AD gradients along (du, v) is a central difference.
+        auto tStep = this->directionStep(aControl, aControlDirection);
+        auto tNumDofs = aState.size();
+        auto tNumControls = aControl.size();
+
+        Plato::ScalarVector tStatePlus("State Plus", tNumDofs);
+        Plato::ScalarVector tStateMinus("State Minus", tNumDofs);
+        Plato::update(static_cast<Plato::Scalar>(1), aState, static_cast<Plato::Scalar>(0), tStatePlus);
+        Plato::axpy(tStep, aStateDirection, tStatePlus);
+        Plato::update(static_cast<Plato::Scalar>(1), aState, static_cast<Plato::Scalar>(0), tStateMinus);
+        Plato::axpy(-tStep, aStateDirection, tStateMinus);
+
+        Plato::ScalarVector tControlPlus("Control Plus", tNumControls);
+        Plato::ScalarVector tControlMinus("Control Minus", tNumControls);
+        Plato::update(static_cast<Plato::Scalar>(1), aControl, static_cast<Plato::Scalar>(0), tControlPlus);
+        Plato::axpy(tStep, aControlDirection, tControlPlus);
+        Plato::update(static_cast<Plato::Scalar>(1), aControl, static_cast<Plato::Scalar>(0), tControlMinus);
+        Plato::axpy(-tStep, aControlDirection, tControlMinus);
+
+        Plato::ScalarVector tGradientU_Plus, tGradientZ_Plus;
+        this->lagrangianGradients(aCriterion, tStatePlus, tControlPlus, aAdjoint, tGradientU_Plus, tGradientZ_Plus);
+        Plato::ScalarVector tGradientU_Minus, tGradientZ_Minus;
+        this->lagrangianGradients(aCriterion, tStateMinus, tControlMinus, aAdjoint, tGradientU_Minus, tGradientZ_Minus);
+
+        const Plato::Scalar tScale = static_cast<Plato::Scalar>(1) / (2 * tStep);
+        Plato::update(tScale, tGradientU_Plus, static_cast<Plato::Scalar>(0), aGradientU_Direction);
+        Plato::axpy(-tScale, tGradientU_Minus, aGradientU_Direction);
+        Plato::update(tScale, tGradientZ_Plus, static_cast<Plato::Scalar>(0), aGradientZ_Direction);
+        Plato::axpy(-tScale, tGradientZ_Minus, aGradientZ_Direction);
+    }
 };
 
 #endif // PLATO_PROBLEM_HPP
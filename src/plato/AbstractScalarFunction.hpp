@@ -47,6 +47,16 @@ public:
     {
     }
 
+    /******************************************************************************//**
+     * @brief Cells whose result may be nonzero; an empty list means every cell.
+     *        Sparse criteria override this so that ScalarFunction only assembles
+     *        the gradient from those cells.
+    **********************************************************************************/
+    virtual Plato::LocalOrdinalVector getActiveCells() const
+    {
+        return Plato::LocalOrdinalVector();
+    }
+
     const decltype(m_functionName)& getName()
     {
         return m_functionName;
@@ -0,0 +1,492 @@
+/*
+ * FrequencySweepOutput.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef FREQUENCYSWEEPOUTPUT_HPP_
+#define FREQUENCYSWEEPOUTPUT_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+
+#include <Omega_h_mesh.hpp>
+#include <Omega_h_array.hpp>
+#include <Omega_h_assoc.hpp>
+
+#include "plato/PlatoStaticsTypes.hpp"
+#include "plato/SimplexStructuralDynamics.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * Frequency sweep container. The nodes, their coordinates and the elements
+ * connecting them are written once, followed by one fixed size record per
+ * frequency:
+ *
+ *   char[8]       magic "PLATOFRS"
+ *   std::int32_t  version, spatial dimension, values per node, bytes per value,
+ *                 vertices per element
+ *   std::int64_t  number of nodes, number of elements, number of frequencies
+ *   std::int64_t  mesh vertex ordinal of each node
+ *   double        coordinates, spatial dimension per node
+ *   std::int64_t  vertices of each element, given as positions of the nodes in
+ *                 the container
+ *   records:      double frequency, then float or double values per node
+ *                 ordered as (real displacements, imaginary displacements)
+ *
+ * The elements are the mesh cells whose vertices were all written. If there are
+ * none, e.g. for a surface node set, the highest dimensional entities whose
+ * vertices were all written are used instead, so the output can be viewed
+ * without the original mesh. The number of frequencies is updated after every
+ * record, so an interrupted sweep can still be read.
+**********************************************************************************/
+struct FrequencySweepFormat
+{
+    static constexpr char const* mMagic = "PLATOFRS";
+    static constexpr Plato::OrdinalType mMagicSize = 8;
+    static constexpr std::int32_t mVersion = 2;
+    /*!< byte offset of the number of frequencies in the header */
+    static constexpr std::streamoff mNumFrequenciesOffset = mMagicSize + 5 * sizeof(std::int32_t) + 2 * sizeof(std::int64_t);
+    static constexpr std::streamoff mHeaderSize = mNumFrequenciesOffset + sizeof(std::int64_t);
+};
+
+/******************************************************************************/
+inline void throw_frequency_sweep_error(const std::string & aFunction, Plato::OrdinalType aLine, const std::string & aMessage)
+/******************************************************************************/
+{
+    std::ostringstream tErrorMessage;
+    tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << aFunction << ", LINE: "
+            << aLine << ", MESSAGE: " << aMessage << " **************\n\n";
+    throw std::runtime_error(tErrorMessage.str().c_str());
+}
+
+/******************************************************************************//**
+ * Appends the complex displacement of every frequency of a sweep to a single
+ * binary container, optionally restricted to a node set and stored in single
+ * precision, instead of writing one visualization step per frequency.
+**********************************************************************************/
+template<Plato::OrdinalType SpaceDim, Plato::OrdinalType NumControls = 1>
+class FrequencySweepWriter: public Plato::SimplexStructuralDynamics<SpaceDim, NumControls>
+{
+private:
+    static constexpr Plato::OrdinalType mNumDofsPerNode = Plato::SimplexStructuralDynamics<SpaceDim>::m_numDofsPerNode;
+
+    std::ofstream mFile;
+    Omega_h::LOs mNodes; /*!< mesh vertex ordinal of each output node */
+    bool mSinglePrecision;
+    std::int64_t mNumFrequencies;
+
+    Plato::ScalarVector mValues; /*!< device buffer for one frequency */
+
+public:
+    /******************************************************************************//**
+     * @brief Write the whole mesh at every frequency
+    **********************************************************************************/
+    FrequencySweepWriter(Omega_h::Mesh& aMesh, const std::string & aFileName, bool aSinglePrecision = false) :
+            FrequencySweepWriter(aMesh, aFileName, Omega_h::LOs(aMesh.nverts(), 0, 1), aSinglePrecision)
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Write only the nodes of the named node set at every frequency
+    **********************************************************************************/
+    FrequencySweepWriter(Omega_h::Mesh& aMesh,
+                         Omega_h::MeshSets& aMeshSets,
+                         const std::string & aNodeSetName,
+                         const std::string & aFileName,
+                         bool aSinglePrecision = false) :
+            FrequencySweepWriter(aMesh, aFileName, FrequencySweepWriter::getNodeSet(aMeshSets, aNodeSetName), aSinglePrecision)
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Write the given mesh vertices at every frequency
+    **********************************************************************************/
+    FrequencySweepWriter(Omega_h::Mesh& aMesh, const std::string & aFileName, Omega_h::LOs aNodes, bool aSinglePrecision) :
+            mFile(aFileName, std::ios::binary | std::ios::trunc),
+            mNodes(aNodes),
+            mSinglePrecision(aSinglePrecision),
+            mNumFrequencies(0),
+            mValues("FrequencySweepValues", aNodes.size() * mNumDofsPerNode)
+    {
+        if(mFile.is_open() == false)
+        {
+            Plato::throw_frequency_sweep_error(__PRETTY_FUNCTION__, __LINE__, "COULD NOT OPEN FILE " + aFileName + ".");
+        }
+        this->writeHeader(aMesh);
+    }
+
+    ~FrequencySweepWriter()
+    {
+    }
+
+    std::int64_t getNumFrequencies() const
+    {
+        return mNumFrequencies;
+    }
+
+    /******************************************************************************//**
+     * @brief Append the state of one frequency
+     * @param [in] aFrequency frequency of the state
+     * @param [in] aState complex state, (real, imaginary) displacements per mesh vertex
+    **********************************************************************************/
+    void append(const Plato::Scalar & aFrequency, const Plato::ScalarVector & aState)
+    {
+        auto tNodes = mNodes;
+        auto tValues = mValues;
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tNodes.size()), LAMBDA_EXPRESSION(const Plato::OrdinalType & aNodeOrdinal)
+        {
+            const Plato::OrdinalType tVertex = tNodes[aNodeOrdinal];
+            for(Plato::OrdinalType tDof = 0; tDof < mNumDofsPerNode; tDof++)
+            {
+                tValues(aNodeOrdinal * mNumDofsPerNode + tDof) = aState(tVertex * mNumDofsPerNode + tDof);
+            }
+        }, "FrequencySweepWriter::append");
+
+        auto tHostValues = Kokkos::create_mirror_view(mValues);
+        Kokkos::deep_copy(tHostValues, mValues);
+
+        const double tFrequency = aFrequency;
+        mFile.write(reinterpret_cast<const char*>(&tFrequency), sizeof(double));
+        if(mSinglePrecision)
+        {
+            std::vector<float> tSingle(tHostValues.data(), tHostValues.data() + tHostValues.size());
+            mFile.write(reinterpret_cast<const char*>(tSingle.data()), tSingle.size() * sizeof(float));
+        }
+        else
+        {
+            mFile.write(reinterpret_cast<const char*>(tHostValues.data()), tHostValues.size() * sizeof(double));
+        }
+
+        mNumFrequencies++;
+        const std::streampos tEnd = mFile.tellp();
+        mFile.seekp(Plato::FrequencySweepFormat::mNumFrequenciesOffset);
+        mFile.write(reinterpret_cast<const char*>(&mNumFrequencies), sizeof(std::int64_t));
+        mFile.seekp(tEnd);
+        mFile.flush();
+    }
+
+    /******************************************************************************//**
+     * @brief Append every frequency of a sweep
+     * @param [in] aFreqArray frequencies
+     * @param [in] aState states, one row per frequency
+    **********************************************************************************/
+    template<typename ArrayT>
+    void append(const ArrayT& aFreqArray, const Plato::ScalarMultiVector& aState)
+    {
+        const Plato::OrdinalType tNumFrequencies = aFreqArray.size();
+        for(Plato::OrdinalType tIndex = 0; tIndex < tNumFrequencies; tIndex++)
+        {
+            Plato::ScalarVector tMyState = Kokkos::subview(aState, tIndex, Kokkos::ALL());
+            this->append(aFreqArray[tIndex], tMyState);
+        }
+    }
+
+private:
+    static Omega_h::LOs getNodeSet(Omega_h::MeshSets& aMeshSets, const std::string & aNodeSetName)
+    {
+        auto& tNodeSets = aMeshSets[Omega_h::NODE_SET];
+        auto tIterator = tNodeSets.find(aNodeSetName);
+        if(tIterator == tNodeSets.end())
+        {
+            Plato::throw_frequency_sweep_error(__PRETTY_FUNCTION__, __LINE__, "NODE SET " + aNodeSetName + " IS NOT DEFINED.");
+        }
+        return tIterator->second;
+    }
+
+    /******************************************************************************//**
+     * @brief Connectivity of the highest dimensional entities whose vertices were all written
+     * @param [in] aMesh mesh
+     * @param [in] aHostNodes mesh vertex ordinal of each output node
+     * @param [out] aVertsPerElement vertices per element
+     * @return element vertices, given as positions of the nodes in the container
+    **********************************************************************************/
+    static std::vector<std::int64_t> getConnectivity(Omega_h::Mesh& aMesh,
+                                                     const Omega_h::HostRead<Omega_h::LO> & aHostNodes,
+                                                     std::int32_t & aVertsPerElement)
+    {
+        std::vector<std::int64_t> tPosition(aMesh.nverts(), -1);
+        for(Omega_h::LO tNode = 0; tNode < aHostNodes.size(); tNode++)
+        {
+            tPosition[aHostNodes[tNode]] = tNode;
+        }
+        std::vector<std::int64_t> tConnectivity;
+        for(Plato::OrdinalType tDim = SpaceDim; tDim > 0; tDim--)
+        {
+            aVertsPerElement = tDim + 1;
+            Omega_h::HostRead<Omega_h::LO> tEntityVerts(aMesh.ask_verts_of(tDim));
+            const Omega_h::LO tNumEntities = aMesh.nents(tDim);
+            for(Omega_h::LO tEntity = 0; tEntity < tNumEntities; tEntity++)
+            {
+                bool tWritten = true;
+                for(std::int32_t tVert = 0; tVert < aVertsPerElement; tVert++)
+                {
+                    tWritten = tWritten && tPosition[tEntityVerts[tEntity * aVertsPerElement + tVert]] >= 0;
+                }
+                if(tWritten == false)
+                {
+                    continue;
+                }
+                for(std::int32_t tVert = 0; tVert < aVertsPerElement; tVert++)
+                {
+                    tConnectivity.push_back(tPosition[tEntityVerts[tEntity * aVertsPerElement + tVert]]);
+                }
+            }
+            if(tConnectivity.empty() == false)
+            {
+                return tConnectivity;
+            }
+        }
+        aVertsPerElement = 1;
+        return tConnectivity;
+    }
+
+    void writeHeader(Omega_h::Mesh& aMesh)
+    {
+        Omega_h::HostRead<Omega_h::LO> tHostNodes(mNodes);
+        std::int32_t tVertsPerElement = 0;
+        const std::vector<std::int64_t> tConnectivity = FrequencySweepWriter::getConnectivity(aMesh, tHostNodes, tVertsPerElement);
+
+        const std::int32_t tHeader[5] = { Plato::FrequencySweepFormat::mVersion, SpaceDim, mNumDofsPerNode,
+                                          mSinglePrecision ? static_cast<std::int32_t>(sizeof(float)) : static_cast<std::int32_t>(sizeof(double)),
+                                          tVertsPerElement };
+        const std::int64_t tNumNodes = mNodes.size();
+        const std::int64_t tNumElements = tConnectivity.size() / tVertsPerElement;
+        mFile.write(Plato::FrequencySweepFormat::mMagic, Plato::FrequencySweepFormat::mMagicSize);
+        mFile.write(reinterpret_cast<const char*>(tHeader), sizeof(tHeader));
+        mFile.write(reinterpret_cast<const char*>(&tNumNodes), sizeof(std::int64_t));
+        mFile.write(reinterpret_cast<const char*>(&tNumElements), sizeof(std::int64_t));
+        mFile.write(reinterpret_cast<const char*>(&mNumFrequencies), sizeof(std::int64_t));
+
+        Omega_h::HostRead<Omega_h::Real> tHostCoords(aMesh.coords());
+        std::vector<std::int64_t> tNodes(tNumNodes);
+        std::vector<double> tCoords(tNumNodes * SpaceDim);
+        for(std::int64_t tNode = 0; tNode < tNumNodes; tNode++)
+        {
+            tNodes[tNode] = tHostNodes[tNode];
+            for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+            {
+                tCoords[tNode * SpaceDim + tDim] = tHostCoords[tHostNodes[tNode] * SpaceDim + tDim];
+            }
+        }
+        mFile.write(reinterpret_cast<const char*>(tNodes.data()), tNodes.size() * sizeof(std::int64_t));
+        mFile.write(reinterpret_cast<const char*>(tCoords.data()), tCoords.size() * sizeof(double));
+        mFile.write(reinterpret_cast<const char*>(tConnectivity.data()), tConnectivity.size() * sizeof(std::int64_t));
+        mFile.flush();
+    }
+};
+// class FrequencySweepWriter
+
+/******************************************************************************//**
+ * Reads frequency sweep containers written by FrequencySweepWriter. Only the
+ * header, nodes, coordinates and connectivity are kept in memory; each request seeks to the
+ * values it needs.
+**********************************************************************************/
+class FrequencySweepReader
+{
+private:
+    std::ifstream mFile;
+    std::int32_t mSpaceDim;
+    std::int32_t mNumDofsPerNode;
+    std::int32_t mBytesPerValue;
+    std::int32_t mVertsPerElement;
+    std::int64_t mNumFrequencies;
+    std::vector<std::int64_t> mNodes;
+    std::vector<double> mCoords;
+    std::vector<std::int64_t> mConnectivity;
+    std::streamoff mFirstRecord;
+
+public:
+    explicit FrequencySweepReader(const std::string & aFileName) :
+            mFile(aFileName, std::ios::binary),
+            mSpaceDim(0),
+            mNumDofsPerNode(0),
+            mBytesPerValue(0),
+            mVertsPerElement(0),
+            mNumFrequencies(0),
+            mFirstRecord(0)
+    {
+        if(mFile.is_open() == false)
+        {
+            Plato::throw_frequency_sweep_error(__PRETTY_FUNCTION__, __LINE__, "COULD NOT OPEN FILE " + aFileName + ".");
+        }
+        char tMagic[Plato::FrequencySweepFormat::mMagicSize];
+        std::int32_t tHeader[5];
+        std::int64_t tNumNodes = 0;
+        std::int64_t tNumElements = 0;
+        mFile.read(tMagic, sizeof(tMagic));
+        mFile.read(reinterpret_cast<char*>(tHeader), sizeof(tHeader));
+        mFile.read(reinterpret_cast<char*>(&tNumNodes), sizeof(std::int64_t));
+        mFile.read(reinterpret_cast<char*>(&tNumElements), sizeof(std::int64_t));
+        mFile.read(reinterpret_cast<char*>(&mNumFrequencies), sizeof(std::int64_t));
+        if(!mFile || std::equal(tMagic, tMagic + sizeof(tMagic), Plato::FrequencySweepFormat::mMagic) == false)
+        {
+            Plato::throw_frequency_sweep_error(__PRETTY_FUNCTION__, __LINE__, aFileName + " IS NOT A FREQUENCY SWEEP FILE.");
+        }
+        if(tHeader[0] != Plato::FrequencySweepFormat::mVersion)
+        {
+            Plato::throw_frequency_sweep_error(__PRETTY_FUNCTION__, __LINE__, "UNSUPPORTED FREQUENCY SWEEP FILE VERSION.");
+        }
+        mSpaceDim = tHeader[1];
+        mNumDofsPerNode = tHeader[2];
+        mBytesPerValue = tHeader[3];
+        mVertsPerElement = tHeader[4];
+
+        mNodes.resize(tNumNodes);
+        mCoords.resize(tNumNodes * mSpaceDim);
+        mConnectivity.resize(tNumElements * mVertsPerElement);
+        mFile.read(reinterpret_cast<char*>(mNodes.data()), mNodes.size() * sizeof(std::int64_t));
+        mFile.read(reinterpret_cast<char*>(mCoords.data()), mCoords.size() * sizeof(double));
+        mFile.read(reinterpret_cast<char*>(mConnectivity.data()), mConnectivity.size() * sizeof(std::int64_t));
+        if(!mFile)
+        {
+            Plato::throw_frequency_sweep_error(__PRETTY_FUNCTION__, __LINE__, aFileName + " IS TRUNCATED.");
+        }
+        mFirstRecord = mFile.tellg();
+    }
+
+    std::int32_t getSpaceDim() const
+    {
+        return mSpaceDim;
+    }
+    std::int32_t getNumDofsPerNode() const
+    {
+        return mNumDofsPerNode;
+    }
+    std::int32_t getNumVertsPerElement() const
+    {
+        return mVertsPerElement;
+    }
+    std::int64_t getNumNodes() const
+    {
+        return mNodes.size();
+    }
+    std::int64_t getNumElements() const
+    {
+        return mVertsPerElement > 0 ? std::int64_t(mConnectivity.size()) / mVertsPerElement : 0;
+    }
+    std::int64_t getNumFrequencies() const
+    {
+        return mNumFrequencies;
+    }
+    const std::vector<std::int64_t> & getNodes() const
+    {
+        return mNodes;
+    }
+    const std::vector<double> & getCoords() const
+    {
+        return mCoords;
+    }
+    const std::vector<std::int64_t> & getConnectivity() const
+    {
+        return mConnectivity;
+    }
+
+    /******************************************************************************//**
+     * @brief Position of a mesh vertex in the container, -1 if it was not written
+    **********************************************************************************/
+    std::int64_t findNode(const std::int64_t & aVertex) const
+    {
+        auto tIterator = std::find(mNodes.begin(), mNodes.end(), aVertex);
+        return tIterator == mNodes.end() ? -1 : std::int64_t(tIterator - mNodes.begin());
+    }
+
+    std::vector<double> getFrequencies()
+    {
+        std::vector<double> tFrequencies(mNumFrequencies);
+        for(std::int64_t tIndex = 0; tIndex < mNumFrequencies; tIndex++)
+        {
+            mFile.seekg(this->recordOffset(tIndex));
+            mFile.read(reinterpret_cast<char*>(&tFrequencies[tIndex]), sizeof(double));
+        }
+        this->check(__PRETTY_FUNCTION__, __LINE__);
+        return tFrequencies;
+    }
+
+    /******************************************************************************//**
+     * @brief Complex displacements of every node at one frequency
+     * @param [in] aFreqIndex frequency index
+     * @return values ordered by node, then (real, imaginary) displacements
+    **********************************************************************************/
+    std::vector<double> readFrequency(const std::int64_t & aFreqIndex)
+    {
+        this->checkFrequency(aFreqIndex);
+        std::vector<double> tValues(mNodes.size() * mNumDofsPerNode);
+        mFile.seekg(this->recordOffset(aFreqIndex) + static_cast<std::streamoff>(sizeof(double)));
+        this->readValues(tValues.data(), tValues.size());
+        this->check(__PRETTY_FUNCTION__, __LINE__);
+        return tValues;
+    }
+
+    /******************************************************************************//**
+     * @brief Complex displacements of one node at every frequency
+     * @param [in] aNodeIndex position of the node in the container (see findNode)
+     * @return values ordered by frequency, then (real, imaginary) displacements
+    **********************************************************************************/
+    std::vector<double> readNodeHistory(const std::int64_t & aNodeIndex)
+    {
+        if(aNodeIndex < 0 || aNodeIndex >= static_cast<std::int64_t>(mNodes.size()))
+        {
+            Plato::throw_frequency_sweep_error(__PRETTY_FUNCTION__, __LINE__, "NODE INDEX IS OUT OF RANGE.");
+        }
+        std::vector<double> tValues(mNumFrequencies * mNumDofsPerNode);
+        const std::streamoff tNodeOffset = sizeof(double) + aNodeIndex * mNumDofsPerNode * mBytesPerValue;
+        for(std::int64_t tIndex = 0; tIndex < mNumFrequencies; tIndex++)
+        {
+            mFile.seekg(this->recordOffset(tIndex) + tNodeOffset);
+            this->readValues(tValues.data() + tIndex * mNumDofsPerNode, mNumDofsPerNode);
+        }
+        this->check(__PRETTY_FUNCTION__, __LINE__);
+        return tValues;
+    }
+
+private:
+    std::streamoff recordOffset(const std::int64_t & aFreqIndex) const
+    {
+        const std::streamoff tRecordSize = sizeof(double) + mNodes.size() * mNumDofsPerNode * mBytesPerValue;
+        return mFirstRecord + aFreqIndex * tRecordSize;
+    }
+
+    void readValues(double* aOutput, const size_t & aLength)
+    {
+        if(mBytesPerValue == static_cast<std::int32_t>(sizeof(float)))
+        {
+            std::vector<float> tSingle(aLength);
+            mFile.read(reinterpret_cast<char*>(tSingle.data()), aLength * sizeof(float));
+            std::copy(tSingle.begin(), tSingle.end(), aOutput);
+        }
+        else
+        {
+            mFile.read(reinterpret_cast<char*>(aOutput), aLength * sizeof(double));
+        }
+    }
+
+    void checkFrequency(const std::int64_t & aFreqIndex) const
+    {
+        if(aFreqIndex < 0 || aFreqIndex >= mNumFrequencies)
+        {
+            Plato::throw_frequency_sweep_error(__PRETTY_FUNCTION__, __LINE__, "FREQUENCY INDEX IS OUT OF RANGE.");
+        }
+    }
+
+    void check(const std::string & aFunction, Plato::OrdinalType aLine)
+    {
+        if(!mFile)
+        {
+            mFile.clear();
+            Plato::throw_frequency_sweep_error(aFunction, aLine, "FREQUENCY SWEEP FILE IS TRUNCATED.");
+        }
+    }
+};
+// class FrequencySweepReader
+
+} // namespace Plato
+
+#endif /* FREQUENCYSWEEPOUTPUT_HPP_ */
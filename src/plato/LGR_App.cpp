@@ -114,6 +114,8 @@ void MPMD_App::initialize()
   m_objective_gradient_z = Plato::ScalarVector("objective_gradient_z", tNumLocalVals);
   m_objective_gradient_x = Plato::ScalarVector("objective_gradient_x", m_numSpatialDims*tNumLocalVals);
 
+  m_hessian_direction = Plato::ScalarVector("hessian_direction", tNumLocalVals);
+
   // parse problem definitions
   //
   for( auto opNode : m_inputData.getByName<Plato::InputData>("Operation") ){
@@ -178,6 +180,12 @@ void MPMD_App::initialize()
     if(tStrFunction == "ComputeConstraintGradientX"){
       m_operationMap[tStrName] = new ComputeConstraintGradientX(this, tOperationNode, opDef);
     } else 
+    if(tStrFunction == "ComputeObjectiveHessianTimesVector"){
+      m_operationMap[tStrName] = new ComputeObjectiveHessianTimesVector(this, tOperationNode, opDef);
+    } else 
+    if(tStrFunction == "ComputeConstraintHessianTimesVector"){
+      m_operationMap[tStrName] = new ComputeConstraintHessianTimesVector(this, tOperationNode, opDef);
+    } else 
     if(tStrFunction == "WriteOutput"){
       m_operationMap[tStrName] = new WriteOutput(this, tOperationNode, opDef);
     } else 
@@ -462,6 +470,34 @@ void MPMD_App::ComputeConstraintGradientX::operator()()
   mMyApp->m_constraint_gradient_x = mMyApp->m_problem->constraintGradientX(mMyApp->m_control, mMyApp->m_state);
 }
 
+/******************************************************************************/
+MPMD_App::ComputeObjectiveHessianTimesVector::
+ComputeObjectiveHessianTimesVector(MPMD_App* aMyApp, Plato::InputData& aOpNode, 
+                                   Teuchos::RCP<ProblemDefinition> aOpDef) : LocalOp(aMyApp, aOpNode, aOpDef) { }
+/******************************************************************************/
+
+/******************************************************************************/
+void MPMD_App::ComputeObjectiveHessianTimesVector::operator()()
+/******************************************************************************/
+{
+  mMyApp->m_objective_hessian_times_vector =
+    mMyApp->m_problem->objectiveHessianTimesVector(mMyApp->m_control, mMyApp->m_state, mMyApp->m_hessian_direction);
+}
+
+/******************************************************************************/
+MPMD_App::ComputeConstraintHessianTimesVector::
+ComputeConstraintHessianTimesVector(MPMD_App* aMyApp, Plato::InputData& aOpNode, 
+                                    Teuchos::RCP<ProblemDefinition> aOpDef) : LocalOp(aMyApp, aOpNode, aOpDef) { }
+/******************************************************************************/
+
+/******************************************************************************/
+void MPMD_App::ComputeConstraintHessianTimesVector::operator()()
+/******************************************************************************/
+{
+  mMyApp->m_constraint_hessian_times_vector =
+    mMyApp->m_problem->constraintHessianTimesVector(mMyApp->m_control, mMyApp->m_state, mMyApp->m_hessian_direction);
+}
+
 /******************************************************************************/
 MPMD_App::ComputeSolution::
 ComputeSolution(MPMD_App* aMyApp, Plato::InputData& aOpNode, 
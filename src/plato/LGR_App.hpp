@@ -122,6 +122,10 @@ public:
         {
             this->copyFieldIntolgr(m_control, aSharedField);
         } 
+        else if(aName == "Hessian Direction")
+        {
+            this->copyFieldIntolgr(m_hessian_direction, aSharedField);
+        }
         else if(aName == "Solution")
         {
             const Plato::OrdinalType tTIME_STEP_INDEX = 0;
@@ -242,6 +246,14 @@ public:
     {
         this->copyFieldFromlgr(m_constraint_gradient_z, aSharedField);
     }
+    else if( aName == "Objective Hessian Times Vector" )
+    {
+        this->copyFieldFromlgr(m_objective_hessian_times_vector, aSharedField);
+    }
+    else if( aName == "Constraint Hessian Times Vector" )
+    {
+        this->copyFieldFromlgr(m_constraint_hessian_times_vector, aSharedField);
+    }
     else if( aName == "Adjoint" )
     {
         auto tScalarField = getVectorComponent(m_adjoint,/*component=*/0, /*stride=*/1);
@@ -411,6 +423,10 @@ private:
     Plato::ScalarVector m_constraint_gradient_z;
     Plato::ScalarVector m_constraint_gradient_x;
 
+    Plato::ScalarVector m_hessian_direction;
+    Plato::ScalarVector m_objective_hessian_times_vector;
+    Plato::ScalarVector m_constraint_hessian_times_vector;
+
     Plato::OrdinalType m_numSpatialDims;
 
   #ifdef PLATO_GEOMETRY
@@ -539,6 +555,26 @@ private:
     friend class ComputeConstraintGradientX;
     /******************************************************************************/
 
+    // Hessian sub-classes
+    //
+    /******************************************************************************/
+    class ComputeObjectiveHessianTimesVector : public LocalOp
+    { public:
+        ComputeObjectiveHessianTimesVector(MPMD_App* aMyApp, Plato::InputData& aNode, Teuchos::RCP<ProblemDefinition> aOpDef);
+        void operator()();
+    };
+    friend class ComputeObjectiveHessianTimesVector;
+    /******************************************************************************/
+
+    /******************************************************************************/
+    class ComputeConstraintHessianTimesVector : public LocalOp
+    { public:
+        ComputeConstraintHessianTimesVector(MPMD_App* aMyApp, Plato::InputData& aNode, Teuchos::RCP<ProblemDefinition> aOpDef);
+        void operator()();
+    };
+    friend class ComputeConstraintHessianTimesVector;
+    /******************************************************************************/
+
     // Output sub-classes
     //
     /******************************************************************************/
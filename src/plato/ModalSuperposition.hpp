@@ -0,0 +1,875 @@
+/*
+ * ModalSuperposition.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef MODALSUPERPOSITION_HPP_
+#define MODALSUPERPOSITION_HPP_
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <complex>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+#include <Teuchos_RCP.hpp>
+
+#include "ApplyConstraints.hpp"
+
+#include "plato/PlatoMathHelpers.hpp"
+#include "plato/PlatoStaticsTypes.hpp"
+
+#ifdef HAVE_AMGX
+#include "AmgXSparseLinearProblem.hpp"
+#endif
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * Frequency response by modal superposition. The structural dynamics operator
+ * with Rayleigh damping is
+ *
+ *   A(omega) = (1 - i beta) K - (omega^2 + i alpha) M,
+ *
+ * so the mass normalized eigenvectors of K phi = lambda M phi diagonalize it
+ * at every frequency. The lowest eigenpairs are computed once per design and
+ * every frequency is then solved in the reduced basis, with the truncated modes
+ * added back quasi-statically (mode acceleration):
+ *
+ *   u = sum_j phi_j (phi_j^T b) / (d_j - omega^2) + K^{-1} (b - M Phi Phi^T b),
+ *   d_j = phi_j^T A(0) phi_j.
+ *
+ * K and M are not assembled separately; they are recovered from the complex
+ * Jacobians at zero and at a reference frequency, whose real blocks are K and
+ * K - omega_ref^2 M. Eigenpairs come from a shift-invert Lanczos iteration on
+ * K^{-1} M in the M inner product with full reorthogonalization. Each reduced
+ * solution is checked against the full residual and corrected again until it
+ * meets the tolerance, so the caller can fall back to the direct solve
+ * wherever the truncated basis is not accurate enough.
+**********************************************************************************/
+template<Plato::OrdinalType SpaceDim>
+class ModalSuperposition
+{
+private:
+    static constexpr Plato::OrdinalType mNumDofsPerNode = 2 * SpaceDim; /*!< real, then imaginary displacements */
+
+    Plato::OrdinalType mNumNodes;
+    Plato::OrdinalType mNumModes;
+    Plato::OrdinalType mNumFreeDofs;
+    Plato::OrdinalType mNumSolverIterations;
+    Plato::OrdinalType mMaxNumCorrections;
+    Plato::OrdinalType mNumAcceptedSolves;   /*!< reduced solves that met the residual tolerance */
+    Plato::OrdinalType mNumRejectedSolves;   /*!< reduced solves left to the direct solver */
+    Plato::OrdinalType mNumCorrections;      /*!< mode acceleration passes after the first, over all solves */
+    Plato::OrdinalType mNumStiffnessSolves;  /*!< K^{-1} applications, Lanczos included */
+    Plato::Scalar mEigenTolerance;
+    Plato::Scalar mResidualTolerance;
+    Plato::Scalar mRelativeResidual; /*!< relative residual of the last reduced solve */
+
+    Plato::LocalOrdinalVector mBcDofs;        /*!< constrained dofs of the complex system */
+    Plato::LocalOrdinalVector mRealBcDofs;    /*!< constrained dofs of the real displacements */
+
+    std::vector<Plato::Scalar> mEigenvalues;
+    Plato::ScalarMultiVector mModes;          /*!< mass normalized mode shapes, one per row */
+    Plato::ScalarMultiVector mMassModes;      /*!< M phi_j, one per row */
+
+    Teuchos::RCP<Plato::CrsMatrixType> mStiffness;
+    Teuchos::RCP<Plato::CrsMatrixType> mMass;
+
+    Plato::ScalarVector mSolverRhs;
+    Plato::ScalarVector mSolverLhs;
+#ifdef HAVE_AMGX
+    using AmgXLinearProblem = lgr::AmgXSparseLinearProblem<Plato::OrdinalType, SpaceDim>;
+    std::shared_ptr<AmgXLinearProblem> mSolver; /*!< kept alive across the Lanczos iterations of one design */
+#endif
+
+public:
+    /******************************************************************************//**
+     * @brief Constructor
+     * @param [in] aNumNodes number of mesh vertices
+     * @param [in] aNumModes number of eigenpairs kept in the reduced basis
+    **********************************************************************************/
+    ModalSuperposition(const Plato::OrdinalType & aNumNodes, const Plato::OrdinalType & aNumModes) :
+            mNumNodes(aNumNodes),
+            mNumModes(aNumModes),
+            mNumFreeDofs(aNumNodes * SpaceDim),
+            mNumSolverIterations(1000),
+            mMaxNumCorrections(10),
+            mNumAcceptedSolves(0),
+            mNumRejectedSolves(0),
+            mNumCorrections(0),
+            mNumStiffnessSolves(0),
+            mEigenTolerance(1e-6),
+            mResidualTolerance(1e-6),
+            mRelativeResidual(0.0),
+            mEigenvalues(),
+            mStiffness(Teuchos::null),
+            mMass(Teuchos::null),
+            mSolverRhs("ModalSolverRhs", aNumNodes * SpaceDim),
+            mSolverLhs("ModalSolverLhs", aNumNodes * SpaceDim)
+    {
+        assert(aNumModes > static_cast<Plato::OrdinalType>(0));
+    }
+
+    /******************************************************************************//**
+     * @brief Set relative tolerance on the eigenpair residual ||K phi - lambda M phi||
+    **********************************************************************************/
+    void setEigenTolerance(const Plato::Scalar & aInput)
+    {
+        mEigenTolerance = aInput;
+    }
+
+    /******************************************************************************//**
+     * @brief Set relative tolerance on the full residual of a reduced solution
+    **********************************************************************************/
+    void setResidualTolerance(const Plato::Scalar & aInput)
+    {
+        mResidualTolerance = aInput;
+    }
+
+    /******************************************************************************//**
+     * @brief Set maximum number of iterations of the shift-invert linear solves
+    **********************************************************************************/
+    void setMaxNumSolverIterations(const Plato::OrdinalType & aInput)
+    {
+        mNumSolverIterations = aInput;
+    }
+
+    /******************************************************************************//**
+     * @brief Set maximum number of mode acceleration corrections after the first reduced solution
+    **********************************************************************************/
+    void setMaxNumCorrections(const Plato::OrdinalType & aInput)
+    {
+        mMaxNumCorrections = aInput;
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of reduced solves that met the residual tolerance
+    **********************************************************************************/
+    Plato::OrdinalType getNumAcceptedSolves() const
+    {
+        return mNumAcceptedSolves;
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of reduced solves that missed the residual tolerance
+    **********************************************************************************/
+    Plato::OrdinalType getNumRejectedSolves() const
+    {
+        return mNumRejectedSolves;
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of mode acceleration corrections over all reduced solves
+    **********************************************************************************/
+    Plato::OrdinalType getNumCorrections() const
+    {
+        return mNumCorrections;
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of real stiffness solves, the Lanczos iterations included
+    **********************************************************************************/
+    Plato::OrdinalType getNumStiffnessSolves() const
+    {
+        return mNumStiffnessSolves;
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of eigenpairs in the reduced basis
+    **********************************************************************************/
+    Plato::OrdinalType getNumModes() const
+    {
+        return static_cast<Plato::OrdinalType>(mEigenvalues.size());
+    }
+
+    /******************************************************************************//**
+     * @brief Return eigenvalues (squared angular frequencies) in ascending order
+    **********************************************************************************/
+    const std::vector<Plato::Scalar> & getEigenvalues() const
+    {
+        return mEigenvalues;
+    }
+
+    /******************************************************************************//**
+     * @brief Return mass normalized mode shapes (one per row, real displacement dofs)
+    **********************************************************************************/
+    Plato::ScalarMultiVector getModes() const
+    {
+        return mModes;
+    }
+
+    /******************************************************************************//**
+     * @brief Return constrained stiffness matrix recovered by the last computeModes call
+    **********************************************************************************/
+    Teuchos::RCP<Plato::CrsMatrixType> getStiffness() const
+    {
+        return mStiffness;
+    }
+
+    /******************************************************************************//**
+     * @brief Return constrained mass matrix recovered by the last computeModes call
+    **********************************************************************************/
+    Teuchos::RCP<Plato::CrsMatrixType> getMass() const
+    {
+        return mMass;
+    }
+
+    /******************************************************************************//**
+     * @brief Return relative residual ||A u - b|| / ||b|| of the last reduced solve
+    **********************************************************************************/
+    Plato::Scalar getRelativeResidual() const
+    {
+        return mRelativeResidual;
+    }
+
+    /******************************************************************************//**
+     * @brief Compute the lowest eigenpairs for the current design
+     * @param [in] aJacobianZero complex Jacobian at zero frequency
+     * @param [in] aJacobianRef complex Jacobian at the reference frequency
+     * @param [in] aRefFrequency nonzero reference angular frequency
+     * @param [in] aBcDofs constrained dofs of the complex system (homogeneous)
+    **********************************************************************************/
+    void computeModes(const Teuchos::RCP<Plato::CrsMatrixType> & aJacobianZero,
+                      const Teuchos::RCP<Plato::CrsMatrixType> & aJacobianRef,
+                      const Plato::Scalar & aRefFrequency,
+                      const Plato::LocalOrdinalVector & aBcDofs)
+    {
+        assert(aRefFrequency != static_cast<Plato::Scalar>(0.0));
+        this->setConstrainedDofs(aBcDofs);
+
+        // K is the real block of A(0) and M the real block of (A(0) - A(omega_ref)) / omega_ref^2
+        const Plato::Scalar tMassScale = static_cast<Plato::Scalar>(1.0) / (aRefFrequency * aRefFrequency);
+        mStiffness = this->extractRealBlock(aJacobianZero, aJacobianRef, 1.0, 0.0);
+        mMass = this->extractRealBlock(aJacobianZero, aJacobianRef, tMassScale, -tMassScale);
+        Plato::ScalarVector tZeros("BcValues", mRealBcDofs.size());
+        Plato::applyBlockConstraints<SpaceDim>(mStiffness, mSolverRhs, mRealBcDofs, tZeros);
+        Plato::applyBlockConstraints<SpaceDim>(mMass, mSolverRhs, mRealBcDofs, tZeros);
+#ifdef HAVE_AMGX
+        mSolver.reset();
+#endif
+
+        const Plato::OrdinalType tNumModes = std::min(mNumModes, mNumFreeDofs);
+        Plato::OrdinalType tNumVectors = std::min(std::max(2 * tNumModes, tNumModes + 10), mNumFreeDofs);
+        while(this->lanczos(tNumModes, tNumVectors) == false)
+        {
+            if(tNumVectors == mNumFreeDofs)
+            {
+                std::ostringstream tErrorMessage;
+                tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                        << ", LINE: " << __LINE__ << "\nMESSAGE: LANCZOS ITERATION DID NOT CONVERGE THE REQUESTED "
+                        << tNumModes << " EIGENPAIRS TO A RELATIVE TOLERANCE OF " << mEigenTolerance << ". **************\n\n";
+                throw std::runtime_error(tErrorMessage.str().c_str());
+            }
+            tNumVectors = std::min(2 * tNumVectors, mNumFreeDofs);
+        }
+
+        mMassModes = Plato::ScalarMultiVector("MassModes", this->getNumModes(), mNumNodes * SpaceDim);
+        for(Plato::OrdinalType tModeIndex = 0; tModeIndex < this->getNumModes(); tModeIndex++)
+        {
+            Plato::ScalarVector tMode = Kokkos::subview(mModes, tModeIndex, Kokkos::ALL());
+            Plato::ScalarVector tMassMode = Kokkos::subview(mMassModes, tModeIndex, Kokkos::ALL());
+            this->apply(mMass, tMode, tMassMode);
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Project a complex operator at zero frequency onto the modes
+     * @param [in] aJacobianZero complex Jacobian at zero frequency
+     * @return d_j = phi_j^T A(0) phi_j, so that A(omega) is diag(d_j - omega^2) in the reduced basis
+    **********************************************************************************/
+    std::vector<std::complex<Plato::Scalar>> projectOperator(const Teuchos::RCP<Plato::CrsMatrixType> & aJacobianZero)
+    {
+        const Plato::OrdinalType tNumComplexDofs = mNumNodes * mNumDofsPerNode;
+        Plato::ScalarVector tComplexMode("ComplexMode", tNumComplexDofs);
+        Plato::ScalarVector tComplexProduct("ComplexProduct", tNumComplexDofs);
+        Plato::ScalarVector tRealPart("RealPart", mNumNodes * SpaceDim);
+        Plato::ScalarVector tImagPart("ImagPart", mNumNodes * SpaceDim);
+        Plato::ScalarVector tZeros("Zeros", mNumNodes * SpaceDim);
+
+        std::vector<std::complex<Plato::Scalar>> tOutput(this->getNumModes());
+        for(Plato::OrdinalType tModeIndex = 0; tModeIndex < this->getNumModes(); tModeIndex++)
+        {
+            Plato::ScalarVector tMode = Kokkos::subview(mModes, tModeIndex, Kokkos::ALL());
+            this->merge(tMode, tZeros, tComplexMode);
+            this->apply(aJacobianZero, tComplexMode, tComplexProduct);
+            this->split(tComplexProduct, tRealPart, tImagPart);
+            tOutput[tModeIndex] = std::complex<Plato::Scalar>(Plato::dot(tMode, tRealPart), Plato::dot(tMode, tImagPart));
+        }
+        return tOutput;
+    }
+
+    /******************************************************************************//**
+     * @brief Solve A(omega) u = b in the reduced basis and check the full residual
+     *
+     * The modes alone leave a residual of about (I - M Phi Phi^T) b, which is O(1)
+     * for any load the kept modes do not span, so the truncated modes are added
+     * back by the static correction K^{-1} (b - M Phi Phi^T b). The same reduced
+     * solve plus static correction is then applied to the residual until it meets
+     * the tolerance. Each pass shrinks the error in the truncated modes by about
+     * max(omega^2 / lambda_{k+1}, beta), so a basis that reaches past the sweep
+     * converges in a few passes; a pass that does not halve the residual stops it.
+     *
+     * @param [in] aJacobianZero complex Jacobian at zero frequency
+     * @param [in] aJacobianRef complex Jacobian at the reference frequency
+     * @param [in] aRefFrequency reference angular frequency
+     * @param [in] aFrequency angular frequency
+     * @param [in] aDiagonal projected operator from projectOperator
+     * @param [in] aRhs right hand side of the complex system
+     * @param [out] aSolution reduced solution of the complex system
+     * @return true if ||A u - b|| <= tolerance ||b|| on the unconstrained dofs
+    **********************************************************************************/
+    bool solve(const Teuchos::RCP<Plato::CrsMatrixType> & aJacobianZero,
+               const Teuchos::RCP<Plato::CrsMatrixType> & aJacobianRef,
+               const Plato::Scalar & aRefFrequency,
+               const Plato::Scalar & aFrequency,
+               const std::vector<std::complex<Plato::Scalar>> & aDiagonal,
+               const Plato::ScalarVector & aRhs,
+               const Plato::ScalarVector & aSolution)
+    {
+        assert(aDiagonal.size() == mEigenvalues.size());
+        const Plato::OrdinalType tNumComplexDofs = mNumNodes * mNumDofsPerNode;
+        Plato::ScalarVector tRhs("ModalRhs", tNumComplexDofs);
+        Kokkos::deep_copy(tRhs, aRhs);
+        this->zeroConstrainedDofs(mBcDofs, tRhs);
+        const Plato::Scalar tRhsNorm = std::sqrt(Plato::dot(tRhs, tRhs));
+
+        Plato::fill(static_cast<Plato::Scalar>(0.0), aSolution);
+        if(tRhsNorm == static_cast<Plato::Scalar>(0.0))
+        {
+            mRelativeResidual = 0.0;
+            mNumAcceptedSolves++;
+            return (true);
+        }
+
+        Plato::ScalarVector tResidual("ModalResidual", tNumComplexDofs);
+        Plato::ScalarVector tCorrection("ModalCorrection", tNumComplexDofs);
+        Kokkos::deep_copy(tResidual, tRhs);
+        Plato::Scalar tPreviousResidual = std::numeric_limits<Plato::Scalar>::max();
+        for(Plato::OrdinalType tPass = 0; tPass <= mMaxNumCorrections; tPass++)
+        {
+            this->modeAcceleration(aFrequency, aDiagonal, tResidual, tCorrection);
+            Plato::axpy(static_cast<Plato::Scalar>(1.0), tCorrection, aSolution);
+            mNumCorrections += (tPass > 0) ? 1 : 0;
+
+            this->residual(aJacobianZero, aJacobianRef, aRefFrequency, aFrequency, tRhs, aSolution, tResidual);
+            mRelativeResidual = std::sqrt(Plato::dot(tResidual, tResidual)) / tRhsNorm;
+            if(mRelativeResidual <= mResidualTolerance)
+            {
+                mNumAcceptedSolves++;
+                return (true);
+            }
+            if(mRelativeResidual > static_cast<Plato::Scalar>(0.5) * tPreviousResidual)
+            {
+                break;
+            }
+            tPreviousResidual = mRelativeResidual;
+        }
+        mNumRejectedSolves++;
+        return (false);
+    }
+
+    /******************************************************************************//**
+     * @brief Reduced solution plus static correction of the truncated modes
+     * @param [in] aFrequency angular frequency
+     * @param [in] aDiagonal projected operator from projectOperator
+     * @param [in] aRhs right hand side of the complex system, zero on constrained dofs
+     * @param [out] aOutput Phi diag(1 / (d_j - omega^2)) Phi^T b + K^{-1} (b - M Phi Phi^T b)
+    **********************************************************************************/
+    void modeAcceleration(const Plato::Scalar & aFrequency,
+                          const std::vector<std::complex<Plato::Scalar>> & aDiagonal,
+                          const Plato::ScalarVector & aRhs,
+                          const Plato::ScalarVector & aOutput)
+    {
+        const Plato::OrdinalType tNumRealDofs = mNumNodes * SpaceDim;
+        Plato::ScalarVector tRhsReal("ModalRhsReal", tNumRealDofs);
+        Plato::ScalarVector tRhsImag("ModalRhsImag", tNumRealDofs);
+        Plato::ScalarVector tSolReal("ModalSolutionReal", tNumRealDofs);
+        Plato::ScalarVector tSolImag("ModalSolutionImag", tNumRealDofs);
+        Plato::ScalarVector tStatic("ModalStaticCorrection", tNumRealDofs);
+        this->split(aRhs, tRhsReal, tRhsImag);
+
+        // modal coordinates q_j = phi_j^T b / (d_j - omega^2), and b - M Phi Phi^T b
+        const Plato::Scalar tOmegaTimesOmega = aFrequency * aFrequency;
+        for(Plato::OrdinalType tModeIndex = 0; tModeIndex < this->getNumModes(); tModeIndex++)
+        {
+            Plato::ScalarVector tMode = Kokkos::subview(mModes, tModeIndex, Kokkos::ALL());
+            Plato::ScalarVector tMassMode = Kokkos::subview(mMassModes, tModeIndex, Kokkos::ALL());
+            std::complex<Plato::Scalar> tForce(Plato::dot(tMode, tRhsReal), Plato::dot(tMode, tRhsImag));
+            auto tCoefficient = tForce / (aDiagonal[tModeIndex] - tOmegaTimesOmega);
+            Plato::axpy(tCoefficient.real(), tMode, tSolReal);
+            Plato::axpy(tCoefficient.imag(), tMode, tSolImag);
+            Plato::axpy(-tForce.real(), tMassMode, tRhsReal);
+            Plato::axpy(-tForce.imag(), tMassMode, tRhsImag);
+        }
+
+        // the truncated modes respond quasi-statically
+        this->applyStiffnessInverse(tRhsReal, tStatic);
+        Plato::axpy(static_cast<Plato::Scalar>(1.0), tStatic, tSolReal);
+        this->applyStiffnessInverse(tRhsImag, tStatic);
+        Plato::axpy(static_cast<Plato::Scalar>(1.0), tStatic, tSolImag);
+        this->merge(tSolReal, tSolImag, aOutput);
+    }
+
+    /******************************************************************************//**
+     * @brief Output = b - A(omega) u on the unconstrained dofs,
+     *   with A(omega) = A(0) - (omega/omega_ref)^2 (A(0) - A(omega_ref))
+    **********************************************************************************/
+    void residual(const Teuchos::RCP<Plato::CrsMatrixType> & aJacobianZero,
+                  const Teuchos::RCP<Plato::CrsMatrixType> & aJacobianRef,
+                  const Plato::Scalar & aRefFrequency,
+                  const Plato::Scalar & aFrequency,
+                  const Plato::ScalarVector & aRhs,
+                  const Plato::ScalarVector & aSolution,
+                  const Plato::ScalarVector & aOutput)
+    {
+        const Plato::OrdinalType tNumComplexDofs = mNumNodes * mNumDofsPerNode;
+        Plato::ScalarVector tProductRef("ProductRef", tNumComplexDofs);
+        this->apply(aJacobianZero, aSolution, aOutput);
+        this->apply(aJacobianRef, aSolution, tProductRef);
+        const Plato::Scalar tRatio = (aFrequency * aFrequency) / (aRefFrequency * aRefFrequency);
+        Plato::update(-tRatio, tProductRef, tRatio - static_cast<Plato::Scalar>(1.0), aOutput);
+        Plato::axpy(static_cast<Plato::Scalar>(1.0), aRhs, aOutput);
+        this->zeroConstrainedDofs(mBcDofs, aOutput);
+    }
+
+    /******************************************************************************//**
+     * @brief Real block alpha A + beta B of two complex block matrices with the same graph
+    **********************************************************************************/
+    Teuchos::RCP<Plato::CrsMatrixType> extractRealBlock(const Teuchos::RCP<Plato::CrsMatrixType> & aMatrixA,
+                                                        const Teuchos::RCP<Plato::CrsMatrixType> & aMatrixB,
+                                                        const Plato::Scalar & aAlpha,
+                                                        const Plato::Scalar & aBeta)
+    {
+        assert(aMatrixA->blockSizeRow() == mNumDofsPerNode);
+        assert(aMatrixB->blockSizeRow() == mNumDofsPerNode);
+        auto tEntriesA = aMatrixA->entries();
+        auto tEntriesB = aMatrixB->entries();
+        const Plato::OrdinalType tNumBlocks = aMatrixA->columnIndices().size();
+        const Plato::OrdinalType tNumDofsPerNode = mNumDofsPerNode;
+        Plato::ScalarVector tEntries("RealBlockEntries", tNumBlocks * SpaceDim * SpaceDim);
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tNumBlocks), LAMBDA_EXPRESSION(const Plato::OrdinalType & aBlockOrdinal)
+        {
+            for(Plato::OrdinalType tRow = 0; tRow < SpaceDim; tRow++)
+            {
+                for(Plato::OrdinalType tCol = 0; tCol < SpaceDim; tCol++)
+                {
+                    auto tFrom = tNumDofsPerNode * tNumDofsPerNode * aBlockOrdinal + tNumDofsPerNode * tRow + tCol;
+                    auto tTo = SpaceDim * SpaceDim * aBlockOrdinal + SpaceDim * tRow + tCol;
+                    tEntries(tTo) = aAlpha * tEntriesA(tFrom) + aBeta * tEntriesB(tFrom);
+                }
+            }
+        }, "extract real block");
+        return Teuchos::rcp(new Plato::CrsMatrixType(aMatrixA->rowMap(), aMatrixA->columnIndices(), tEntries, SpaceDim, SpaceDim));
+    }
+
+    /******************************************************************************//**
+     * @brief Output = Matrix * Input
+    **********************************************************************************/
+    void apply(const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix,
+               const Plato::ScalarVector & aInput,
+               const Plato::ScalarVector & aOutput)
+    {
+        Plato::fill(static_cast<Plato::Scalar>(0.0), aOutput);
+        Plato::MatrixTimesVectorPlusVector(aMatrix, aInput, aOutput);
+    }
+
+    /******************************************************************************//**
+     * @brief Separate a complex state into its real and imaginary displacements
+    **********************************************************************************/
+    void split(const Plato::ScalarVector & aComplex, const Plato::ScalarVector & aReal, const Plato::ScalarVector & aImag)
+    {
+        const Plato::OrdinalType tNumDofsPerNode = mNumDofsPerNode;
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, mNumNodes), LAMBDA_EXPRESSION(const Plato::OrdinalType & aNodeOrdinal)
+        {
+            for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+            {
+                aReal(aNodeOrdinal * SpaceDim + tDim) = aComplex(aNodeOrdinal * tNumDofsPerNode + tDim);
+                aImag(aNodeOrdinal * SpaceDim + tDim) = aComplex(aNodeOrdinal * tNumDofsPerNode + SpaceDim + tDim);
+            }
+        }, "split complex state");
+    }
+
+    /******************************************************************************//**
+     * @brief Combine real and imaginary displacements into a complex state
+    **********************************************************************************/
+    void merge(const Plato::ScalarVector & aReal, const Plato::ScalarVector & aImag, const Plato::ScalarVector & aComplex)
+    {
+        const Plato::OrdinalType tNumDofsPerNode = mNumDofsPerNode;
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, mNumNodes), LAMBDA_EXPRESSION(const Plato::OrdinalType & aNodeOrdinal)
+        {
+            for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+            {
+                aComplex(aNodeOrdinal * tNumDofsPerNode + tDim) = aReal(aNodeOrdinal * SpaceDim + tDim);
+                aComplex(aNodeOrdinal * tNumDofsPerNode + SpaceDim + tDim) = aImag(aNodeOrdinal * SpaceDim + tDim);
+            }
+        }, "merge complex state");
+    }
+
+    /******************************************************************************//**
+     * @brief Set the listed dofs of a vector to zero
+    **********************************************************************************/
+    void zeroConstrainedDofs(const Plato::LocalOrdinalVector & aDofs, const Plato::ScalarVector & aVector)
+    {
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, aDofs.size()), LAMBDA_EXPRESSION(const Plato::OrdinalType & aOrdinal)
+        {
+            aVector(aDofs(aOrdinal)) = 0.0;
+        }, "zero constrained dofs");
+    }
+
+    /******************************************************************************//**
+     * @brief Deterministic start vector with components in every mode
+    **********************************************************************************/
+    void initialVector(const Plato::ScalarVector & aOutput)
+    {
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, aOutput.size()), LAMBDA_EXPRESSION(const Plato::OrdinalType & aOrdinal)
+        {
+            // a constant vector would miss every mode that is antisymmetric on a symmetric mesh
+            unsigned int tHash = static_cast<unsigned int>(aOrdinal) * 2654435761u;
+            aOutput(aOrdinal) = static_cast<Plato::Scalar>(tHash % 1000u) / 1000.0 - 0.5;
+        }, "Lanczos start vector");
+        this->zeroConstrainedDofs(mRealBcDofs, aOutput);
+    }
+
+    /******************************************************************************//**
+     * @brief Diagonal of a real block matrix
+    **********************************************************************************/
+    void diagonal(const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix, const Plato::ScalarVector & aOutput)
+    {
+        auto tRowMap = aMatrix->rowMap();
+        auto tColumnIndices = aMatrix->columnIndices();
+        auto tEntries = aMatrix->entries();
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, mNumNodes), LAMBDA_EXPRESSION(const Plato::OrdinalType & aNodeOrdinal)
+        {
+            for(auto tCrsIndex = tRowMap(aNodeOrdinal); tCrsIndex < tRowMap(aNodeOrdinal + 1); tCrsIndex++)
+            {
+                if(tColumnIndices(tCrsIndex) == aNodeOrdinal)
+                {
+                    for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+                    {
+                        aOutput(aNodeOrdinal * SpaceDim + tDim) = tEntries(SpaceDim * SpaceDim * tCrsIndex + SpaceDim * tDim + tDim);
+                    }
+                }
+            }
+        }, "block matrix diagonal");
+    }
+
+    /******************************************************************************//**
+     * @brief Jacobi preconditioner, Output = Input / Diagonal
+    **********************************************************************************/
+    void precondition(const Plato::ScalarVector & aDiagonal, const Plato::ScalarVector & aInput, const Plato::ScalarVector & aOutput)
+    {
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, aInput.size()), LAMBDA_EXPRESSION(const Plato::OrdinalType & aOrdinal)
+        {
+            aOutput(aOrdinal) = aInput(aOrdinal) / aDiagonal(aOrdinal);
+        }, "Jacobi preconditioner");
+    }
+
+    /******************************************************************************//**
+     * @brief Jacobi preconditioned conjugate gradient on the constrained stiffness
+    **********************************************************************************/
+    void conjugateGradient(const Plato::ScalarVector & aRhs, const Plato::ScalarVector & aSolution)
+    {
+        const Plato::OrdinalType tLength = aRhs.size();
+        Plato::ScalarVector tDiagonal("CgDiagonal", tLength);
+        Plato::ScalarVector tResidual("CgResidual", tLength);
+        Plato::ScalarVector tPrecResidual("CgPrecResidual", tLength);
+        Plato::ScalarVector tDirection("CgDirection", tLength);
+        Plato::ScalarVector tProduct("CgProduct", tLength);
+        this->diagonal(mStiffness, tDiagonal);
+
+        Plato::fill(static_cast<Plato::Scalar>(0.0), aSolution);
+        Kokkos::deep_copy(tResidual, aRhs);
+        const Plato::Scalar tRhsNorm = std::sqrt(Plato::dot(aRhs, aRhs));
+        if(tRhsNorm == static_cast<Plato::Scalar>(0.0))
+        {
+            return;
+        }
+        this->precondition(tDiagonal, tResidual, tPrecResidual);
+        Kokkos::deep_copy(tDirection, tPrecResidual);
+        Plato::Scalar tResidualDotPrec = Plato::dot(tResidual, tPrecResidual);
+        for(Plato::OrdinalType tIteration = 0; tIteration < mNumSolverIterations; tIteration++)
+        {
+            this->apply(mStiffness, tDirection, tProduct);
+            const Plato::Scalar tStep = tResidualDotPrec / Plato::dot(tDirection, tProduct);
+            Plato::axpy(tStep, tDirection, aSolution);
+            Plato::axpy(-tStep, tProduct, tResidual);
+            if(std::sqrt(Plato::dot(tResidual, tResidual)) <= static_cast<Plato::Scalar>(1e-12) * tRhsNorm)
+            {
+                break;
+            }
+            this->precondition(tDiagonal, tResidual, tPrecResidual);
+            const Plato::Scalar tNewResidualDotPrec = Plato::dot(tResidual, tPrecResidual);
+            Plato::update(static_cast<Plato::Scalar>(1.0), tPrecResidual, tNewResidualDotPrec / tResidualDotPrec, tDirection);
+            tResidualDotPrec = tNewResidualDotPrec;
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Output = K^{-1} Input on the unconstrained dofs
+    **********************************************************************************/
+    void applyStiffnessInverse(const Plato::ScalarVector & aInput, const Plato::ScalarVector & aOutput)
+    {
+        mNumStiffnessSolves++;
+        Kokkos::deep_copy(mSolverRhs, aInput);
+        this->zeroConstrainedDofs(mRealBcDofs, mSolverRhs);
+#ifdef HAVE_AMGX
+        Plato::fill(static_cast<Plato::Scalar>(0.0), mSolverLhs);
+        if(mSolver == nullptr)
+        {
+            auto tConfigString = AmgXLinearProblem::getConfigString(mNumSolverIterations);
+            mSolver = std::make_shared<AmgXLinearProblem>(*mStiffness, mSolverLhs, mSolverRhs, tConfigString);
+        }
+        else
+        {
+            mSolver->setRHS(mSolverRhs);
+            mSolver->setInitialGuess(mSolverLhs);
+        }
+        mSolver->solve();
+#else
+        this->conjugateGradient(mSolverRhs, mSolverLhs);
+#endif
+        Kokkos::deep_copy(aOutput, mSolverLhs);
+    }
+
+    /******************************************************************************//**
+     * @brief Shift-invert Lanczos with full reorthogonalization in the M inner product
+     * @param [in] aNumModes number of eigenpairs requested
+     * @param [in] aNumVectors maximum dimension of the Krylov subspace
+     * @return true if every requested eigenpair meets the eigen tolerance
+    **********************************************************************************/
+    bool lanczos(const Plato::OrdinalType & aNumModes, const Plato::OrdinalType & aNumVectors)
+    {
+        const Plato::OrdinalType tLength = mNumNodes * SpaceDim;
+        Plato::ScalarMultiVector tBasis("LanczosBasis", aNumVectors, tLength);
+        Plato::ScalarMultiVector tMassBasis("LanczosMassBasis", aNumVectors, tLength);
+        Plato::ScalarVector tWork("LanczosWork", tLength);
+        Plato::ScalarVector tMassWork("LanczosMassWork", tLength);
+        std::vector<Plato::Scalar> tDiag, tOffDiag;
+
+        this->initialVector(tWork);
+        this->apply(mMass, tWork, tMassWork);
+        Plato::Scalar tNorm = std::sqrt(Plato::dot(tWork, tMassWork));
+        for(Plato::OrdinalType tIndex = 0; tIndex < aNumVectors; tIndex++)
+        {
+            Plato::ScalarVector tVector = Kokkos::subview(tBasis, tIndex, Kokkos::ALL());
+            Plato::ScalarVector tMassVector = Kokkos::subview(tMassBasis, tIndex, Kokkos::ALL());
+            Plato::update(static_cast<Plato::Scalar>(1.0) / tNorm, tWork, static_cast<Plato::Scalar>(0.0), tVector);
+            Plato::update(static_cast<Plato::Scalar>(1.0) / tNorm, tMassWork, static_cast<Plato::Scalar>(0.0), tMassVector);
+
+            // w = K^{-1} M q_j, orthogonalized twice against every previous vector
+            this->applyStiffnessInverse(tMassVector, tWork);
+            tDiag.push_back(Plato::dot(tWork, tMassVector));
+            for(Plato::OrdinalType tPass = 0; tPass < 2; tPass++)
+            {
+                for(Plato::OrdinalType tPrevious = 0; tPrevious <= tIndex; tPrevious++)
+                {
+                    Plato::ScalarVector tPrevVector = Kokkos::subview(tBasis, tPrevious, Kokkos::ALL());
+                    Plato::ScalarVector tPrevMassVector = Kokkos::subview(tMassBasis, tPrevious, Kokkos::ALL());
+                    Plato::axpy(-Plato::dot(tWork, tPrevMassVector), tPrevVector, tWork);
+                }
+            }
+            this->apply(mMass, tWork, tMassWork);
+            tNorm = std::sqrt(std::max(Plato::dot(tWork, tMassWork), static_cast<Plato::Scalar>(0.0)));
+            // an invariant subspace has been found
+            if(tNorm <= 100.0 * std::numeric_limits<Plato::Scalar>::epsilon() * std::abs(tDiag.back()) || tIndex + 1 == aNumVectors)
+            {
+                break;
+            }
+            tOffDiag.push_back(tNorm);
+        }
+
+        // Ritz pairs; theta = 1 / lambda, the largest theta are the lowest eigenvalues
+        const Plato::OrdinalType tNumVectors = tDiag.size();
+        std::vector<Plato::Scalar> tMatrix(tNumVectors * tNumVectors, 0.0);
+        for(Plato::OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+        {
+            tMatrix[tIndex * tNumVectors + tIndex] = tDiag[tIndex];
+            if(tIndex + 1 < tNumVectors)
+            {
+                tMatrix[tIndex * tNumVectors + tIndex + 1] = tOffDiag[tIndex];
+                tMatrix[(tIndex + 1) * tNumVectors + tIndex] = tOffDiag[tIndex];
+            }
+        }
+        std::vector<Plato::Scalar> tTheta, tVectors;
+        symmetricEigen(tNumVectors, tMatrix, tTheta, tVectors);
+        // theta vanishes on the null space of M, which holds no finite eigenvalue
+        const Plato::Scalar tMaxTheta = *std::max_element(tTheta.begin(), tTheta.end());
+        std::vector<Plato::OrdinalType> tOrder;
+        for(Plato::OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+        {
+            if(tTheta[tIndex] > std::sqrt(std::numeric_limits<Plato::Scalar>::epsilon()) * tMaxTheta)
+            {
+                tOrder.push_back(tIndex);
+            }
+        }
+        std::sort(tOrder.begin(), tOrder.end(), [&](Plato::OrdinalType aA, Plato::OrdinalType aB)
+        {   return tTheta[aA] > tTheta[aB];});
+        const Plato::OrdinalType tNumModes = std::min(aNumModes, static_cast<Plato::OrdinalType>(tOrder.size()));
+
+        // mode shapes phi_i = sum_j s_ji q_j
+        Plato::ScalarMultiVector tCoefficients("RitzCoefficients", tNumModes, tNumVectors);
+        auto tHostCoefficients = Kokkos::create_mirror_view(tCoefficients);
+        mEigenvalues.resize(tNumModes);
+        for(Plato::OrdinalType tMode = 0; tMode < tNumModes; tMode++)
+        {
+            mEigenvalues[tMode] = static_cast<Plato::Scalar>(1.0) / tTheta[tOrder[tMode]];
+            for(Plato::OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+            {
+                tHostCoefficients(tMode, tIndex) = tVectors[tIndex * tNumVectors + tOrder[tMode]];
+            }
+        }
+        Kokkos::deep_copy(tCoefficients, tHostCoefficients);
+        mModes = Plato::ScalarMultiVector("Modes", tNumModes, tLength);
+        auto tModes = mModes;
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tLength), LAMBDA_EXPRESSION(const Plato::OrdinalType & aDofOrdinal)
+        {
+            for(Plato::OrdinalType tMode = 0; tMode < tNumModes; tMode++)
+            {
+                Plato::Scalar tSum = 0.0;
+                for(Plato::OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+                {
+                    tSum += tCoefficients(tMode, tIndex) * tBasis(tIndex, aDofOrdinal);
+                }
+                tModes(tMode, aDofOrdinal) = tSum;
+            }
+        }, "Ritz vectors");
+
+        // residual of every Ritz pair, ||K phi - lambda M phi|| / (lambda ||M phi||)
+        bool tConverged = (tNumModes == aNumModes);
+        for(Plato::OrdinalType tMode = 0; tMode < tNumModes && tConverged; tMode++)
+        {
+            Plato::ScalarVector tModeShape = Kokkos::subview(mModes, tMode, Kokkos::ALL());
+            this->apply(mStiffness, tModeShape, tWork);
+            this->apply(mMass, tModeShape, tMassWork);
+            const Plato::Scalar tMassNorm = std::sqrt(Plato::dot(tMassWork, tMassWork));
+            Plato::axpy(-mEigenvalues[tMode], tMassWork, tWork);
+            const Plato::Scalar tResidualNorm = std::sqrt(Plato::dot(tWork, tWork));
+            tConverged = tResidualNorm <= mEigenTolerance * std::abs(mEigenvalues[tMode]) * tMassNorm;
+        }
+        return (tConverged || tNumVectors < aNumVectors);
+    }
+
+private:
+    /******************************************************************************/
+    void setConstrainedDofs(const Plato::LocalOrdinalVector & aBcDofs)
+    /******************************************************************************/
+    {
+        Kokkos::resize(mBcDofs, aBcDofs.size());
+        Kokkos::deep_copy(mBcDofs, aBcDofs);
+
+        // constrained real displacements, numbered node * SpaceDim + dim
+        auto tHostBcDofs = Kokkos::create_mirror_view(aBcDofs);
+        Kokkos::deep_copy(tHostBcDofs, aBcDofs);
+        std::vector<Plato::OrdinalType> tRealBcDofs;
+        for(Plato::OrdinalType tIndex = 0; tIndex < static_cast<Plato::OrdinalType>(tHostBcDofs.size()); tIndex++)
+        {
+            auto tNode = tHostBcDofs(tIndex) / mNumDofsPerNode;
+            auto tDof = tHostBcDofs(tIndex) % mNumDofsPerNode;
+            if(tDof < SpaceDim)
+            {
+                tRealBcDofs.push_back(tNode * SpaceDim + tDof);
+            }
+        }
+        std::sort(tRealBcDofs.begin(), tRealBcDofs.end());
+        tRealBcDofs.erase(std::unique(tRealBcDofs.begin(), tRealBcDofs.end()), tRealBcDofs.end());
+
+        mRealBcDofs = Plato::LocalOrdinalVector("RealBcDofs", tRealBcDofs.size());
+        auto tHostRealBcDofs = Kokkos::create_mirror_view(mRealBcDofs);
+        for(size_t tIndex = 0; tIndex < tRealBcDofs.size(); tIndex++)
+        {
+            tHostRealBcDofs(tIndex) = tRealBcDofs[tIndex];
+        }
+        Kokkos::deep_copy(mRealBcDofs, tHostRealBcDofs);
+        mNumFreeDofs = mNumNodes * SpaceDim - static_cast<Plato::OrdinalType>(tRealBcDofs.size());
+    }
+
+    /******************************************************************************//**
+     * @brief Cyclic Jacobi eigensolver for a small dense symmetric matrix (host)
+     * @param [in] aSize matrix dimension
+     * @param [in] aMatrix row major matrix, overwritten
+     * @param [out] aValues eigenvalues
+     * @param [out] aVectors row major eigenvectors, one per column
+    **********************************************************************************/
+    static void symmetricEigen(const Plato::OrdinalType & aSize,
+                               std::vector<Plato::Scalar> & aMatrix,
+                               std::vector<Plato::Scalar> & aValues,
+                               std::vector<Plato::Scalar> & aVectors)
+    {
+        aVectors.assign(aSize * aSize, 0.0);
+        for(Plato::OrdinalType tIndex = 0; tIndex < aSize; tIndex++)
+        {
+            aVectors[tIndex * aSize + tIndex] = 1.0;
+        }
+        const Plato::OrdinalType tMaxSweeps = 100;
+        for(Plato::OrdinalType tSweep = 0; tSweep < tMaxSweeps; tSweep++)
+        {
+            Plato::Scalar tOffNorm = 0.0, tNorm = 0.0;
+            for(Plato::OrdinalType tRow = 0; tRow < aSize; tRow++)
+            {
+                for(Plato::OrdinalType tCol = 0; tCol < aSize; tCol++)
+                {
+                    auto tValue = aMatrix[tRow * aSize + tCol] * aMatrix[tRow * aSize + tCol];
+                    tNorm += tValue;
+                    tOffNorm += (tRow != tCol) ? tValue : 0.0;
+                }
+            }
+            if(tOffNorm <= std::numeric_limits<Plato::Scalar>::epsilon() * std::numeric_limits<Plato::Scalar>::epsilon() * tNorm)
+            {
+                break;
+            }
+            for(Plato::OrdinalType tP = 0; tP < aSize; tP++)
+            {
+                for(Plato::OrdinalType tQ = tP + 1; tQ < aSize; tQ++)
+                {
+                    const Plato::Scalar tApq = aMatrix[tP * aSize + tQ];
+                    if(tApq == static_cast<Plato::Scalar>(0.0))
+                    {
+                        continue;
+                    }
+                    const Plato::Scalar tTau = (aMatrix[tQ * aSize + tQ] - aMatrix[tP * aSize + tP]) / (2.0 * tApq);
+                    const Plato::Scalar tT = (tTau >= 0.0 ? 1.0 : -1.0) / (std::abs(tTau) + std::sqrt(1.0 + tTau * tTau));
+                    const Plato::Scalar tC = 1.0 / std::sqrt(1.0 + tT * tT);
+                    const Plato::Scalar tS = tT * tC;
+                    for(Plato::OrdinalType tK = 0; tK < aSize; tK++)
+                    {
+                        const Plato::Scalar tAkp = aMatrix[tK * aSize + tP];
+                        const Plato::Scalar tAkq = aMatrix[tK * aSize + tQ];
+                        aMatrix[tK * aSize + tP] = tC * tAkp - tS * tAkq;
+                        aMatrix[tK * aSize + tQ] = tS * tAkp + tC * tAkq;
+                    }
+                    for(Plato::OrdinalType tK = 0; tK < aSize; tK++)
+                    {
+                        const Plato::Scalar tApk = aMatrix[tP * aSize + tK];
+                        const Plato::Scalar tAqk = aMatrix[tQ * aSize + tK];
+                        aMatrix[tP * aSize + tK] = tC * tApk - tS * tAqk;
+                        aMatrix[tQ * aSize + tK] = tS * tApk + tC * tAqk;
+                    }
+                    for(Plato::OrdinalType tK = 0; tK < aSize; tK++)
+                    {
+                        const Plato::Scalar tVkp = aVectors[tK * aSize + tP];
+                        const Plato::Scalar tVkq = aVectors[tK * aSize + tQ];
+                        aVectors[tK * aSize + tP] = tC * tVkp - tS * tVkq;
+                        aVectors[tK * aSize + tQ] = tS * tVkp + tC * tVkq;
+                    }
+                }
+            }
+        }
+        aValues.resize(aSize);
+        for(Plato::OrdinalType tIndex = 0; tIndex < aSize; tIndex++)
+        {
+            aValues[tIndex] = aMatrix[tIndex * aSize + tIndex];
+        }
+    }
+};
+// class ModalSuperposition
+
+} // namespace Plato
+
+#endif /* MODALSUPERPOSITION_HPP_ */
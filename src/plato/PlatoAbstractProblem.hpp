@@ -7,6 +7,8 @@
 #ifndef PLATOABSTRACTPROBLEM_HPP_
 #define PLATOABSTRACTPROBLEM_HPP_
 
+#include <stdexcept>
+
 #include <Teuchos_RCPDecl.hpp>
 
 #include "plato/PlatoStaticsTypes.hpp"
@@ -81,6 +83,20 @@ public:
     virtual Plato::ScalarVector
     objectiveGradientX(const Plato::ScalarVector & aControl, const Plato::ScalarMultiVector & aState)=0;
 
+    // Functions associated with second-order optimizers. Problems that do not
+    // provide reduced Hessian-vector products keep these defaults.
+    virtual Plato::ScalarVector
+    objectiveHessianTimesVector(const Plato::ScalarVector &, const Plato::ScalarMultiVector &, const Plato::ScalarVector &)
+    {
+        throw std::runtime_error("Objective Hessian-vector products are not implemented for this problem.");
+    }
+
+    virtual Plato::ScalarVector
+    constraintHessianTimesVector(const Plato::ScalarVector &, const Plato::ScalarMultiVector &, const Plato::ScalarVector &)
+    {
+        throw std::runtime_error("Constraint Hessian-vector products are not implemented for this problem.");
+    }
+
     Plato::DataMap mDataMap;
     decltype(mDataMap)& getDataMap()
     {
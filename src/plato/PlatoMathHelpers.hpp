@@ -77,6 +77,36 @@ void update(const ScalarT & aAlpha, const VectorT & aInput, const ScalarT & aBet
     }, "update vector");
 } // function update
 
+/******************************************************************************/
+template<typename VectorT>
+Plato::Scalar norm_inf(const VectorT & aVector)
+/******************************************************************************/
+{
+    Plato::Scalar tOutput = 0.0;
+    Plato::OrdinalType tNumLocalVals = aVector.size();
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<>(0, tNumLocalVals), LAMBDA_EXPRESSION(const Plato::OrdinalType & aOrdinal, Plato::Scalar & aMax)
+    {
+        Plato::Scalar tValue = aVector(aOrdinal) < 0.0 ? -aVector(aOrdinal) : aVector(aOrdinal);
+        aMax = tValue > aMax ? tValue : aMax;
+    }, Kokkos::Max<Plato::Scalar>(tOutput));
+    return tOutput;
+} // function norm_inf
+
+/******************************************************************************/
+template<typename VectorT>
+Plato::Scalar dot(const VectorT & aVector1, const VectorT & aVector2)
+/******************************************************************************/
+{
+    assert(aVector1.size() == aVector2.size());
+    Plato::Scalar tOutput = 0.0;
+    Plato::OrdinalType tNumLocalVals = aVector1.size();
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<>(0, tNumLocalVals), LAMBDA_EXPRESSION(const Plato::OrdinalType & aOrdinal, Plato::Scalar & aSum)
+    {
+        aSum += aVector1(aOrdinal) * aVector2(aOrdinal);
+    }, tOutput);
+    return tOutput;
+} // function dot
+
 /******************************************************************************/
 template<typename ScalarT>
 void MatrixTimesVectorPlusVector(const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix,
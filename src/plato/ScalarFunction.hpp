@@ -199,8 +199,18 @@ class ScalarFunction : public WorksetBase<PhysicsT>
       // create and assemble to return view
       //
       Plato::ScalarVector tObjGradientX("objective gradient configuration",m_numSpatialDims*m_numNodes);
-      Plato::assemble_vector_gradient<m_numNodesPerCell, m_numSpatialDims>(m_numCells, m_configEntryOrdinal, tResult, tObjGradientX);
-      Plato::Scalar tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(m_numCells, tResult);
+      Plato::Scalar tObjectiveValue = 0.0;
+      auto tActiveCells = mScalarFunctionGradientX->getActiveCells();
+      if(tActiveCells.size() > 0)
+      {
+        Plato::assemble_vector_gradient<m_numNodesPerCell, m_numSpatialDims>(tActiveCells, m_configEntryOrdinal, tResult, tObjGradientX);
+        tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(tActiveCells, tResult);
+      }
+      else
+      {
+        Plato::assemble_vector_gradient<m_numNodesPerCell, m_numSpatialDims>(m_numCells, m_configEntryOrdinal, tResult, tObjGradientX);
+        tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(m_numCells, tResult);
+      }
 
       mScalarFunctionGradientX->postEvaluate( tObjGradientX, tObjectiveValue );
 
@@ -248,8 +258,18 @@ class ScalarFunction : public WorksetBase<PhysicsT>
       // create and assemble to return view
       //
       Plato::ScalarVector tObjGradientU("objective gradient state",m_numDofsPerNode*m_numNodes);
-      Plato::assemble_vector_gradient<m_numNodesPerCell, m_numDofsPerNode>(m_numCells, m_stateEntryOrdinal, tResult, tObjGradientU);
-      Plato::Scalar tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(m_numCells, tResult);
+      Plato::Scalar tObjectiveValue = 0.0;
+      auto tActiveCells = mScalarFunctionGradientU->getActiveCells();
+      if(tActiveCells.size() > 0)
+      {
+        Plato::assemble_vector_gradient<m_numNodesPerCell, m_numDofsPerNode>(tActiveCells, m_stateEntryOrdinal, tResult, tObjGradientU);
+        tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(tActiveCells, tResult);
+      }
+      else
+      {
+        Plato::assemble_vector_gradient<m_numNodesPerCell, m_numDofsPerNode>(m_numCells, m_stateEntryOrdinal, tResult, tObjGradientU);
+        tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(m_numCells, tResult);
+      }
 
       mScalarFunctionGradientU->postEvaluate( tObjGradientU, tObjectiveValue );
 
@@ -297,8 +317,18 @@ class ScalarFunction : public WorksetBase<PhysicsT>
       // create and assemble to return view
       //
       Plato::ScalarVector tObjGradientZ("objective gradient control",m_numNodes);
-      Plato::assemble_scalar_gradient<m_numNodesPerCell>(m_numCells, m_controlEntryOrdinal, tResult, tObjGradientZ);
-      Plato::Scalar tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(m_numCells, tResult);
+      Plato::Scalar tObjectiveValue = 0.0;
+      auto tActiveCells = mScalarFunctionGradientZ->getActiveCells();
+      if(tActiveCells.size() > 0)
+      {
+        Plato::assemble_scalar_gradient<m_numNodesPerCell>(tActiveCells, m_controlEntryOrdinal, tResult, tObjGradientZ);
+        tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(tActiveCells, tResult);
+      }
+      else
+      {
+        Plato::assemble_scalar_gradient<m_numNodesPerCell>(m_numCells, m_controlEntryOrdinal, tResult, tObjGradientZ);
+        tObjectiveValue = Plato::assemble_scalar_func_value<Plato::Scalar>(m_numCells, tResult);
+      }
 
       mScalarFunctionGradientZ->postEvaluate( tObjGradientZ, tObjectiveValue );
 
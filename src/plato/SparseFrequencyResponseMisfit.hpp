@@ -0,0 +1,524 @@
+/*
+ * SparseFrequencyResponseMisfit.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_PLATO_SPARSEFREQUENCYRESPONSEMISFIT_HPP_
+#define SRC_PLATO_SPARSEFREQUENCYRESPONSEMISFIT_HPP_
+
+#include <map>
+#include <cmath>
+#include <cassert>
+#include <limits>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+
+#include <Omega_h_mesh.hpp>
+#include <Omega_h_matrix.hpp>
+#include <Omega_h_defines.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ParameterList.hpp>
+
+#include "plato/SimplexFadTypes.hpp"
+#include "plato/PlatoStaticsTypes.hpp"
+#include "plato/AbstractScalarFunction.hpp"
+#include "plato/SimplexStructuralDynamics.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************/
+/*! Barycentric coordinates of a point with respect to a simplex cell, i.e. the
+ *  values of the linear basis functions of the cell at the point. The arrays
+ *  may be device (Omega_h::Read) or host (Omega_h::HostRead) arrays.
+*/
+/******************************************************************************/
+template<Plato::OrdinalType SpaceDim, typename Cells2NodesT, typename CoordsT>
+DEVICE_TYPE inline Omega_h::Vector<SpaceDim + 1>
+barycentric_coordinates(const Plato::OrdinalType & aCellOrdinal,
+                        const Cells2NodesT & aCells2Nodes,
+                        const CoordsT & aCoords,
+                        const Omega_h::Vector<SpaceDim> & aPoint)
+{
+    Omega_h::Vector<SpaceDim> tOrigin;
+    Omega_h::Matrix<SpaceDim, SpaceDim> tJacobian;
+    const Plato::OrdinalType tFirstNode = aCells2Nodes[aCellOrdinal * (SpaceDim + 1)];
+    for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+    {
+        tOrigin[tDim] = aCoords[tFirstNode * SpaceDim + tDim];
+    }
+    for(Plato::OrdinalType tNode = 1; tNode <= SpaceDim; tNode++)
+    {
+        const Plato::OrdinalType tVertex = aCells2Nodes[aCellOrdinal * (SpaceDim + 1) + tNode];
+        for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+        {
+            tJacobian[tNode - 1][tDim] = aCoords[tVertex * SpaceDim + tDim] - tOrigin[tDim];
+        }
+    }
+    auto tLocal = Omega_h::invert(tJacobian) * (aPoint - tOrigin);
+    Omega_h::Vector<SpaceDim + 1> tOutput;
+    tOutput[0] = 1.0;
+    for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+    {
+        tOutput[tDim + 1] = tLocal[tDim];
+        tOutput[0] -= tLocal[tDim];
+    }
+    return tOutput;
+}
+
+/******************************************************************************/
+/*! Frequency response function misfit measured at a sparse set of sensors,
+ *  i.e. \frac{1}{2}\sum_s (u^s(x_s) - u^e_s)^2, where u^s(x_s) is the trial
+ *  state interpolated to the location of sensor s and u^e_s is the measured
+ *  (real and imaginary) response at that sensor.
+ *
+ *  The cell containing each sensor and its interpolation weights are found
+ *  once at construction, using a uniform grid of cell bounding boxes. Measured
+ *  data are stored per frequency and sensor, and evaluate only visits the
+ *  cells that contain a sensor. All other cells keep the zero value of the
+ *  freshly allocated result workset, and getActiveCells lets ScalarFunction
+ *  skip them when it scatters the gradients.
+*/
+/******************************************************************************/
+template<typename EvaluationType>
+class SparseFrequencyResponseMisfit :
+        public Plato::SimplexStructuralDynamics<EvaluationType::SpatialDim, EvaluationType::NumControls>,
+        public AbstractScalarFunction<EvaluationType>
+{
+private:
+    static constexpr Plato::OrdinalType SpaceDim = EvaluationType::SpatialDim;
+
+    using Plato::SimplexStructuralDynamics<SpaceDim>::m_numDofsPerNode;
+    using Plato::SimplexStructuralDynamics<SpaceDim>::m_numNodesPerCell;
+
+    using StateScalarType = typename EvaluationType::StateScalarType;
+    using ControlScalarType = typename EvaluationType::ControlScalarType;
+    using ConfigScalarType = typename EvaluationType::ConfigScalarType;
+    using ResultScalarType = typename EvaluationType::ResultScalarType;
+
+    std::map<Plato::Scalar, Plato::OrdinalType> mFrequencyIndex;
+
+    Plato::ScalarArray3D mSensorData; /*!< measurements: frequency x sensor x dof */
+    Plato::ScalarMultiVector mSensorWeights; /*!< basis values: sensor x cell node */
+    Plato::LocalOrdinalVector mSensorCells; /*!< cells containing at least one sensor */
+    Plato::LocalOrdinalVector mSensorCellOffsets; /*!< sensor cell -> first entry in mSensorOrder */
+    Plato::LocalOrdinalVector mSensorOrder; /*!< sensors sorted by containing cell */
+
+public:
+    /*************************************************************************/
+    explicit SparseFrequencyResponseMisfit(Omega_h::Mesh& aMesh,
+                                           Omega_h::MeshSets& aMeshSets,
+                                           Plato::DataMap aDataMap,
+                                           Teuchos::ParameterList & aParamList) :
+            AbstractScalarFunction<EvaluationType>(aMesh, aMeshSets, aDataMap, "Sparse Frequency Response Misfit")
+    /*************************************************************************/
+    {
+        auto tFrequencies = this->readFrequencies(aParamList);
+        this->setFrequencies(tFrequencies);
+        this->readSensors(aMesh, aParamList.sublist("Sparse Frequency Response Misfit"), tFrequencies.size());
+    }
+
+    /*************************************************************************/
+    explicit SparseFrequencyResponseMisfit(Omega_h::Mesh& aMesh,
+                                           Omega_h::MeshSets& aMeshSets,
+                                           Plato::DataMap aDataMap,
+                                           const std::vector<Plato::Scalar> & aFrequencies,
+                                           const std::vector<Plato::Scalar> & aSensorCoords,
+                                           const Plato::ScalarArray3D & aSensorData) :
+            AbstractScalarFunction<EvaluationType>(aMesh, aMeshSets, aDataMap, "Sparse Frequency Response Misfit"),
+            mSensorData(aSensorData)
+    /*************************************************************************/
+    {
+        this->setFrequencies(aFrequencies);
+        this->locateSensors(aMesh, aSensorCoords);
+    }
+
+    /*************************************************************************/
+    virtual ~SparseFrequencyResponseMisfit()
+    /*************************************************************************/
+    {
+    }
+
+    /*************************************************************************/
+    Plato::OrdinalType getNumSensors() const
+    /*************************************************************************/
+    {
+        return mSensorOrder.size();
+    }
+
+    /*************************************************************************/
+    Plato::OrdinalType getNumSensorCells() const
+    /*************************************************************************/
+    {
+        return mSensorCells.size();
+    }
+
+    /*************************************************************************/
+    Plato::LocalOrdinalVector getActiveCells() const override
+    /*************************************************************************/
+    {
+        return mSensorCells;
+    }
+
+    /*************************************************************************/
+    void evaluate(const Plato::ScalarMultiVectorT<StateScalarType> & aStates,
+                  const Plato::ScalarMultiVectorT<ControlScalarType> & aControls,
+                  const Plato::ScalarArray3DT<ConfigScalarType> & aConfig,
+                  Plato::ScalarVectorT<ResultScalarType> & aResults,
+                  Plato::Scalar aTimeStep = 0.0) const
+    /*************************************************************************/
+    {
+        auto tFrequencyIndex = this->getFrequencyIndex(aTimeStep);
+        auto tMeasured = Kokkos::subview(mSensorData, tFrequencyIndex, Kokkos::ALL(), Kokkos::ALL());
+        auto tWeights = mSensorWeights;
+        auto tSensorCells = mSensorCells;
+        auto tOffsets = mSensorCellOffsets;
+        auto tOrder = mSensorOrder;
+        auto tNumDofsPerNode = m_numDofsPerNode;
+        auto tNumNodesPerCell = m_numNodesPerCell;
+
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tSensorCells.size()), LAMBDA_EXPRESSION(const Plato::OrdinalType & aOrdinal)
+        {
+            const Plato::OrdinalType tCellOrdinal = tSensorCells(aOrdinal);
+            ResultScalarType tValue = 0.0;
+            for(Plato::OrdinalType tEntry = tOffsets(aOrdinal); tEntry < tOffsets(aOrdinal + 1); tEntry++)
+            {
+                const Plato::OrdinalType tSensor = tOrder(tEntry);
+                for(Plato::OrdinalType tDof = 0; tDof < tNumDofsPerNode; tDof++)
+                {
+                    ResultScalarType tMisfit = -tMeasured(tSensor, tDof);
+                    for(Plato::OrdinalType tNode = 0; tNode < tNumNodesPerCell; tNode++)
+                    {
+                        tMisfit += tWeights(tSensor, tNode) * aStates(tCellOrdinal, tNumDofsPerNode * tNode + tDof);
+                    }
+                    tValue += tMisfit * tMisfit;
+                }
+            }
+            aResults(tCellOrdinal) = static_cast<Plato::Scalar>(0.5) * tValue;
+        }, "Objective::SparseFrequencyResponseMisfit");
+    }
+
+private:
+    /**************************************************************************/
+    void setFrequencies(const std::vector<Plato::Scalar> & aFrequencies)
+    /**************************************************************************/
+    {
+        mFrequencyIndex.clear();
+        for(size_t tIndex = 0; tIndex < aFrequencies.size(); tIndex++)
+        {
+            mFrequencyIndex[aFrequencies[tIndex]] = tIndex;
+        }
+    }
+
+    /**************************************************************************/
+    Plato::OrdinalType getFrequencyIndex(const Plato::Scalar & aFrequency) const
+    /**************************************************************************/
+    {
+        auto tIterator = mFrequencyIndex.find(aFrequency);
+        if(tIterator == mFrequencyIndex.end())
+        {
+            std::ostringstream tErrorMessage;
+            tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                    << ", LINE: " << __LINE__ << ", MESSAGE: NO SENSOR DATA FOR FREQUENCY = " << aFrequency
+                    << ". CHECK FREQUENCY STEPS IN THE INPUT FILE. **************\n\n";
+            throw std::runtime_error(tErrorMessage.str().c_str());
+        }
+        return tIterator->second;
+    }
+
+    /**************************************************************************/
+    std::vector<Plato::Scalar> readFrequencies(Teuchos::ParameterList & aParamList)
+    /**************************************************************************/
+    {
+        if(aParamList.isSublist("Frequency Steps") == false)
+        {
+            std::ostringstream tErrorMessage;
+            tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                    << ", LINE: " << __LINE__ << ", MESSAGE: FREQUENCY ARRAY WAS NOT DEFINED IN THE INPUT FILE."
+                    << " USER SHOULD PROVIDE FREQUENCY ARRAY INFORMATION IN THE INPUT FILE. **************\n\n";
+            throw std::runtime_error(tErrorMessage.str().c_str());
+        }
+        auto tFreqValues = aParamList.sublist("Frequency Steps").get<Teuchos::Array<Plato::Scalar>>("Values");
+        return std::vector<Plato::Scalar>(tFreqValues.begin(), tFreqValues.end());
+    }
+
+    /**************************************************************************
+     * Read sensor locations ("Coordinates", SpaceDim values per sensor) and
+     * measurements ("Values", ordered by frequency, then sensor, then dof).
+     **************************************************************************/
+    void readSensors(Omega_h::Mesh& aMesh, Teuchos::ParameterList & aParams, Plato::OrdinalType aNumFrequencies)
+    /**************************************************************************/
+    {
+        if(aParams.isParameter("Coordinates") == false || aParams.isParameter("Values") == false)
+        {
+            std::ostringstream tErrorMessage;
+            tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                    << ", LINE: " << __LINE__ << ", MESSAGE: USER DID NOT DEFINE SENSOR COORDINATES AND VALUES ARRAYS"
+                    << " INSIDE SUBLIST = SPARSE FREQUENCY RESPONSE MISFIT. CHECK INPUT FILE. **************\n\n";
+            throw std::runtime_error(tErrorMessage.str().c_str());
+        }
+        auto tCoordValues = aParams.get<Teuchos::Array<Plato::Scalar>>("Coordinates");
+        auto tDataValues = aParams.get<Teuchos::Array<Plato::Scalar>>("Values");
+        const Plato::OrdinalType tNumSensors = tCoordValues.size() / SpaceDim;
+        const Plato::OrdinalType tExpectedNumValues = aNumFrequencies * tNumSensors * m_numDofsPerNode;
+        if(tCoordValues.size() != tNumSensors * SpaceDim || tDataValues.size() != tExpectedNumValues)
+        {
+            std::ostringstream tErrorMessage;
+            tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                    << ", LINE: " << __LINE__ << ", MESSAGE: DIMENSION MISSMATCH. PLATO EXPECTED " << tExpectedNumValues
+                    << " SENSOR VALUES FOR " << tNumSensors << " SENSORS. USER DEFINED " << tDataValues.size()
+                    << " SENSOR VALUES IN THE INPUT FILE. **************\n\n";
+            throw std::runtime_error(tErrorMessage.str().c_str());
+        }
+        mSensorData = Plato::ScalarArray3D("SensorData", aNumFrequencies, tNumSensors, m_numDofsPerNode);
+        auto tHostData = Kokkos::create_mirror(mSensorData);
+        Plato::OrdinalType tValueIndex = 0;
+        for(Plato::OrdinalType tFreq = 0; tFreq < aNumFrequencies; tFreq++)
+        {
+            for(Plato::OrdinalType tSensor = 0; tSensor < tNumSensors; tSensor++)
+            {
+                for(Plato::OrdinalType tDof = 0; tDof < m_numDofsPerNode; tDof++)
+                {
+                    tHostData(tFreq, tSensor, tDof) = tDataValues[tValueIndex++];
+                }
+            }
+        }
+        Kokkos::deep_copy(mSensorData, tHostData);
+        std::vector<Plato::Scalar> tCoords(tCoordValues.begin(), tCoordValues.end());
+        this->locateSensors(aMesh, tCoords);
+    }
+
+    /**************************************************************************
+     * Bin the cell bounding boxes into a uniform grid with about one cell per
+     * bin, then test each sensor only against the cells of its own bin, so
+     * the search costs O(nelems + nsensors) instead of O(nelems x nsensors).
+     **************************************************************************/
+    template<typename HostCells2Nodes, typename HostCoords, typename HostSensorToCell>
+    void findSensorCells(const Plato::OrdinalType & aNumCells,
+                         const HostCells2Nodes & aCells2Nodes,
+                         const HostCoords & aCoords,
+                         const std::vector<Plato::Scalar> & aSensorCoords,
+                         HostSensorToCell & aSensorToCell)
+    /**************************************************************************/
+    {
+        const Plato::OrdinalType tNumSensors = aSensorCoords.size() / SpaceDim;
+        const Plato::OrdinalType tNotFound = std::numeric_limits<Plato::OrdinalType>::max();
+        const Plato::Scalar tTolerance = 1e-10;
+
+        std::vector<Plato::Scalar> tCellMin(aNumCells * SpaceDim, std::numeric_limits<Plato::Scalar>::max());
+        std::vector<Plato::Scalar> tCellMax(aNumCells * SpaceDim, std::numeric_limits<Plato::Scalar>::lowest());
+        Omega_h::Vector<SpaceDim> tLower, tUpper;
+        for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+        {
+            tLower[tDim] = std::numeric_limits<Plato::Scalar>::max();
+            tUpper[tDim] = std::numeric_limits<Plato::Scalar>::lowest();
+        }
+        for(Plato::OrdinalType tCell = 0; tCell < aNumCells; tCell++)
+        {
+            for(Plato::OrdinalType tNode = 0; tNode <= SpaceDim; tNode++)
+            {
+                const Plato::OrdinalType tVertex = aCells2Nodes[tCell * (SpaceDim + 1) + tNode];
+                for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+                {
+                    const Plato::Scalar tX = aCoords[tVertex * SpaceDim + tDim];
+                    tCellMin[tCell * SpaceDim + tDim] = std::min(tCellMin[tCell * SpaceDim + tDim], tX);
+                    tCellMax[tCell * SpaceDim + tDim] = std::max(tCellMax[tCell * SpaceDim + tDim], tX);
+                    tLower[tDim] = std::min(tLower[tDim], tX);
+                    tUpper[tDim] = std::max(tUpper[tDim], tX);
+                }
+            }
+        }
+
+        const Plato::OrdinalType tBinsPerDim =
+                std::max(1, static_cast<Plato::OrdinalType>(std::pow(static_cast<Plato::Scalar>(aNumCells), 1.0 / SpaceDim)));
+        Omega_h::Vector<SpaceDim> tBinWidth;
+        for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+        {
+            tBinWidth[tDim] = std::max(tUpper[tDim] - tLower[tDim], tTolerance) / tBinsPerDim;
+        }
+        auto tBinIndex = [&](const Plato::Scalar & aX, const Plato::OrdinalType & aDim)
+        {
+            const Plato::OrdinalType tIndex = static_cast<Plato::OrdinalType>(std::floor((aX - tLower[aDim]) / tBinWidth[aDim]));
+            return std::min(std::max(tIndex, 0), tBinsPerDim - 1);
+        };
+
+        // bins are filled in increasing cell order, so each bin list is sorted
+        Plato::OrdinalType tNumBins = 1;
+        for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+        {
+            tNumBins *= tBinsPerDim;
+        }
+        std::vector<std::vector<Plato::OrdinalType>> tBins(tNumBins);
+        for(Plato::OrdinalType tCell = 0; tCell < aNumCells; tCell++)
+        {
+            Plato::OrdinalType tFirst[SpaceDim], tLast[SpaceDim], tCurrent[SpaceDim];
+            for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+            {
+                // pad by the barycentric tolerance scaled to the cell size
+                const Plato::Scalar tMin = tCellMin[tCell * SpaceDim + tDim];
+                const Plato::Scalar tMax = tCellMax[tCell * SpaceDim + tDim];
+                const Plato::Scalar tPad = tTolerance * (tMax - tMin + 1.0);
+                tFirst[tDim] = tBinIndex(tMin - tPad, tDim);
+                tLast[tDim] = tBinIndex(tMax + tPad, tDim);
+                tCurrent[tDim] = tFirst[tDim];
+            }
+            while(true)
+            {
+                Plato::OrdinalType tBin = 0;
+                for(Plato::OrdinalType tDim = SpaceDim - 1; tDim >= 0; tDim--)
+                {
+                    tBin = tBin * tBinsPerDim + tCurrent[tDim];
+                }
+                tBins[tBin].push_back(tCell);
+                Plato::OrdinalType tDim = 0;
+                while(tDim < SpaceDim && tCurrent[tDim] == tLast[tDim])
+                {
+                    tCurrent[tDim] = tFirst[tDim];
+                    tDim++;
+                }
+                if(tDim == SpaceDim)
+                {
+                    break;
+                }
+                tCurrent[tDim]++;
+            }
+        }
+
+        for(Plato::OrdinalType tSensor = 0; tSensor < tNumSensors; tSensor++)
+        {
+            Omega_h::Vector<SpaceDim> tPoint;
+            Plato::OrdinalType tBin = 0;
+            for(Plato::OrdinalType tDim = SpaceDim - 1; tDim >= 0; tDim--)
+            {
+                tPoint[tDim] = aSensorCoords[tSensor * SpaceDim + tDim];
+                tBin = tBin * tBinsPerDim + tBinIndex(tPoint[tDim], tDim);
+            }
+            aSensorToCell(tSensor) = tNotFound;
+            for(auto tCell : tBins[tBin])
+            {
+                auto tBasis = Plato::barycentric_coordinates<SpaceDim>(tCell, aCells2Nodes, aCoords, tPoint);
+                bool tInside = true;
+                for(Plato::OrdinalType tNode = 0; tNode <= SpaceDim; tNode++)
+                {
+                    tInside = tInside && (tBasis[tNode] >= -tTolerance);
+                }
+                if(tInside)
+                {
+                    aSensorToCell(tSensor) = tCell;
+                    break;
+                }
+            }
+        }
+    }
+
+    /**************************************************************************
+     * Find the cell containing each sensor, its interpolation weights, and
+     * group the sensors by cell so evaluate needs no atomics.
+     **************************************************************************/
+    void locateSensors(Omega_h::Mesh& aMesh, const std::vector<Plato::Scalar> & aSensorCoords)
+    /**************************************************************************/
+    {
+        const Plato::OrdinalType tNumSensors = aSensorCoords.size() / SpaceDim;
+        assert(mSensorData.extent(1) == static_cast<size_t>(tNumSensors));
+
+        Plato::ScalarMultiVector tSensorCoords("SensorCoords", tNumSensors, SpaceDim);
+        auto tHostSensorCoords = Kokkos::create_mirror(tSensorCoords);
+        for(Plato::OrdinalType tSensor = 0; tSensor < tNumSensors; tSensor++)
+        {
+            for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+            {
+                tHostSensorCoords(tSensor, tDim) = aSensorCoords[tSensor * SpaceDim + tDim];
+            }
+        }
+        Kokkos::deep_copy(tSensorCoords, tHostSensorCoords);
+
+        // the lowest numbered cell containing the sensor owns it
+        const Plato::OrdinalType tNotFound = std::numeric_limits<Plato::OrdinalType>::max();
+        auto tCells2Nodes = aMesh.ask_elem_verts();
+        auto tCoords = aMesh.coords();
+        Plato::LocalOrdinalVector tSensorToCell("SensorToCell", tNumSensors);
+        auto tHostSensorToCell = Kokkos::create_mirror(tSensorToCell);
+        this->findSensorCells(aMesh.nelems(), Omega_h::HostRead<Omega_h::LO>(tCells2Nodes),
+                              Omega_h::HostRead<Omega_h::Real>(tCoords), aSensorCoords, tHostSensorToCell);
+        Kokkos::deep_copy(tSensorToCell, tHostSensorToCell);
+
+        mSensorWeights = Plato::ScalarMultiVector("SensorWeights", tNumSensors, m_numNodesPerCell);
+        auto tWeights = mSensorWeights;
+        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tNumSensors), LAMBDA_EXPRESSION(const Plato::OrdinalType & aSensor)
+        {
+            const Plato::OrdinalType tCellOrdinal = tSensorToCell(aSensor);
+            if(tCellOrdinal == tNotFound)
+            {
+                return;
+            }
+            Omega_h::Vector<SpaceDim> tPoint;
+            for(Plato::OrdinalType tDim = 0; tDim < SpaceDim; tDim++)
+            {
+                tPoint[tDim] = tSensorCoords(aSensor, tDim);
+            }
+            auto tBasis = Plato::barycentric_coordinates<SpaceDim>(tCellOrdinal, tCells2Nodes, tCoords, tPoint);
+            for(Plato::OrdinalType tNode = 0; tNode <= SpaceDim; tNode++)
+            {
+                tWeights(aSensor, tNode) = tBasis[tNode];
+            }
+        }, "SparseFrequencyResponseMisfit::sensorWeights");
+
+        // group sensors by cell on the host; there are only a few hundred
+        std::vector<std::pair<Plato::OrdinalType, Plato::OrdinalType>> tCellSensorPairs;
+        for(Plato::OrdinalType tSensor = 0; tSensor < tNumSensors; tSensor++)
+        {
+            if(tHostSensorToCell(tSensor) == tNotFound)
+            {
+                std::ostringstream tErrorMessage;
+                tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                        << ", LINE: " << __LINE__ << ", MESSAGE: SENSOR " << tSensor
+                        << " IS NOT INSIDE THE MESH. CHECK SENSOR COORDINATES IN THE INPUT FILE. **************\n\n";
+                throw std::runtime_error(tErrorMessage.str().c_str());
+            }
+            tCellSensorPairs.push_back(std::make_pair(tHostSensorToCell(tSensor), tSensor));
+        }
+        std::sort(tCellSensorPairs.begin(), tCellSensorPairs.end());
+
+        std::vector<Plato::OrdinalType> tCells;
+        std::vector<Plato::OrdinalType> tOffsets;
+        mSensorOrder = Plato::LocalOrdinalVector("SensorOrder", tNumSensors);
+        auto tHostOrder = Kokkos::create_mirror(mSensorOrder);
+        for(Plato::OrdinalType tEntry = 0; tEntry < tNumSensors; tEntry++)
+        {
+            if(tCells.empty() || tCells.back() != tCellSensorPairs[tEntry].first)
+            {
+                tCells.push_back(tCellSensorPairs[tEntry].first);
+                tOffsets.push_back(tEntry);
+            }
+            tHostOrder(tEntry) = tCellSensorPairs[tEntry].second;
+        }
+        tOffsets.push_back(tNumSensors);
+        Kokkos::deep_copy(mSensorOrder, tHostOrder);
+
+        mSensorCells = Plato::LocalOrdinalVector("SensorCells", tCells.size());
+        auto tHostCells = Kokkos::create_mirror(mSensorCells);
+        for(size_t tIndex = 0; tIndex < tCells.size(); tIndex++)
+        {
+            tHostCells(tIndex) = tCells[tIndex];
+        }
+        Kokkos::deep_copy(mSensorCells, tHostCells);
+
+        mSensorCellOffsets = Plato::LocalOrdinalVector("SensorCellOffsets", tOffsets.size());
+        auto tHostOffsets = Kokkos::create_mirror(mSensorCellOffsets);
+        for(size_t tIndex = 0; tIndex < tOffsets.size(); tIndex++)
+        {
+            tHostOffsets(tIndex) = tOffsets[tIndex];
+        }
+        Kokkos::deep_copy(mSensorCellOffsets, tHostOffsets);
+    }
+};
+// class SparseFrequencyResponseMisfit
+
+} // namespace Plato
+
+#endif /* SRC_PLATO_SPARSEFREQUENCYRESPONSEMISFIT_HPP_ */
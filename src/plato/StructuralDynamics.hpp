@@ -19,6 +19,7 @@
 #include "plato/DynamicCompliance.hpp"
 #include "plato/AbstractVectorFunction.hpp"
 #include "plato/StructuralDynamicsResidual.hpp"
+#include "plato/SparseFrequencyResponseMisfit.hpp"
 #include "plato/HyperbolicTangentProjection.hpp"
 #include "plato/AdjointStructuralDynamicsResidual.hpp"
 
@@ -88,6 +89,12 @@ struct FunctionFactory
                         (aMesh, aMeshSets, aDataMap, aParamList, tPenaltyParams);
             }
         }
+        else if(aFunctionType == "Sparse Frequency Response Misfit")
+        {
+            assert(aParamList.isSublist(aFunctionType));
+            assert(aParamList.isSublist("Frequency Steps"));
+            return std::make_shared<Plato::SparseFrequencyResponseMisfit<EvaluationType>>(aMesh, aMeshSets, aDataMap, aParamList);
+        }
         else
         {
             std::ostringstream tErrorMessage;
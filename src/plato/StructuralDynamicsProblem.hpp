@@ -7,8 +7,11 @@
 #ifndef STRUCTURALDYNAMICSPROBLEM_HPP_
 #define STRUCTURALDYNAMICSPROBLEM_HPP_
 
+#include <cmath>
 #include <memory>
 #include <vector>
+#include <complex>
+#include <algorithm>
 #include <sstream>
 
 #include <Omega_h_mesh.hpp>
@@ -23,7 +26,9 @@
 
 #include "plato/ScalarFunction.hpp"
 #include "plato/VectorFunction.hpp"
+#include "plato/PlatoMathHelpers.hpp"
 #include "plato/PlatoStaticsTypes.hpp"
+#include "plato/ModalSuperposition.hpp"
 #include "plato/PlatoAbstractProblem.hpp"
 #include "plato/SimplexStructuralDynamics.hpp"
 
@@ -61,6 +66,17 @@ private:
     std::vector<Plato::Scalar> mFreqArray;
     Teuchos::RCP<Plato::CrsMatrixType> mJacobian;
 
+    // modal superposition, optional
+    std::shared_ptr<Plato::ModalSuperposition<mSpatialDim>> mModalSolver;
+    Plato::Scalar mModalRefFrequency;
+    Plato::ScalarVector mModalControl; /*!< design the modes were computed for */
+    std::vector<std::complex<Plato::Scalar>> mModalDiagonal;
+    std::vector<std::complex<Plato::Scalar>> mModalAdjointDiagonal;
+    Teuchos::RCP<Plato::CrsMatrixType> mJacobianZero;
+    Teuchos::RCP<Plato::CrsMatrixType> mJacobianRef;
+    Teuchos::RCP<Plato::CrsMatrixType> mAdjointJacobianZero;
+    Teuchos::RCP<Plato::CrsMatrixType> mAdjointJacobianRef;
+
     // required
     std::shared_ptr<const VectorFunction<SimplexPhysics>> mEquality;
 
@@ -90,6 +106,8 @@ public:
             mExternalForce("BoundaryLoads", mNumStates),
             mFreqArray(),
             mJacobian(Teuchos::null),
+            mModalSolver(nullptr),
+            mModalRefFrequency(1.0),
             mEquality(nullptr),
             mObjective(nullptr),
             mConstraint(nullptr),
@@ -97,6 +115,7 @@ public:
     {
         this->initialize(aMesh, aMeshSets, aParamList);
         this->readFrequencyArray(aParamList);
+        this->readModalSuperposition(aParamList);
     }
 
     /******************************************************************************//**
@@ -118,6 +137,8 @@ public:
             mExternalForce("ExternalForce", mNumStates),
             mFreqArray(),
             mJacobian(Teuchos::null),
+            mModalSolver(nullptr),
+            mModalRefFrequency(1.0),
             mEquality(aEquality),
             mObjective(nullptr),
             mConstraint(nullptr),
@@ -190,6 +211,42 @@ public:
     void setMaxNumIterationsAmgX(const Plato::OrdinalType& aInput)
     {
         mNumIterationsAmgX = aInput;   
+        if(mModalSolver != nullptr)
+        {
+            mModalSolver->setMaxNumSolverIterations(aInput);
+        }
+    }
+
+    /******************************************************************************//**
+     *
+     * @brief Solve every frequency by superposition of the lowest eigenmodes
+     *
+     * The eigenpairs are computed once per design. The truncated modes are added
+     * back by mode acceleration corrections, and frequencies whose reduced
+     * solution still misses the residual tolerance are solved directly instead.
+     * Requires homogeneous essential boundary conditions.
+     *
+     * @param[in] aNumModes number of eigenmodes in the reduced basis
+     * @param[in] aResidualTolerance relative residual accepted from the reduced basis
+     *
+    **********************************************************************************/
+    void setModalSuperposition(const Plato::OrdinalType& aNumModes, const Plato::Scalar& aResidualTolerance)
+    {
+        const Plato::OrdinalType tNumNodes = mNumStates / mNumDofsPerNode;
+        mModalSolver = std::make_shared<Plato::ModalSuperposition<mSpatialDim>>(tNumNodes, aNumModes);
+        mModalSolver->setResidualTolerance(aResidualTolerance);
+        mModalSolver->setMaxNumSolverIterations(mNumIterationsAmgX);
+        mModalControl = Plato::ScalarVector();
+    }
+
+    /******************************************************************************//**
+     *
+     * @brief Get modal superposition solver, null unless enabled
+     *
+    **********************************************************************************/
+    std::shared_ptr<Plato::ModalSuperposition<mSpatialDim>> getModalSuperposition()
+    {
+        return mModalSolver;
     }
 
     /******************************************************************************//**
@@ -256,6 +313,11 @@ public:
     {
         assert(aControl.size() == mNumControls);
 
+        if(mModalSolver != nullptr)
+        {
+            this->updateModes(aControl);
+        }
+
         const Plato::OrdinalType tNumFreqs = mFreqArray.size();
         for(Plato::OrdinalType tFreqIndex = 0; tFreqIndex < tNumFreqs; tFreqIndex++)
         {
@@ -267,6 +329,13 @@ public:
             mResidual = mEquality->value(tMyStatesSubView, aControl, tMyFrequency);
             this->applyBoundaryLoads(mResidual);
 
+            // the reduced solution, when rejected, is the initial guess of the direct solve
+            if(mModalSolver != nullptr && mModalSolver->solve(mJacobianZero, mJacobianRef, mModalRefFrequency, tMyFrequency,
+                                                              mModalDiagonal, mResidual, tMyStatesSubView))
+            {
+                continue;
+            }
+
             mJacobian = mEquality->gradient_u(tMyStatesSubView, aControl, tMyFrequency);
             this->applyConstraints(mJacobian, mResidual);
 
@@ -713,6 +782,71 @@ private:
         }
     }
 
+    /******************************************************************************/
+    void readModalSuperposition(Teuchos::ParameterList& aParamList)
+    /******************************************************************************/
+    {
+        if(aParamList.isSublist("Modal Superposition") == true)
+        {
+            auto tModalParams = aParamList.sublist("Modal Superposition");
+            auto tNumModes = tModalParams.get<Plato::OrdinalType>("Number of Modes", 20);
+            auto tTolerance = tModalParams.get<Plato::Scalar>("Residual Tolerance", 1e-6);
+            this->setModalSuperposition(tNumModes, tTolerance);
+            mModalSolver->setEigenTolerance(tModalParams.get<Plato::Scalar>("Eigen Tolerance", 1e-6));
+            mModalSolver->setMaxNumCorrections(tModalParams.get<Plato::OrdinalType>("Max Corrections", 10));
+        }
+    }
+
+    /******************************************************************************/
+    void updateModes(const Plato::ScalarVector & aControl)
+    /******************************************************************************/
+    {
+        // eigenpairs depend on the design only, so they are kept until the control changes
+        if(mModalControl.size() == aControl.size())
+        {
+            Plato::ScalarVector tDifference("ControlDifference", aControl.size());
+            Kokkos::deep_copy(tDifference, aControl);
+            Plato::update(static_cast<Plato::Scalar>(-1.0), mModalControl, static_cast<Plato::Scalar>(1.0), tDifference);
+            if(Plato::norm_inf(tDifference) == static_cast<Plato::Scalar>(0.0))
+            {
+                return;
+            }
+        }
+
+        if(mBcValues.size() > 0 && Plato::norm_inf(mBcValues) != static_cast<Plato::Scalar>(0.0))
+        {
+            std::ostringstream tErrorMessage;
+            tErrorMessage << "\n\n************** ERROR IN FILE: " << __FILE__ << ", FUNCTION: " << __PRETTY_FUNCTION__
+                    << ", LINE: " << __LINE__ << "\nMESSAGE: MODAL SUPERPOSITION REQUIRES HOMOGENEOUS ESSENTIAL BOUNDARY CONDITIONS.\n"
+                    << "USER SHOULD REMOVE THE MODAL SUPERPOSITION SUBLIST OR THE NONZERO BOUNDARY VALUES. **************\n\n";
+            throw std::runtime_error(tErrorMessage.str().c_str());
+        }
+
+        // the largest frequency of the sweep keeps omega^2 M comparable to K in A(0) - A(omega_ref)
+        mModalRefFrequency = 0.0;
+        for(auto tFrequency : mFreqArray)
+        {
+            mModalRefFrequency = std::max(mModalRefFrequency, std::abs(tFrequency));
+        }
+        mModalRefFrequency = mModalRefFrequency > static_cast<Plato::Scalar>(0.0) ? mModalRefFrequency : 1.0;
+
+        // the problem is linear, so the Jacobians do not depend on the state
+        Plato::ScalarVector tZeroState("ZeroState", mNumStates);
+        mJacobianZero = mEquality->gradient_u(tZeroState, aControl, 0.0);
+        mJacobianRef = mEquality->gradient_u(tZeroState, aControl, mModalRefFrequency);
+        mModalSolver->computeModes(mJacobianZero, mJacobianRef, mModalRefFrequency, mBcDofs);
+        mModalDiagonal = mModalSolver->projectOperator(mJacobianZero);
+        if(mAdjointProb != nullptr)
+        {
+            mAdjointJacobianZero = mAdjointProb->gradient_u(tZeroState, aControl, 0.0);
+            mAdjointJacobianRef = mAdjointProb->gradient_u(tZeroState, aControl, mModalRefFrequency);
+            mModalAdjointDiagonal = mModalSolver->projectOperator(mAdjointJacobianZero);
+        }
+
+        mModalControl = Plato::ScalarVector("ModalControl", aControl.size());
+        Kokkos::deep_copy(mModalControl, aControl);
+    }
+
     /******************************************************************************/
     Teuchos::RCP<Plato::CrsMatrixType> computePartialResidualWrtDesignVar(const Plato::partial::derivative_t & aWhichType,
                                                                           const Plato::ScalarVector & aState,
@@ -745,23 +879,34 @@ private:
                                  Plato::ScalarVector & aOutput)
     /******************************************************************************/
     {
+        if(mModalSolver != nullptr)
+        {
+            this->updateModes(aControl);
+        }
+
         const Plato::OrdinalType tNumFreqs = mFreqArray.size();
         for(Plato::OrdinalType tFreqIndex = 0; tFreqIndex < tNumFreqs; tFreqIndex++)
         {
-            // compute dgdu: partial of PDE wrt state
             auto tMyFrequency = mFreqArray[tFreqIndex];
             auto tMyStatesSubView = Kokkos::subview(aState, tFreqIndex, Kokkos::ALL());
-            mJacobian = mAdjointProb->gradient_u(tMyStatesSubView, aControl, tMyFrequency);
-            this->applyConstraints(mJacobian, mGradState);
 
             // adjoint problem \lambda = (dg/du)-*(df/du) uses transpose of global stiffness,
             Plato::fill(static_cast<Plato::Scalar>(0.0), mMyAdjoint);
+            bool tSolved = mModalSolver != nullptr
+                    && mModalSolver->solve(mAdjointJacobianZero, mAdjointJacobianRef, mModalRefFrequency, tMyFrequency,
+                                           mModalAdjointDiagonal, mGradState, mMyAdjoint);
+            if(tSolved == false)
+            {
+                // compute dgdu: partial of PDE wrt state
+                mJacobian = mAdjointProb->gradient_u(tMyStatesSubView, aControl, tMyFrequency);
+                this->applyConstraints(mJacobian, mGradState);
 #ifdef HAVE_AMGX
-            using AmgXLinearProblem = lgr::AmgXSparseLinearProblem< Plato::OrdinalType, mNumDofsPerNode>;
-            auto tConfigString = AmgXLinearProblem::getConfigString();
-            auto tSolver = std::make_shared<AmgXLinearProblem>(*mJacobian, mMyAdjoint, mGradState, tConfigString);
-            tSolver->solve();
+                using AmgXLinearProblem = lgr::AmgXSparseLinearProblem< Plato::OrdinalType, mNumDofsPerNode>;
+                auto tConfigString = AmgXLinearProblem::getConfigString();
+                auto tSolver = std::make_shared<AmgXLinearProblem>(*mJacobian, mMyAdjoint, mGradState, tConfigString);
+                tSolver->solve();
 #endif
+            }
 
             // compute dgdz: partial of PDE wrt design variable.
             auto tPartialWrtDesignVar =
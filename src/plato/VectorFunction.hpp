@@ -341,6 +341,86 @@ class VectorFunction : public WorksetBase<PhysicsT>
 
       return tJacobianMat;
     }
+
+    /**************************************************************************//**
+    *
+    * @brief Directional derivative of the residual with respect to the controls
+    * @param [in] aState state
+    * @param [in] aControl control
+    * @param [in] aDirection control direction
+    * @param [in] aTimeStep time step
+    * @return (dR/dz) * aDirection, one entry per state degree of freedom
+    *
+    * The element residuals are differentiated in forward mode with respect to
+    * their nodal controls and contracted with the direction before assembly,
+    * so no control Jacobian matrix is formed.
+    *
+    ******************************************************************************/
+    Plato::ScalarVector
+    gradient_z_times(const Plato::ScalarVector & aState,
+                     const Plato::ScalarVector & aControl,
+                     const Plato::ScalarVector & aDirection,
+                     Plato::Scalar aTimeStep = 0.0) const
+    {
+      using ConfigScalar  = typename GradientZ::ConfigScalarType;
+      using StateScalar   = typename GradientZ::StateScalarType;
+      using ControlScalar = typename GradientZ::ControlScalarType;
+      using ResultScalar  = typename GradientZ::ResultScalarType;
+
+      // Workset config
+      // 
+      Plato::ScalarArray3DT<ConfigScalar>
+          tConfigWS("Config Workset",m_numCells, m_numNodesPerCell, m_numSpatialDims);
+      WorksetBase<PhysicsT>::worksetConfig(tConfigWS);
+
+      // Workset control
+      //
+      Plato::ScalarMultiVectorT<ControlScalar> tControlWS("Control Workset",m_numCells,m_numNodesPerCell);
+      WorksetBase<PhysicsT>::worksetControl(aControl, tControlWS);
+
+      // Workset control direction
+      //
+      Plato::ScalarMultiVectorT<Plato::Scalar> tDirectionWS("Direction Workset",m_numCells,m_numNodesPerCell);
+      WorksetBase<PhysicsT>::worksetControl(aDirection, tDirectionWS);
+ 
+      // Workset state
+      //
+      Plato::ScalarMultiVectorT<StateScalar> tStateWS("State Workset",m_numCells,m_numDofsPerCell);
+      WorksetBase<PhysicsT>::worksetState(aState, tStateWS);
+
+      // create result 
+      //
+      Plato::ScalarMultiVectorT<ResultScalar> tJacobian("JacobianControl",m_numCells,m_numDofsPerCell);
+
+      // evaluate function 
+      //
+      mVectorFunctionJacobianZ->evaluate( tStateWS, tControlWS, tConfigWS, tJacobian, aTimeStep );
+
+      // contract the element derivatives with the direction
+      //
+      constexpr Plato::OrdinalType tNumDofsPerCell = m_numDofsPerCell;
+      constexpr Plato::OrdinalType tNumNodesPerCell = m_numNodesPerCell;
+      Plato::ScalarMultiVector tTangent("Cells Tangent",m_numCells,m_numDofsPerCell);
+      Kokkos::parallel_for(Kokkos::RangePolicy<>(0, m_numCells), LAMBDA_EXPRESSION(const Plato::OrdinalType & aCellOrdinal)
+      {
+        for(Plato::OrdinalType tDofIndex = 0; tDofIndex < tNumDofsPerCell; tDofIndex++)
+        {
+          Plato::Scalar tValue = 0.0;
+          for(Plato::OrdinalType tNodeIndex = 0; tNodeIndex < tNumNodesPerCell; tNodeIndex++)
+          {
+            tValue += tJacobian(aCellOrdinal, tDofIndex).dx(tNodeIndex) * tDirectionWS(aCellOrdinal, tNodeIndex);
+          }
+          tTangent(aCellOrdinal, tDofIndex) = tValue;
+        }
+      }, "control directional derivative");
+
+      // create and assemble to return view
+      //
+      Plato::ScalarVector tReturnValue("Assembled Control Directional Derivative",m_numDofsPerNode*m_numNodes);
+      WorksetBase<PhysicsT>::assembleResidual( tTangent, tReturnValue );
+
+      return tReturnValue;
+    }
 };
 
 #endif
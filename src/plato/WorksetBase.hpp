@@ -112,6 +112,65 @@ inline void assemble_scalar_gradient(const Plato::OrdinalType& aNumCells,
     }, "Assemble - Scalar Gradient Calculation");
 }
 
+/*************************************************************************//**
+*
+* @brief Assemble global value and gradients from a subset of the cells
+*
+* Same as the functions above, but only the cells listed in aCells are
+* visited, e.g. the few cells of a sparse criterion whose workset entries are
+* not identically zero. Cost scales with aCells.size() instead of the mesh.
+*
+* @param aCells ordinals of the cells to assemble
+*
+*****************************************************************************/
+template <class Scalar, class Result>
+inline Scalar assemble_scalar_func_value(const Plato::LocalOrdinalVector& aCells, const Result& aResult)
+{
+  Scalar tReturnValue(0.0);
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<>(0, aCells.size()), LAMBDA_EXPRESSION(const Plato::OrdinalType& aOrdinal, Scalar & aLocalValue)
+  {
+    aLocalValue += aResult(aCells(aOrdinal)).val();
+  }, tReturnValue);
+  return tReturnValue;
+}
+
+template<Plato::OrdinalType NumNodesPerCell, Plato::OrdinalType NumDofsPerNode, class EntryOrdinal, class Gradient, class ReturnVal>
+inline void assemble_vector_gradient(const Plato::LocalOrdinalVector& aCells,
+                                     const EntryOrdinal& aEntryOrdinal,
+                                     const Gradient& aGradient,
+                                     ReturnVal& aOutput)
+{
+    Kokkos::parallel_for(Kokkos::RangePolicy<>(0, aCells.size()), LAMBDA_EXPRESSION(const Plato::OrdinalType & aOrdinal)
+    {
+        const Plato::OrdinalType tCellOrdinal = aCells(aOrdinal);
+        for(Plato::OrdinalType tNodeIndex=0; tNodeIndex < NumNodesPerCell; tNodeIndex++)
+        {
+            for(Plato::OrdinalType tDimIndex=0; tDimIndex < NumDofsPerNode; tDimIndex++)
+            {
+                Plato::OrdinalType tEntryOrdinal = aEntryOrdinal(tCellOrdinal, tNodeIndex, tDimIndex);
+                Kokkos::atomic_add(&aOutput(tEntryOrdinal), aGradient(tCellOrdinal).dx(tNodeIndex * NumDofsPerNode + tDimIndex));
+            }
+        }
+    }, "Assemble - Vector Gradient Calculation On Cells");
+}
+
+template<Plato::OrdinalType NumNodesPerCell, class EntryOrdinal, class Gradient, class ReturnVal>
+inline void assemble_scalar_gradient(const Plato::LocalOrdinalVector& aCells,
+                                     const EntryOrdinal& aEntryOrdinal,
+                                     const Gradient& aGradient,
+                                     ReturnVal& aOutput)
+{
+    Kokkos::parallel_for(Kokkos::RangePolicy<>(0, aCells.size()), LAMBDA_EXPRESSION(const Plato::OrdinalType & aOrdinal)
+    {
+      const Plato::OrdinalType tCellOrdinal = aCells(aOrdinal);
+      for(Plato::OrdinalType tNodeIndex=0; tNodeIndex < NumNodesPerCell; tNodeIndex++)
+      {
+          Plato::OrdinalType tEntryOrdinal = aEntryOrdinal(tCellOrdinal, tNodeIndex);
+          Kokkos::atomic_add(&aOutput(tEntryOrdinal), aGradient(tCellOrdinal).dx(tNodeIndex));
+      }
+    }, "Assemble - Scalar Gradient Calculation On Cells");
+}
+
 /******************************************************************************/
 template<int numNodesPerCell, class ControlEntryOrdinal, class Control, class ControlWS>
 inline void workset_control_scalar_scalar(int aNumCells,
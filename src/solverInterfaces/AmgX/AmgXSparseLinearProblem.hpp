@@ -383,9 +383,44 @@ namespace lgr {
     
     void initializePreconditioner()
     {
+      Kokkos::Timer timer;
       Kokkos::Profiling::pushRegion("AMGX_solver_setup");
       AMGX_solver_setup(_solver, _matrix);
       Kokkos::Profiling::popRegion();
+      this->_setupTime = timer.seconds();
+    }
+
+    // new coefficients in the same sparsity pattern: replace the values in
+    // place instead of re-uploading the matrix, and either rebuild the AMG
+    // hierarchy or only recompute its operators on the existing structure
+    void updateProblem()
+    {
+      Kokkos::Timer timer;
+      auto const & A = this->A();
+      const Ordinal N = _x.size();
+      const Ordinal nnz = A.columnIndices().size();
+      int err = cudaDeviceSynchronize();
+      assert(err == cudaSuccess);
+      Kokkos::Profiling::pushRegion("AMGX_matrix_replace_coefficients");
+      AMGX_matrix_replace_coefficients(_matrix, N/BlockSize, nnz, A.entries().data(), nullptr);
+      Kokkos::Profiling::popRegion();
+      setRHS(this->b());
+      setInitialGuess(_x);
+      if (_haveInitialized)
+      {
+        if (this->preconditionerRefreshDue())
+        {
+          Kokkos::Profiling::pushRegion("AMGX_solver_setup");
+          AMGX_solver_setup(_solver, _matrix);
+        }
+        else
+        {
+          Kokkos::Profiling::pushRegion("AMGX_solver_resetup");
+          AMGX_solver_resetup(_solver, _matrix);
+        }
+        Kokkos::Profiling::popRegion();
+      }
+      this->_setupTime = timer.seconds();
     }
     
     void initializeSolver() // TODO: add mechanism for setting options
@@ -442,12 +477,15 @@ namespace lgr {
       }
       int err = cudaDeviceSynchronize();
       assert(err == cudaSuccess);
+      Kokkos::Timer timer;
       Kokkos::Profiling::pushRegion("AMGX_solver_solve");
       auto solverErr = AMGX_solver_solve(_solver, _rhs, _lhs);
       Kokkos::Profiling::popRegion();
+      AMGX_solver_get_iterations_number(_solver, &this->_iterationsTaken);
       Kokkos::Profiling::pushRegion("AMGX_vector_download");
       AMGX_vector_download(_lhs, _x.data());
       Kokkos::Profiling::popRegion();
+      this->_solveTime = timer.seconds();
       return solverErr;
     }
 
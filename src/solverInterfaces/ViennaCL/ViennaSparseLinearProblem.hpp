@@ -22,6 +22,10 @@
 #include <viennacl/compressed_matrix.hpp>
 #include <viennacl/linalg/cg.hpp>
 
+#include <iterator>
+#include <map>
+#include <vector>
+
 namespace lgr {
   template<class Ordinal>
   class ViennaSparseLinearProblem : public CrsLinearProblem<Ordinal>
@@ -43,9 +47,21 @@ namespace lgr {
     int _maxIters = 1000;
     double _tol = 1e-10;
     
-    int _iterationsTaken = -1;
     double _residualEstimate = -1.0;
     
+    // for each entry of the Kokkos matrix, the index of the ViennaCL
+    // entry it lands in; lets updateProblem() copy only the values
+    std::vector<int> _viennaEntryOrdinals;
+    std::vector<Scalar> _viennaEntries;
+    
+    static void copyToVienna(const Vector & v, viennacl::vector<Scalar> & viennaVector)
+    {
+      typename Vector::HostMirror vHost = Kokkos::create_mirror_view( v );
+      Kokkos::deep_copy( vHost, v );
+      std::vector<Scalar> cpu_v(vHost.data(), vHost.data() + vHost.size());
+      viennacl::copy(cpu_v.begin(), cpu_v.end(), viennaVector.begin());
+    }
+    
   public:
     ViennaSparseLinearProblem(const Matrix A, MultiVector x, const MultiVector b) : ViennaSparseLinearProblem(A, Vector(Kokkos::subview(x, 0, Kokkos::ALL())), Vector(Kokkos::subview(b, 0, Kokkos::ALL())))
     {
@@ -108,6 +124,26 @@ namespace lgr {
       //copy to device:
       viennacl::copy(cpu_sparse_matrix, _matrix);
       
+      // ViennaCL stores each row's entries sorted by column, with repeated
+      // columns merged, in the order of the maps above
+      _viennaEntryOrdinals.resize(entry);
+      int viennaRowStart = 0;
+      entry = 0;
+      for (RowMapType row=0; row<rowCount; row++)
+      {
+        auto & rowEntries = cpu_sparse_matrix[row];
+        int colsForRow = rowMapHost(row+1) - rowMapHost(row);
+        for (int colOrdinal=0; colOrdinal<colsForRow; colOrdinal++)
+        {
+          int col = columnIndicesHost(entry);
+          auto offset = std::distance(rowEntries.begin(), rowEntries.find(col));
+          _viennaEntryOrdinals[entry] = viennaRowStart + int(offset);
+          entry++;
+        }
+        viennaRowStart += int(rowEntries.size());
+      }
+      _viennaEntries.resize(viennaRowStart);
+      
       /**** SET UP VECTORS ON DEVICE ****/
       // Again, we're starting out with the sure, simple, but inefficient implementation
       std::vector<Scalar> cpu_rhs(N);
@@ -218,11 +254,6 @@ namespace lgr {
 //      _solver = factory.create("CG", belosPL);
     }
     
-    int getIterationsTaken()
-    {
-      return _iterationsTaken;
-    }
-    
     void setMaxIters(int maxCGIters)
     {
       _maxIters = maxCGIters;
@@ -238,8 +269,31 @@ namespace lgr {
       _tol = tol;
     }
     
+    // new coefficients in the same sparsity pattern: write only the values
+    // into the existing ViennaCL matrix.  _lhs is refreshed from x(), so
+    // the next solve starts from the previous solution.
+    void updateProblem()
+    {
+      Kokkos::Timer timer;
+      auto const & A = this->A();
+      typename Vector::HostMirror entriesHost = Kokkos::create_mirror_view( A.entries() );
+      Kokkos::deep_copy( entriesHost, A.entries() );
+      int numEntries = _viennaEntryOrdinals.size();
+      for (int entry=0; entry<numEntries; entry++)
+      {
+        _viennaEntries[_viennaEntryOrdinals[entry]] = entriesHost(entry);
+      }
+      viennacl::backend::memory_write(_matrix.handle(), 0,
+                                      sizeof(Scalar) * _viennaEntries.size(),
+                                      _viennaEntries.data());
+      copyToVienna(this->b(), _rhs);
+      copyToVienna(_x, _lhs);
+      this->_setupTime = timer.seconds();
+    }
+    
     int solve() {
       using namespace std;
+      Kokkos::Timer timer;
       
       // Set up CG solver object
       viennacl::linalg::cg_tag my_cg_tag(_tol, _maxIters);
@@ -255,7 +309,7 @@ namespace lgr {
       // solve:
       _lhs = solver(_matrix, _rhs);
       
-      _iterationsTaken = solver.tag().iters();
+      this->_iterationsTaken = solver.tag().iters();
       _residualEstimate = solver.tag().error();
       
       // copy from _lhs to _x (the Kokkos View)
@@ -272,6 +326,7 @@ namespace lgr {
 
       // copy from host to device
       Kokkos::deep_copy( _x, xHost );
+      this->_solveTime = timer.seconds();
       
       return 0; // TODO: figure out how to get a result code from ViennaCL
     }
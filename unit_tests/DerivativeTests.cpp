@@ -470,6 +470,99 @@ TEUCHOS_UNIT_TEST( DerivativeTests, ElastostaticResidual3D )
 
 
 
+/******************************************************************************/
+/*! 
+  \brief Compare the control directional derivative of the ElastostaticResidual
+         in 3D with a central difference of the residual.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST( DerivativeTests, ElastostaticResidual3D_DirectionalZ )
+{
+  // create test mesh
+  //
+  constexpr int meshWidth=2;
+  constexpr int spaceDim=3;
+  auto mesh = PlatoUtestHelpers::getBoxMesh(spaceDim, meshWidth);
+
+  // create control, control direction, and displacement from host data
+  //
+  int tNumNodes = mesh->nverts();
+  std::vector<Plato::Scalar> z_host( tNumNodes, 0.5 );
+  std::vector<Plato::Scalar> v_host( tNumNodes );
+  for( int i=0; i<tNumNodes; i++ ) v_host[i] = 0.1 * std::sin(1.0 + i);
+  std::vector<Plato::Scalar> u_host( spaceDim*tNumNodes );
+  Plato::Scalar disp = 0.0, dval = 0.0001;
+  for( auto& val : u_host ) val = (disp += dval);
+
+  Kokkos::View<Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+    z_host_view(z_host.data(),z_host.size()), v_host_view(v_host.data(),v_host.size()), u_host_view(u_host.data(),u_host.size());
+  auto z = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), z_host_view);
+  auto v = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), v_host_view);
+  auto u = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), u_host_view);
+
+  // create input
+  //
+  Teuchos::RCP<Teuchos::ParameterList> params =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                          \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Elastostatics'/>      \n"
+    "  <ParameterList name='Elastostatics'>                                        \n"
+    "    <ParameterList name='Penalty Function'>                                   \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>                  \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                     \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Material Model'>                                       \n"
+    "    <ParameterList name='Isotropic Linear Elastic'>                           \n"
+    "      <Parameter name='Poissons Ratio' type='double' value='0.3'/>            \n"
+    "      <Parameter name='Youngs Modulus' type='double' value='1.0e6'/>          \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "</ParameterList>                                                              \n"
+  );
+
+  Plato::DataMap tDataMap;
+  Omega_h::MeshSets tMeshSets;
+  VectorFunction<::Plato::Mechanics<spaceDim>> 
+    esVectorFunction(*mesh, tMeshSets, tDataMap, *params, params->get<std::string>("PDE Constraint"));
+
+  // forward-mode directional derivative
+  //
+  auto tangent = esVectorFunction.gradient_z_times(u, z, v);
+  auto tangent_Host = Kokkos::create_mirror_view( tangent );
+  Kokkos::deep_copy( tangent_Host, tangent );
+
+  // central difference of the residual along v
+  //
+  Plato::Scalar tStep = 1.0e-4;
+  std::vector<Plato::Scalar> zPlus_host( tNumNodes ), zMinus_host( tNumNodes );
+  for( int i=0; i<tNumNodes; i++ ){
+    zPlus_host[i] = z_host[i] + tStep * v_host[i];
+    zMinus_host[i] = z_host[i] - tStep * v_host[i];
+  }
+  Kokkos::View<Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+    zPlus_host_view(zPlus_host.data(),zPlus_host.size()), zMinus_host_view(zMinus_host.data(),zMinus_host.size());
+  auto zPlus = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), zPlus_host_view);
+  auto zMinus = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), zMinus_host_view);
+  auto residualPlus = esVectorFunction.value(u, zPlus);
+  auto residualMinus = esVectorFunction.value(u, zMinus);
+  auto residualPlus_Host = Kokkos::create_mirror_view( residualPlus );
+  Kokkos::deep_copy( residualPlus_Host, residualPlus );
+  auto residualMinus_Host = Kokkos::create_mirror_view( residualMinus );
+  Kokkos::deep_copy( residualMinus_Host, residualMinus );
+
+  Plato::Scalar tMaxTangent = 0.0;
+  for(int i=0; i<int(tangent_Host.size()); i++){
+    tMaxTangent = std::max(tMaxTangent, std::abs(tangent_Host(i)));
+  }
+  TEST_ASSERT(tMaxTangent > 0.0);
+  for(int i=0; i<int(tangent_Host.size()); i++){
+    Plato::Scalar tDifference = (residualPlus_Host(i) - residualMinus_Host(i)) / (2.0 * tStep);
+    TEST_ASSERT(std::abs(tangent_Host(i) - tDifference) < 1.0e-6 * tMaxTangent);
+  }
+}
+
+
 /******************************************************************************/
 /*! 
   \brief Compute value and both gradients (wrt state and control) of 
@@ -1863,3 +1956,160 @@ TEUCHOS_UNIT_TEST( DerivativeTests, Volume3D )
   }
 }
 
+
+
+#ifdef HAVE_AMGX
+/******************************************************************************/
+/*! 
+  \brief Compare the reduced Hessian times a direction of the internal elastic
+         energy and of the volume with a central difference of their reduced
+         gradients, for both the self-adjoint and the general adjoint paths.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST( DerivativeTests, HessianTimesVector3D )
+{
+  // create test mesh, clamped at x=0 and pulled down at x=1
+  //
+  constexpr int meshWidth=2;
+  constexpr int spaceDim=3;
+  auto mesh = PlatoUtestHelpers::getBoxMesh(spaceDim, meshWidth);
+
+  Omega_h::MeshSets tMeshSets;
+  tMeshSets[Omega_h::NODE_SET]["x0"] = PlatoUtestHelpers::getBoundaryNodes_x0(mesh);
+  auto x1Marks = Omega_h::mark_class_closure(mesh.get(), spaceDim-1, spaceDim-1, 14);
+  tMeshSets[Omega_h::SIDE_SET]["x1"] = Omega_h::collect_marked(x1Marks);
+
+  // create control and direction from host data
+  //
+  int tNumNodes = mesh->nverts();
+  std::vector<Plato::Scalar> z_host( tNumNodes ), v_host( tNumNodes );
+  for( int i=0; i<tNumNodes; i++ ){
+    z_host[i] = 0.5 + 0.2 * std::cos(2.0 + i);
+    v_host[i] = 0.1 * std::sin(1.0 + i);
+  }
+  Kokkos::View<Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+    z_host_view(z_host.data(),z_host.size()), v_host_view(v_host.data(),v_host.size());
+  auto z = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), z_host_view);
+  auto v = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), v_host_view);
+
+  Plato::Scalar tStep = 1.0e-4;
+  std::vector<Plato::Scalar> zPlus_host( tNumNodes ), zMinus_host( tNumNodes );
+  for( int i=0; i<tNumNodes; i++ ){
+    zPlus_host[i] = z_host[i] + tStep * v_host[i];
+    zMinus_host[i] = z_host[i] - tStep * v_host[i];
+  }
+  Kokkos::View<Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+    zPlus_host_view(zPlus_host.data(),zPlus_host.size()), zMinus_host_view(zMinus_host.data(),zMinus_host.size());
+  auto zPlus = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), zPlus_host_view);
+  auto zMinus = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), zMinus_host_view);
+
+  // create input
+  //
+  Teuchos::RCP<Teuchos::ParameterList> params =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                          \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Elastostatics'/>      \n"
+    "  <Parameter name='Objective' type='string' value='Internal Elastic Energy'/> \n"
+    "  <Parameter name='Linear Constraint' type='string' value='Volume'/>          \n"
+    "  <Parameter name='Self-Adjoint' type='bool' value='true'/>                   \n"
+    "  <ParameterList name='Elastostatics'>                                        \n"
+    "    <ParameterList name='Penalty Function'>                                   \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>                  \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                     \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Internal Elastic Energy'>                              \n"
+    "    <ParameterList name='Penalty Function'>                                   \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>                  \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                     \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Volume'>                                               \n"
+    "    <ParameterList name='Penalty Function'>                                   \n"
+    "      <Parameter name='Exponent' type='double' value='1.0'/>                  \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                     \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Material Model'>                                       \n"
+    "    <ParameterList name='Isotropic Linear Elastic'>                           \n"
+    "      <Parameter name='Poissons Ratio' type='double' value='0.3'/>            \n"
+    "      <Parameter name='Youngs Modulus' type='double' value='1.0e6'/>          \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Essential Boundary Conditions'>                        \n"
+    "    <ParameterList name='X Fixed Displacement Boundary Condition'>            \n"
+    "      <Parameter name='Type' type='string' value='Zero Value'/>               \n"
+    "      <Parameter name='Index' type='int' value='0'/>                          \n"
+    "      <Parameter name='Sides' type='string' value='x0'/>                      \n"
+    "    </ParameterList>                                                          \n"
+    "    <ParameterList name='Y Fixed Displacement Boundary Condition'>            \n"
+    "      <Parameter name='Type' type='string' value='Zero Value'/>               \n"
+    "      <Parameter name='Index' type='int' value='1'/>                          \n"
+    "      <Parameter name='Sides' type='string' value='x0'/>                      \n"
+    "    </ParameterList>                                                          \n"
+    "    <ParameterList name='Z Fixed Displacement Boundary Condition'>            \n"
+    "      <Parameter name='Type' type='string' value='Zero Value'/>               \n"
+    "      <Parameter name='Index' type='int' value='2'/>                          \n"
+    "      <Parameter name='Sides' type='string' value='x0'/>                      \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Natural Boundary Conditions'>                          \n"
+    "    <ParameterList name='Traction Vector Boundary Condition'>                 \n"
+    "      <Parameter name='Type' type='string' value='Uniform'/>                  \n"
+    "      <Parameter name='Values' type='Array(double)' value='{0.0, -1.0e3, 0.0}'/> \n"
+    "      <Parameter name='Sides' type='string' value='x1'/>                      \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "</ParameterList>                                                              \n"
+  );
+
+  auto toHost = [](Plato::ScalarVector aVector) {
+    auto tHost = Kokkos::create_mirror_view( aVector );
+    Kokkos::deep_copy( tHost, aVector );
+    return tHost;
+  };
+
+  auto testAgainstDifference = [&](Plato::ScalarVector aHessTimesVec,
+                                   Plato::ScalarVector aGradPlus,
+                                   Plato::ScalarVector aGradMinus,
+                                   Plato::Scalar aFloor) {
+    auto tHv_Host = toHost(aHessTimesVec);
+    auto tPlus_Host = toHost(aGradPlus);
+    auto tMinus_Host = toHost(aGradMinus);
+    Plato::Scalar tMaxHv = 0.0;
+    for(int i=0; i<int(tHv_Host.size()); i++){
+      tMaxHv = std::max(tMaxHv, std::abs(tHv_Host(i)));
+    }
+    for(int i=0; i<int(tHv_Host.size()); i++){
+      Plato::Scalar tDifference = (tPlus_Host(i) - tMinus_Host(i)) / (2.0 * tStep);
+      TEST_ASSERT(std::abs(tHv_Host(i) - tDifference) <= 1.0e-4 * tMaxHv + aFloor);
+    }
+    return tMaxHv;
+  };
+
+  for( bool tIsSelfAdjoint : {true, false} ){
+    params->set<bool>("Self-Adjoint", tIsSelfAdjoint);
+    Problem<::Plato::Mechanics<spaceDim>> tProblem(*mesh, tMeshSets, *params);
+
+    // reduced gradients on either side of z along v
+    //
+    auto tStatesPlus = tProblem.solution(zPlus);
+    auto tObjectiveGradPlus = tProblem.objectiveGradient(zPlus, tStatesPlus);
+    auto tConstraintGradPlus = tProblem.constraintGradient(zPlus, tStatesPlus);
+    auto tStatesMinus = tProblem.solution(zMinus);
+    auto tObjectiveGradMinus = tProblem.objectiveGradient(zMinus, tStatesMinus);
+    auto tConstraintGradMinus = tProblem.constraintGradient(zMinus, tStatesMinus);
+
+    // Hessian times direction at z
+    //
+    auto tStates = tProblem.solution(z);
+    auto tObjectiveHv = tProblem.objectiveHessianTimesVector(z, tStates, v);
+    auto tConstraintHv = tProblem.constraintHessianTimesVector(z, tStates, v);
+
+    // SIMP with exponent 3 makes the energy curved in z; the volume is linear in z
+    auto tMaxObjectiveHv = testAgainstDifference(tObjectiveHv, tObjectiveGradPlus, tObjectiveGradMinus, 0.0);
+    TEST_ASSERT(tMaxObjectiveHv > 0.0);
+    testAgainstDifference(tConstraintHv, tConstraintGradPlus, tConstraintGradMinus, 1.0e-8);
+  }
+}
+#endif
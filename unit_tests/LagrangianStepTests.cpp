@@ -0,0 +1,113 @@
+/*!
+  These unit tests are for the v1 Lagrangian step
+*/
+
+#include "LGRTestHelpers.hpp"
+#include "PlatoTestHelpers.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+
+#include "Fields.hpp"
+#include "FieldDB.hpp"
+#include "InitialConditions.hpp"
+#include "ExplicitFunctors.hpp"
+#include "LagrangianTimeIntegration.hpp"
+#include "VectorContribution.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <list>
+#include <memory>
+#include <new>
+
+using namespace lgr;
+
+/*
+  Every heap allocation in this executable goes through the replacement
+  operator new below.  A Kokkos View allocation in any memory space
+  creates its SharedAllocationRecord with operator new, so device
+  allocations are counted as well as host containers and strings.
+*/
+namespace {
+std::atomic<long> numHeapAllocations(0);
+
+void* countedAllocate(std::size_t size) {
+  ++numHeapAllocations;
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+}  // namespace
+
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  ++numHeapAllocations;
+  return std::malloc(size ? size : 1);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  ++numHeapAllocations;
+  return std::malloc(size ? size : 1);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+/******************************************************************************/
+/*!
+  \brief Once the step helpers are built, advancing the step must not
+  allocate: no FieldDB lookups, no functor or halo buffers, no Views.
+  Run for both the unfused and the fused element passes.
+*/
+TEUCHOS_UNIT_TEST( LagrangianStep, NoSteadyStateAllocations )
+{
+  constexpr int spaceDim  = 3;
+  constexpr int meshWidth = 3;
+  using Fields = lgr::Fields<spaceDim>;
+
+  Teuchos::RCP<Omega_h::Mesh> meshOmegaH =
+    PlatoUtestHelpers::getBoxMesh(spaceDim, meshWidth);
+  FEMesh<spaceDim> femesh = PlatoUtestHelpers::createFEMesh<spaceDim>(meshOmegaH);
+
+  for (bool fused : {false, true}) {
+    Teuchos::ParameterList fieldData;
+    fieldData.set("Linear Bulk Viscosity", 0.15);
+    fieldData.set("Quadratic Bulk Viscosity", 1.2);
+    fieldData.set("Fused Element Step", fused);
+    auto fields = Teuchos::rcp(new Fields(femesh, fieldData));
+
+    Kokkos::deep_copy(MassDensity<Fields>(), 1.0);
+    Kokkos::deep_copy(InternalEnergyPerUnitMass<Fields>(), 1.0);
+    Kokkos::deep_copy(PlaneWaveModulus<Fields>(), 1.0);
+    Kokkos::deep_copy(BulkModulus<Fields>(), 1.0);
+
+    Teuchos::ParameterList icParams;
+    InitialConditions<Fields> ic(icParams);
+    initialize_element<spaceDim>::apply(*fields, ic);
+    initialize_node<spaceDim>::apply(*fields);
+
+    std::list<std::shared_ptr<MaterialModelBase<spaceDim>>> materials;
+    LagrangianStep<spaceDim> step(
+        materials, *fields, femesh.machine, meshOmegaH.get());
+    VectorContributions<spaceDim> accel_contribs;
+    VectorContributions<spaceDim> internal_force_contribs;
+
+    const Scalar dt = 1.0e-3;
+    int current_state = 0;
+    int next_state = 0;
+    for (int cycle = 0; cycle < 4; ++cycle) {
+      current_state = next_state;
+      next_state = (next_state + 1) % Fields::NumStates;
+      const long before = numHeapAllocations.load();
+      step.advanceTime(
+          accel_contribs, internal_force_contribs, cycle * dt, dt,
+          current_state, next_state);
+      const long afterStep = numHeapAllocations.load();
+      step.tallies(next_state).apply();
+      const long afterTallies = numHeapAllocations.load();
+      TEST_EQUALITY(afterStep - before, 0);
+      TEST_EQUALITY(afterTallies - afterStep, 0);
+    }
+  }
+}
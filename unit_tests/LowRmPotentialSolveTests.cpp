@@ -961,4 +961,54 @@ namespace {
     double tol = 1e-15;
     testFloatingEquality(expectedRHS,rhs,tol,out,success);
   }
+  
+  TEUCHOS_UNIT_TEST( LowRmPotentialSolve, ConductanceChangeAndExtrapolation_2D )
+  {
+    /*
+     The conductance change is relative to the conductances of the last recorded solve, so scaling a
+     uniform conductivity by 1.5 changes it by 0.5.  Between solves the solution is extrapolated linearly
+     from the last two recorded solves, at most one solve interval past the last one.
+     */
+    const int spaceDim = 2;
+    int meshWidth = 2;
+    auto mesh = getBoxMesh(spaceDim, meshWidth);
+    LowRmPotentialSolve<spaceDim> solver = getLowRmPotentialSolveExample<spaceDim>(mesh);
+    
+    solver.initialize();
+    
+    // nothing recorded yet, so a solve is always due
+    TEST_EQUALITY(std::numeric_limits<Scalar>::max(), solver.relativeConductanceChange());
+    
+    auto lhs = solver.getLHS();
+    int numSolves = lhs.extent(0);
+    int numNodes  = lhs.extent(1);
+    LowRmPotentialSolve<spaceDim>::ScalarMultiVector expectedLHS("expected solution",numSolves,numNodes);
+    
+    double tol = 1e-14;
+    Kokkos::deep_copy(lhs, 1.0);
+    solver.recordSolve(0.0);
+    TEST_COMPARE(fabs(solver.relativeConductanceChange()), <=, tol);
+    
+    solver.setConductivity(solver.getConstantConductivity(1.5));
+    TEST_FLOATING_EQUALITY(0.5, solver.relativeConductanceChange(), tol);
+    
+    // one recorded solve is not enough to extrapolate from
+    solver.extrapolateSolution(0.5);
+    Kokkos::deep_copy(expectedLHS, 1.0);
+    testFloatingEquality(expectedLHS,lhs,tol,out,success);
+    
+    Kokkos::deep_copy(lhs, 3.0);
+    solver.recordSolve(1.0);
+    TEST_COMPARE(fabs(solver.relativeConductanceChange()), <=, tol);
+    
+    // half an interval ahead: 3 + 0.5 * (3 - 1)
+    solver.extrapolateSolution(1.5);
+    Kokkos::deep_copy(expectedLHS, 4.0);
+    testFloatingEquality(expectedLHS,lhs,tol,out,success);
+    
+    // never more than one interval ahead: 3 + 1.0 * (3 - 1)
+    solver.extrapolateSolution(4.0);
+    Kokkos::deep_copy(expectedLHS, 5.0);
+    testFloatingEquality(expectedLHS,lhs,tol,out,success);
+  }
 } // namespace
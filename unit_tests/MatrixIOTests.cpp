@@ -81,4 +81,84 @@ namespace {
     double tol = 1e-15;
     testFloatingEquality<Ordinal, SizeType>(matrix,matrixOut,tol,out,success);
   }
+  
+  TEUCHOS_UNIT_TEST( MatrixIO, CrsMatrixWriteAndReadMatrixMarket )
+  {
+    // large enough that the text is split across several parsing tasks
+    int numRows = 4096;
+    CrsMatrix matrix = sampleCrsMatrix(numRows);
+    
+    using namespace std;
+    
+    ostringstream ss;
+    MatrixIO::writeMatrixMarket(ss, matrix);
+    
+    istringstream iss(ss.str());
+    CrsMatrix matrixOut = MatrixIO::readMatrixMarket(iss);
+    
+    double tol = 1e-15;
+    testFloatingEquality<Ordinal, SizeType>(matrix,matrixOut,tol,out,success);
+  }
+  
+  TEUCHOS_UNIT_TEST( MatrixIO, CrsMatrixReadMatrixMarketUnordered )
+  {
+    // entries out of order, with comments, a redundant entry, and symmetric storage
+    using namespace std;
+    string matrixString =
+      "%%MatrixMarket matrix coordinate real symmetric\n"
+      "% a comment\n"
+      "3 3 5\n"
+      "3 3 6.0\n"
+      "2 1 -1.0\n"
+      "\n"
+      "1 1 4.0\n"
+      "2 2 7.0\n"
+      "2 2 5.0\n";
+    istringstream iss(matrixString);
+    CrsMatrix matrix = MatrixIO::readMatrixMarket(iss);
+    
+    auto rowMapHost        = Kokkos::create_mirror_view( matrix.rowMap() );
+    auto columnIndicesHost = Kokkos::create_mirror_view( matrix.columnIndices() );
+    auto entriesHost       = Kokkos::create_mirror_view( matrix.entries() );
+    Kokkos::deep_copy( rowMapHost,        matrix.rowMap() );
+    Kokkos::deep_copy( columnIndicesHost, matrix.columnIndices() );
+    Kokkos::deep_copy( entriesHost,       matrix.entries() );
+    
+    vector<SizeType> rowMapGold        = {0, 2, 4, 5};
+    vector<Ordinal>  columnIndicesGold = {0, 1, 0, 1, 2};
+    vector<Scalar>   entriesGold       = {4.0, -1.0, -1.0, 5.0, 6.0};
+    TEST_EQUALITY( rowMapHost.size(), rowMapGold.size() );
+    TEST_EQUALITY( entriesHost.size(), entriesGold.size() );
+    for (size_t i=0; i<rowMapGold.size(); i++)
+    {
+      TEST_EQUALITY( rowMapHost(i), rowMapGold[i] );
+    }
+    for (size_t i=0; i<entriesGold.size(); i++)
+    {
+      TEST_EQUALITY( columnIndicesHost(i), columnIndicesGold[i] );
+      TEST_EQUALITY( entriesHost(i), entriesGold[i] );
+    }
+  }
+  
+  TEUCHOS_UNIT_TEST( MatrixIO, CrsMatrixWriteAndReadBinary )
+  {
+    int numRows = 8;
+    CrsMatrix matrix = sampleCrsMatrix(numRows);
+    
+    using namespace std;
+    
+    ostringstream ss(ios::binary);
+    MatrixIO::writeBinaryCrsMatrix(ss, matrix);
+    
+    istringstream iss(ss.str(), ios::binary);
+    CrsMatrix matrixOut = MatrixIO::readBinaryCrsMatrix(iss);
+    
+    // binary I/O is exact
+    double tol = 0.0;
+    testFloatingEquality<Ordinal, SizeType>(matrix,matrixOut,tol,out,success);
+    
+    // a text stream is rejected
+    istringstream textStream("1 1 1.0\n");
+    TEST_THROW( MatrixIO::readBinaryCrsMatrix(textStream), std::invalid_argument );
+  }
 } // namespace
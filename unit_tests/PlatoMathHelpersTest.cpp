@@ -110,6 +110,24 @@ TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, PlatoMathHelpers_update)
   TEST_FLOATING_EQUALITY(tVector_B_Host(numVerts-1), 8.0, 1e-17);
 }
 
+TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, PlatoMathHelpers_dot)
+{
+  // create test mesh
+  //
+  constexpr int meshWidth=2;
+  constexpr int spaceDim=3;
+  auto mesh = PlatoUtestHelpers::getBoxMesh(spaceDim, meshWidth);
+
+  int numVerts = mesh->nverts();
+
+  Plato::ScalarVector tVector_A("vector a", numVerts);
+  Plato::ScalarVector tVector_B("vector b", numVerts);
+  Plato::fill(2.0, tVector_A);
+  Plato::fill(3.0, tVector_B);
+
+  TEST_FLOATING_EQUALITY(Plato::dot(tVector_A, tVector_B), 6.0*numVerts, 1e-15);
+}
+
 TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, PlatoMathHelpers_MatrixTimesVectorPlusVector)
 {
   // create test mesh
@@ -4,12 +4,16 @@
  *  Created on: Mar 2, 2018
  **/
 
+#include <cmath>
 #include <memory>
+#include <cstdio>
 #include <cstdlib>
 
 #include <iostream>
 #include <fstream>
 
+#include <Kokkos_Timer.hpp>
+
 #include "PlatoTestHelpers.hpp"
 
 #include "plato/Simp.hpp"
@@ -22,11 +26,14 @@
 #include "plato/DynamicCompliance.hpp"
 #include "plato/StructuralDynamics.hpp"
 #include "plato/HeavisideProjection.hpp"
+#include "plato/ModalSuperposition.hpp"
 #include "plato/ComplexRayleighDamping.hpp"
+#include "plato/FrequencySweepOutput.hpp"
 #include "plato/FrequencyResponseMisfit.hpp"
 #include "plato/StructuralDynamicsOutput.hpp"
 #include "plato/StructuralDynamicsProblem.hpp"
 #include "plato/StructuralDynamicsResidual.hpp"
+#include "plato/SparseFrequencyResponseMisfit.hpp"
 #include "plato/HyperbolicTangentProjection.hpp"
 #include "plato/AdjointComplexRayleighDamping.hpp"
 #include "plato/ComputeFrequencyResponseMisfit.hpp"
@@ -1529,6 +1536,309 @@ TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, FrequencyResponseMisfit_GradU)
     }
 }
 
+TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, SparseFrequencyResponseMisfit_Value)
+{
+    // BUILD OMEGA_H MESH
+    const Plato::OrdinalType tSpaceDim = 2;
+    const Plato::OrdinalType tMeshWidth = 1;
+    auto tMesh = PlatoUtestHelpers::getBoxMesh(tSpaceDim, tMeshWidth);
+
+    // SET EVALUATION TYPES FOR UNIT TEST
+    using Residual = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Residual;
+
+    // SET PROBLEM-RELATED DIMENSIONS
+    const Plato::OrdinalType tNumVertices = tMesh->nverts();
+    TEST_EQUALITY(tNumVertices, static_cast<Plato::OrdinalType>(4));
+    const Plato::OrdinalType tNumDofsPerNode = static_cast<Plato::OrdinalType>(2) * tSpaceDim;
+    const Plato::OrdinalType tTotalNumDofs = tNumVertices * tNumDofsPerNode;
+
+    // ALLOCATE STATES AND SENSOR DATA; ONE SENSOR PER VERTEX
+    Plato::ScalarVector tStates("States", tTotalNumDofs);
+    auto tHostStates = Kokkos::create_mirror(tStates);
+    std::vector<Plato::Scalar> tFreqArray = {15.0};
+    const Plato::OrdinalType tNumFreq = tFreqArray.size();
+    Plato::ScalarArray3D tSensorData("SensorData", tNumFreq, tNumVertices, tNumDofsPerNode);
+    auto tHostSensorData = Kokkos::create_mirror(tSensorData);
+    for(Plato::OrdinalType tIndex = 0; tIndex < tTotalNumDofs; tIndex++)
+    {
+        tHostStates(tIndex) = static_cast<Plato::Scalar>(1e-2) * static_cast<Plato::Scalar>(tIndex);
+        tHostSensorData(0, tIndex / tNumDofsPerNode, tIndex % tNumDofsPerNode) =
+                static_cast<Plato::Scalar>(2.5e-2) * static_cast<Plato::Scalar>(tIndex);
+    }
+    Kokkos::deep_copy(tStates, tHostStates);
+    Kokkos::deep_copy(tSensorData, tHostSensorData);
+
+    auto tCoords = Omega_h::HostRead<Omega_h::Real>(tMesh->coords());
+    std::vector<Plato::Scalar> tSensorCoords(tCoords.size());
+    for(Plato::OrdinalType tIndex = 0; tIndex < tCoords.size(); tIndex++)
+    {
+        tSensorCoords[tIndex] = tCoords[tIndex];
+    }
+
+    // ALLOCATE SPARSE FREQUENCY RESPONSE MISFIT CRITERION
+    Plato::DataMap tDataMap;
+    Omega_h::MeshSets tMeshSets;
+    auto tCriterion = std::make_shared<Plato::SparseFrequencyResponseMisfit<Residual>>
+            (*tMesh, tMeshSets, tDataMap, tFreqArray, tSensorCoords, tSensorData);
+    TEST_EQUALITY(tCriterion->getNumSensors(), tNumVertices);
+    TEST_EQUALITY(tCriterion->getNumSensorCells(), static_cast<Plato::OrdinalType>(2));
+
+    // ALLOCATE SCALAR FUNCTION
+    ScalarFunction<Plato::StructuralDynamics<tSpaceDim>> tScalarFunction(*tMesh, tDataMap);
+    tScalarFunction.allocateValue(tCriterion);
+
+    // ALLOCATE CONTROLS
+    const Plato::OrdinalType tNumControls = tMesh->nverts();
+    Plato::ScalarVector tControls("Controls", tNumControls);
+    Plato::fill(static_cast<Plato::Scalar>(1), tControls);
+
+    // TEST VALUE
+    auto tValue = tScalarFunction.value(tStates, tControls, tFreqArray[0]);
+    const Plato::Scalar tTolerance = 1e-6;
+    TEST_FLOATING_EQUALITY(tValue, 0.1395, tTolerance);
+
+    // FREQUENCIES WITHOUT SENSOR DATA ARE AN ERROR
+    TEST_THROW(tScalarFunction.value(tStates, tControls, 20.0), std::runtime_error);
+}
+
+TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, SparseFrequencyResponseMisfit_GradU)
+{
+    // BUILD OMEGA_H MESH
+    const Plato::OrdinalType tSpaceDim = 2;
+    const Plato::OrdinalType tMeshWidth = 1;
+    auto tMesh = PlatoUtestHelpers::getBoxMesh(tSpaceDim, tMeshWidth);
+
+    // SET EVALUATION TYPES FOR UNIT TEST
+    using JacobianU = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Jacobian;
+
+    // SET PROBLEM-RELATED DIMENSIONS
+    const Plato::OrdinalType tNumVertices = tMesh->nverts();
+    const Plato::OrdinalType tNumDofsPerNode = static_cast<Plato::OrdinalType>(2) * tSpaceDim;
+    const Plato::OrdinalType tTotalNumDofs = tNumVertices * tNumDofsPerNode;
+    TEST_EQUALITY(tTotalNumDofs, static_cast<Plato::OrdinalType>(16));
+
+    // ALLOCATE STATES AND SENSOR DATA; ONE SENSOR PER VERTEX
+    Plato::ScalarVector tStates("States", tTotalNumDofs);
+    auto tHostStates = Kokkos::create_mirror(tStates);
+    std::vector<Plato::Scalar> tFreqArray = {15.0};
+    const Plato::OrdinalType tNumFreq = tFreqArray.size();
+    Plato::ScalarArray3D tSensorData("SensorData", tNumFreq, tNumVertices, tNumDofsPerNode);
+    auto tHostSensorData = Kokkos::create_mirror(tSensorData);
+    for(Plato::OrdinalType tIndex = 0; tIndex < tTotalNumDofs; tIndex++)
+    {
+        tHostStates(tIndex) = static_cast<Plato::Scalar>(1e-2) * static_cast<Plato::Scalar>(tIndex);
+        tHostSensorData(0, tIndex / tNumDofsPerNode, tIndex % tNumDofsPerNode) =
+                static_cast<Plato::Scalar>(2.5e-2) * static_cast<Plato::Scalar>(tIndex);
+    }
+    Kokkos::deep_copy(tStates, tHostStates);
+    Kokkos::deep_copy(tSensorData, tHostSensorData);
+
+    auto tCoords = Omega_h::HostRead<Omega_h::Real>(tMesh->coords());
+    std::vector<Plato::Scalar> tSensorCoords(tCoords.size());
+    for(Plato::OrdinalType tIndex = 0; tIndex < tCoords.size(); tIndex++)
+    {
+        tSensorCoords[tIndex] = tCoords[tIndex];
+    }
+
+    // ALLOCATE SPARSE FREQUENCY RESPONSE MISFIT CRITERION
+    Plato::DataMap tDataMap;
+    Omega_h::MeshSets tMeshSets;
+    std::shared_ptr<AbstractScalarFunction<JacobianU>> tJacobianState;
+    tJacobianState = std::make_shared<Plato::SparseFrequencyResponseMisfit<JacobianU>>
+            (*tMesh, tMeshSets, tDataMap, tFreqArray, tSensorCoords, tSensorData);
+
+    // ALLOCATE SCALAR FUNCTION
+    ScalarFunction<Plato::StructuralDynamics<tSpaceDim>> tScalarFunction(*tMesh, tDataMap);
+    tScalarFunction.allocateGradientU(tJacobianState);
+
+    // ALLOCATE CONTROLS
+    const Plato::OrdinalType tNumControls = tMesh->nverts();
+    Plato::ScalarVector tControls("Controls", tNumControls);
+    Plato::fill(static_cast<Plato::Scalar>(1), tControls);
+
+    // TEST GRADIENT WRT STATES: EACH VERTEX SENSOR CONTRIBUTES ONCE
+    auto tGrad = tScalarFunction.gradient_u(tStates, tControls, tFreqArray[0]);
+    TEST_EQUALITY(tGrad.size(), tTotalNumDofs);
+
+    auto tHostGrad = Kokkos::create_mirror(tGrad);
+    Kokkos::deep_copy(tHostGrad, tGrad);
+
+    const Plato::Scalar tTolerance = 1e-6;
+    for(Plato::OrdinalType tIndex = 0; tIndex < tTotalNumDofs; tIndex++)
+    {
+        const Plato::Scalar tGold = static_cast<Plato::Scalar>(-1.5e-2) * static_cast<Plato::Scalar>(tIndex);
+        TEST_FLOATING_EQUALITY(tHostGrad(tIndex), tGold, tTolerance);
+    }
+}
+
+TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, SparseFrequencyResponseMisfit_SensorCells)
+{
+    // BUILD OMEGA_H MESH
+    const Plato::OrdinalType tSpaceDim = 2;
+    const Plato::OrdinalType tMeshWidth = 8;
+    auto tMesh = PlatoUtestHelpers::getBoxMesh(tSpaceDim, tMeshWidth);
+
+    // SET EVALUATION TYPES FOR UNIT TEST
+    using JacobianU = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Jacobian;
+
+    // ONE INTERIOR SENSOR MEASURING ONE IN EVERY DOF; TRIAL STATES ARE ZERO
+    const Plato::OrdinalType tNumVertices = tMesh->nverts();
+    const Plato::OrdinalType tNumDofsPerNode = static_cast<Plato::OrdinalType>(2) * tSpaceDim;
+    const Plato::OrdinalType tTotalNumDofs = tNumVertices * tNumDofsPerNode;
+    Plato::ScalarVector tStates("States", tTotalNumDofs);
+    std::vector<Plato::Scalar> tFreqArray = {15.0};
+    Plato::ScalarArray3D tSensorData("SensorData", 1, 1, tNumDofsPerNode);
+    Kokkos::deep_copy(tSensorData, 1.0);
+    std::vector<Plato::Scalar> tSensorCoords = {0.3, 0.6};
+
+    Plato::DataMap tDataMap;
+    Omega_h::MeshSets tMeshSets;
+    auto tCriterion = std::make_shared<Plato::SparseFrequencyResponseMisfit<JacobianU>>
+            (*tMesh, tMeshSets, tDataMap, tFreqArray, tSensorCoords, tSensorData);
+    TEST_EQUALITY(tCriterion->getNumSensors(), static_cast<Plato::OrdinalType>(1));
+    TEST_EQUALITY(tCriterion->getNumSensorCells(), static_cast<Plato::OrdinalType>(1));
+    TEST_EQUALITY(tCriterion->getActiveCells().size(), static_cast<size_t>(1));
+
+    ScalarFunction<Plato::StructuralDynamics<tSpaceDim>> tScalarFunction(*tMesh, tDataMap);
+    tScalarFunction.allocateGradientU(tCriterion);
+    Plato::ScalarVector tControls("Controls", tNumVertices);
+    Plato::fill(static_cast<Plato::Scalar>(1), tControls);
+    auto tGrad = tScalarFunction.gradient_u(tStates, tControls, tFreqArray[0]);
+    auto tHostGrad = Kokkos::create_mirror(tGrad);
+    Kokkos::deep_copy(tHostGrad, tGrad);
+
+    // ONLY THE NODES OF THE SENSOR CELL GET A GRADIENT AND THEIR WEIGHTS SUM TO ONE
+    const Plato::Scalar tTolerance = 1e-12;
+    Plato::OrdinalType tNumActiveNodes = 0;
+    std::vector<Plato::Scalar> tDofSums(tNumDofsPerNode, 0.0);
+    for(Plato::OrdinalType tNode = 0; tNode < tNumVertices; tNode++)
+    {
+        bool tActive = false;
+        for(Plato::OrdinalType tDof = 0; tDof < tNumDofsPerNode; tDof++)
+        {
+            const Plato::Scalar tValue = tHostGrad(tNode * tNumDofsPerNode + tDof);
+            tActive = tActive || std::abs(tValue) > tTolerance;
+            tDofSums[tDof] += tValue;
+        }
+        tNumActiveNodes += tActive ? 1 : 0;
+    }
+    TEST_EQUALITY(tNumActiveNodes, static_cast<Plato::OrdinalType>(tSpaceDim + 1));
+    for(Plato::OrdinalType tDof = 0; tDof < tNumDofsPerNode; tDof++)
+    {
+        TEST_FLOATING_EQUALITY(tDofSums[tDof], -1.0, 1e-10);
+    }
+}
+
+TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, FrequencySweepOutput)
+{
+    // BUILD OMEGA_H MESH
+    const Plato::OrdinalType tSpaceDim = 2;
+    const Plato::OrdinalType tMeshWidth = 1;
+    auto tMesh = PlatoUtestHelpers::getBoxMesh(tSpaceDim, tMeshWidth);
+
+    // SET STATES FOR THREE FREQUENCIES
+    const Plato::OrdinalType tNumVertices = tMesh->nverts();
+    const Plato::OrdinalType tNumDofsPerNode = static_cast<Plato::OrdinalType>(2) * tSpaceDim;
+    const Plato::OrdinalType tTotalNumDofs = tNumVertices * tNumDofsPerNode;
+    std::vector<Plato::Scalar> tFreqArray = {5.0, 10.0, 15.0};
+    const Plato::OrdinalType tNumFreq = tFreqArray.size();
+    Plato::ScalarMultiVector tStates("States", tNumFreq, tTotalNumDofs);
+    auto tHostStates = Kokkos::create_mirror(tStates);
+    for(Plato::OrdinalType tFreq = 0; tFreq < tNumFreq; tFreq++)
+    {
+        for(Plato::OrdinalType tIndex = 0; tIndex < tTotalNumDofs; tIndex++)
+        {
+            tHostStates(tFreq, tIndex) = static_cast<Plato::Scalar>(100 * tFreq + tIndex) + static_cast<Plato::Scalar>(0.125);
+        }
+    }
+    Kokkos::deep_copy(tStates, tHostStates);
+
+    // WRITE AND READ THE WHOLE MESH IN DOUBLE PRECISION
+    const std::string tFileName = "frequency_sweep_test.bin";
+    {
+        Plato::FrequencySweepWriter<tSpaceDim> tWriter(*tMesh, tFileName);
+        tWriter.append(tFreqArray, tStates);
+        TEST_EQUALITY(tWriter.getNumFrequencies(), static_cast<std::int64_t>(tNumFreq));
+    }
+    {
+        Plato::FrequencySweepReader tReader(tFileName);
+        TEST_EQUALITY(tReader.getSpaceDim(), tSpaceDim);
+        TEST_EQUALITY(tReader.getNumDofsPerNode(), tNumDofsPerNode);
+        TEST_EQUALITY(tReader.getNumNodes(), static_cast<std::int64_t>(tNumVertices));
+        TEST_EQUALITY(tReader.getNumFrequencies(), static_cast<std::int64_t>(tNumFreq));
+
+        // every node is written, so the connectivity is the mesh connectivity
+        TEST_EQUALITY(tReader.getNumVertsPerElement(), tSpaceDim + 1);
+        TEST_EQUALITY(tReader.getNumElements(), static_cast<std::int64_t>(tMesh->nelems()));
+        Omega_h::HostRead<Omega_h::LO> tElemVerts(tMesh->ask_elem_verts());
+        auto tConnectivity = tReader.getConnectivity();
+        TEST_EQUALITY(tConnectivity.size(), static_cast<size_t>(tElemVerts.size()));
+        for(Omega_h::LO tIndex = 0; tIndex < tElemVerts.size(); tIndex++)
+        {
+            TEST_EQUALITY(tConnectivity[tIndex], static_cast<std::int64_t>(tElemVerts[tIndex]));
+        }
+
+        auto tFrequencies = tReader.getFrequencies();
+        for(Plato::OrdinalType tFreq = 0; tFreq < tNumFreq; tFreq++)
+        {
+            TEST_EQUALITY(tFrequencies[tFreq], tFreqArray[tFreq]);
+        }
+
+        auto tValues = tReader.readFrequency(1);
+        TEST_EQUALITY(tValues.size(), static_cast<size_t>(tTotalNumDofs));
+        for(Plato::OrdinalType tIndex = 0; tIndex < tTotalNumDofs; tIndex++)
+        {
+            TEST_EQUALITY(tValues[tIndex], tHostStates(1, tIndex));
+        }
+
+        auto tHistory = tReader.readNodeHistory(tReader.findNode(2));
+        TEST_EQUALITY(tHistory.size(), static_cast<size_t>(tNumFreq * tNumDofsPerNode));
+        for(Plato::OrdinalType tFreq = 0; tFreq < tNumFreq; tFreq++)
+        {
+            for(Plato::OrdinalType tDof = 0; tDof < tNumDofsPerNode; tDof++)
+            {
+                TEST_EQUALITY(tHistory[tFreq * tNumDofsPerNode + tDof], tHostStates(tFreq, 2 * tNumDofsPerNode + tDof));
+            }
+        }
+        TEST_THROW(tReader.readFrequency(tNumFreq), std::runtime_error);
+    }
+
+    // WRITE AND READ TWO NODES IN SINGLE PRECISION
+    std::vector<Omega_h::LO> tNodes = {3, 1};
+    Omega_h::HostWrite<Omega_h::LO> tHostNodes(tNodes.size());
+    tHostNodes[0] = tNodes[0];
+    tHostNodes[1] = tNodes[1];
+    {
+        Plato::FrequencySweepWriter<tSpaceDim> tWriter(*tMesh, tFileName, Omega_h::LOs(tHostNodes.write()), true);
+        tWriter.append(tFreqArray, tStates);
+    }
+    {
+        Plato::FrequencySweepReader tReader(tFileName);
+        TEST_EQUALITY(tReader.getNumNodes(), static_cast<std::int64_t>(2));
+        TEST_EQUALITY(tReader.findNode(0), static_cast<std::int64_t>(-1));
+        TEST_EQUALITY(tReader.findNode(1), static_cast<std::int64_t>(1));
+
+        // the two nodes span an edge but no triangle, so the edge is written
+        TEST_EQUALITY(tReader.getNumVertsPerElement(), 2);
+        TEST_EQUALITY(tReader.getNumElements(), static_cast<std::int64_t>(1));
+        auto tConnectivity = tReader.getConnectivity();
+        TEST_EQUALITY(tConnectivity[0] + tConnectivity[1], static_cast<std::int64_t>(1));
+        TEST_EQUALITY(tConnectivity[0] * tConnectivity[1], static_cast<std::int64_t>(0));
+
+        auto tValues = tReader.readFrequency(2);
+        const Plato::Scalar tTolerance = 1e-6;
+        for(Plato::OrdinalType tNode = 0; tNode < 2; tNode++)
+        {
+            for(Plato::OrdinalType tDof = 0; tDof < tNumDofsPerNode; tDof++)
+            {
+                TEST_FLOATING_EQUALITY(tValues[tNode * tNumDofsPerNode + tDof],
+                                       tHostStates(2, tNodes[tNode] * tNumDofsPerNode + tDof), tTolerance);
+            }
+        }
+    }
+    std::remove(tFileName.c_str());
+}
+
 TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, StructuralDynamicsSolve)
 {
     // CREATE 2D-MESH
@@ -1615,6 +1925,414 @@ TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, StructuralDynamicsSolve)
     //Plato::StructuralDynamicsOutput<tSpaceDim> tOutput(*tMesh);
 }
 
+TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, StructuralDynamicsModalSuperposition)
+{
+    // CREATE 2D-MESH
+    Omega_h::LO aNx = 4;
+    Omega_h::LO aNy = 4;
+    Omega_h::Real aX = 1;
+    Omega_h::Real aY = 1;
+    std::shared_ptr<Omega_h::Mesh> tMesh = PlatoUtestHelpers::build_2d_box_mesh(aX, aY, aNx, aNy);
+
+    // PROBLEM INPUTS
+    const Plato::Scalar tDensity = 1000;
+    const Plato::Scalar tPoissonRatio = 0.3;
+    const Plato::Scalar tYoungsModulus = 1e9;
+    const Plato::Scalar tMassPropDamping = 0.000025;
+    const Plato::Scalar tStiffPropDamping = 0.000023;
+
+    // ALLOCATE STRUCTURAL DYNAMICS RESIDUAL
+    Plato::DataMap tDataMap;
+    Omega_h::MeshSets tMeshSets;
+    const Plato::OrdinalType tSpaceDim = 2;
+    using ResidualT = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Residual;
+    using JacobianU = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Jacobian;
+    std::shared_ptr<Plato::StructuralDynamicsResidual<ResidualT, SIMP, Plato::HyperbolicTangentProjection>> tResidual;
+    tResidual = std::make_shared<Plato::StructuralDynamicsResidual<ResidualT, SIMP, Plato::HyperbolicTangentProjection>>(*tMesh, tMeshSets, tDataMap);
+    tResidual->setMaterialDensity(tDensity);
+    tResidual->setMassPropDamping(tMassPropDamping);
+    tResidual->setStiffPropDamping(tStiffPropDamping);
+    tResidual->setIsotropicLinearElasticMaterial(tYoungsModulus, tPoissonRatio);
+
+    std::shared_ptr<Plato::StructuralDynamicsResidual<JacobianU, SIMP, Plato::HyperbolicTangentProjection>> tJacobianState;
+    tJacobianState = std::make_shared<Plato::StructuralDynamicsResidual<JacobianU, SIMP, Plato::HyperbolicTangentProjection>>(*tMesh, tMeshSets, tDataMap);
+    tJacobianState->setMaterialDensity(tDensity);
+    tJacobianState->setMassPropDamping(tMassPropDamping);
+    tJacobianState->setStiffPropDamping(tStiffPropDamping);
+    tJacobianState->setIsotropicLinearElasticMaterial(tYoungsModulus, tPoissonRatio);
+
+    // ALLOCATE VECTOR FUNCTION
+    std::shared_ptr<VectorFunction<Plato::StructuralDynamics<tSpaceDim>>> tVectorFunction =
+        std::make_shared<VectorFunction<Plato::StructuralDynamics<tSpaceDim>>>(*tMesh, tDataMap);
+    tVectorFunction->allocateResidual(tResidual, tJacobianState);
+
+    // ALLOCATE STRUCTURAL DYNAMICS PROBLEM, KEEP EVERY MODE SO THE REDUCED BASIS IS COMPLETE
+    Plato::StructuralDynamicsProblem<Plato::StructuralDynamics<tSpaceDim>> tProblem(*tMesh, tVectorFunction);
+    const Plato::OrdinalType tNumFreeDofs = tSpaceDim * (tMesh->nverts() - (aNy + 1));
+    const Plato::Scalar tResidualTolerance = 1e-8;
+    tProblem.setModalSuperposition(tNumFreeDofs, tResidualTolerance);
+
+    // SET DIRICHLET BOUNDARY CONDITIONS
+    Plato::Scalar tValue = 0;
+    auto tNumDofsPerNode = 2*tSpaceDim;
+    Omega_h::LOs tCoordsX0 = PlatoUtestHelpers::get_2D_boundary_nodes_x0(*tMesh);
+    auto tNumDirichletDofs = tNumDofsPerNode*tCoordsX0.size();
+    Plato::ScalarVector tDirichletValues("DirichletValues", tNumDirichletDofs);
+    Plato::LocalOrdinalVector tDirichletDofs("DirichletDofs", tNumDirichletDofs);
+    PlatoUtestHelpers::set_dirichlet_boundary_conditions(tNumDofsPerNode, tValue, tCoordsX0, tDirichletDofs, tDirichletValues);
+    tProblem.setEssentialBoundaryConditions(tDirichletDofs, tDirichletValues);
+
+    // SET FREQUENCIES
+    std::vector<Plato::Scalar> tFreq = { 5, 10 };
+    tProblem.setFrequencyArray(tFreq);
+
+    // SET EXTERNAL FORCE
+    auto tNumDofs = tVectorFunction->size();
+    Plato::ScalarVector tPointLoad("PointLoad", tNumDofs);
+    Plato::ScalarMultiVector tValues("Values", 2, tSpaceDim);
+    auto tHostValues = Kokkos::create_mirror(tValues);
+    tHostValues(0,0) = 0;    tHostValues(1,0) = 0;
+    tHostValues(0,1) = -1e5; tHostValues(1,1) = -1e5;
+    Kokkos::deep_copy(tValues, tHostValues);
+    auto tTopOrdinalIndex = 0;
+    auto tNodeOrdinalsX1 = PlatoUtestHelpers::get_2D_boundary_nodes_x1(*tMesh);
+    PlatoUtestHelpers::set_point_load(tTopOrdinalIndex, tNodeOrdinalsX1, tValues, tPointLoad);
+    tProblem.setExternalForce(tPointLoad);
+
+    // SOLVE BY MODAL SUPERPOSITION
+    auto tNumVerts = tMesh->nverts();
+    Plato::ScalarVector tControl("Control", tNumVerts);
+    Kokkos::deep_copy(tControl, static_cast<Plato::Scalar>(1));
+    auto tSolution = tProblem.solution(tControl);
+
+    // TEST EIGENPAIRS: ASCENDING, MASS ORTHONORMAL AND K phi = lambda M phi
+    auto tModal = tProblem.getModalSuperposition();
+    TEST_EQUALITY(tModal->getNumModes(), tNumFreeDofs);
+    auto tEigenvalues = tModal->getEigenvalues();
+    auto tModes = tModal->getModes();
+    Plato::ScalarVector tStiffTimesMode("StiffTimesMode", tNumVerts * tSpaceDim);
+    Plato::ScalarVector tMassTimesMode("MassTimesMode", tNumVerts * tSpaceDim);
+    for(Plato::OrdinalType tMode = 0; tMode < tModal->getNumModes(); tMode++)
+    {
+        TEST_ASSERT(tEigenvalues[tMode] > 0.0);
+        if(tMode > 0)
+        {
+            TEST_ASSERT(tEigenvalues[tMode] >= tEigenvalues[tMode - 1]);
+        }
+        Plato::ScalarVector tModeShape = Kokkos::subview(tModes, tMode, Kokkos::ALL());
+        tModal->apply(tModal->getStiffness(), tModeShape, tStiffTimesMode);
+        tModal->apply(tModal->getMass(), tModeShape, tMassTimesMode);
+        TEST_FLOATING_EQUALITY(Plato::dot(tModeShape, tMassTimesMode), 1.0, 1e-8);
+        TEST_FLOATING_EQUALITY(Plato::dot(tModeShape, tStiffTimesMode), tEigenvalues[tMode], 1e-6);
+        if(tMode > 0)
+        {
+            Plato::ScalarVector tPrevShape = Kokkos::subview(tModes, tMode - 1, Kokkos::ALL());
+            TEST_ASSERT(std::abs(Plato::dot(tPrevShape, tMassTimesMode)) < 1e-8);
+        }
+    }
+
+    // TEST REDUCED SOLUTION AGAINST THE FULL OPERATOR AT EVERY FREQUENCY
+    for(Plato::OrdinalType tFreqIndex = 0; tFreqIndex < static_cast<Plato::OrdinalType>(tFreq.size()); tFreqIndex++)
+    {
+        Plato::ScalarVector tState = Kokkos::subview(tSolution, tFreqIndex, Kokkos::ALL());
+        auto tJacobian = tVectorFunction->gradient_u(tState, tControl, tFreq[tFreqIndex]);
+        Plato::ScalarVector tResult("Result", tNumDofs);
+        Plato::MatrixTimesVectorPlusVector(tJacobian, tState, tResult);
+        Plato::update(static_cast<Plato::Scalar>(-1.0), tPointLoad, static_cast<Plato::Scalar>(1.0), tResult);
+        tModal->zeroConstrainedDofs(tDirichletDofs, tResult);
+        auto tRelativeResidual = std::sqrt(Plato::dot(tResult, tResult) / Plato::dot(tPointLoad, tPointLoad));
+        TEST_ASSERT(tRelativeResidual < 1e-6);
+    }
+
+#ifdef HAVE_AMGX
+    // COMPARE AGAINST THE DIRECT FREQUENCY SWEEP
+    Plato::StructuralDynamicsProblem<Plato::StructuralDynamics<tSpaceDim>> tDirectProblem(*tMesh, tVectorFunction);
+    tDirectProblem.setEssentialBoundaryConditions(tDirichletDofs, tDirichletValues);
+    tDirectProblem.setFrequencyArray(tFreq);
+    tDirectProblem.setExternalForce(tPointLoad);
+    auto tDirectSolution = tDirectProblem.solution(tControl);
+    auto tHostSolution = Kokkos::create_mirror_view(tSolution);
+    Kokkos::deep_copy(tHostSolution, tSolution);
+    auto tHostDirectSolution = Kokkos::create_mirror_view(tDirectSolution);
+    Kokkos::deep_copy(tHostDirectSolution, tDirectSolution);
+    for(Plato::OrdinalType tFreqIndex = 0; tFreqIndex < static_cast<Plato::OrdinalType>(tFreq.size()); tFreqIndex++)
+    {
+        Plato::Scalar tErrorNorm = 0.0, tDirectNorm = 0.0;
+        for(Plato::OrdinalType tDof = 0; tDof < tNumDofs; tDof++)
+        {
+            auto tError = tHostSolution(tFreqIndex, tDof) - tHostDirectSolution(tFreqIndex, tDof);
+            tErrorNorm += tError * tError;
+            tDirectNorm += tHostDirectSolution(tFreqIndex, tDof) * tHostDirectSolution(tFreqIndex, tDof);
+        }
+        TEST_ASSERT(std::sqrt(tErrorNorm) < 1e-6 * std::sqrt(tDirectNorm));
+    }
+#endif
+}
+
+TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, StructuralDynamicsModalSuperpositionTruncated)
+{
+    // CREATE 2D-MESH
+    Omega_h::LO aNx = 8;
+    Omega_h::LO aNy = 8;
+    Omega_h::Real aX = 1;
+    Omega_h::Real aY = 1;
+    std::shared_ptr<Omega_h::Mesh> tMesh = PlatoUtestHelpers::build_2d_box_mesh(aX, aY, aNx, aNy);
+
+    // PROBLEM INPUTS
+    const Plato::Scalar tDensity = 1000;
+    const Plato::Scalar tPoissonRatio = 0.3;
+    const Plato::Scalar tYoungsModulus = 1e9;
+    const Plato::Scalar tMassPropDamping = 0.000025;
+    const Plato::Scalar tStiffPropDamping = 0.000023;
+
+    // ALLOCATE STRUCTURAL DYNAMICS StructuralDynamicsResidual
+    Plato::DataMap tDataMap;
+    Omega_h::MeshSets tMeshSets;
+    const Plato::OrdinalType tSpaceDim = 2;
+    using ResidualT = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Residual;
+    using JacobianU = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Jacobian;
+    std::shared_ptr<Plato::StructuralDynamicsResidual<ResidualT, SIMP, Plato::HyperbolicTangentProjection>> tResidual;
+    tResidual = std::make_shared<Plato::StructuralDynamicsResidual<ResidualT, SIMP, Plato::HyperbolicTangentProjection>>(*tMesh, tMeshSets, tDataMap);
+    tResidual->setMaterialDensity(tDensity);
+    tResidual->setMassPropDamping(tMassPropDamping);
+    tResidual->setStiffPropDamping(tStiffPropDamping);
+    tResidual->setIsotropicLinearElasticMaterial(tYoungsModulus, tPoissonRatio);
+
+    std::shared_ptr<Plato::StructuralDynamicsResidual<JacobianU, SIMP, Plato::HyperbolicTangentProjection>> tJacobianState;
+    tJacobianState = std::make_shared<Plato::StructuralDynamicsResidual<JacobianU, SIMP, Plato::HyperbolicTangentProjection>>(*tMesh, tMeshSets, tDataMap);
+    tJacobianState->setMaterialDensity(tDensity);
+    tJacobianState->setMassPropDamping(tMassPropDamping);
+    tJacobianState->setStiffPropDamping(tStiffPropDamping);
+    tJacobianState->setIsotropicLinearElasticMaterial(tYoungsModulus, tPoissonRatio);
+
+    // ALLOCATE VECTOR FUNCTION
+    std::shared_ptr<VectorFunction<Plato::StructuralDynamics<tSpaceDim>>> tVectorFunction =
+        std::make_shared<VectorFunction<Plato::StructuralDynamics<tSpaceDim>>>(*tMesh, tDataMap);
+    tVectorFunction->allocateResidual(tResidual, tJacobianState);
+
+    // ALLOCATE STRUCTURAL DYNAMICS PROBLEM, KEEP FAR FEWER MODES THAN FREE DOFS
+    Plato::StructuralDynamicsProblem<Plato::StructuralDynamics<tSpaceDim>> tProblem(*tMesh, tVectorFunction);
+    const Plato::OrdinalType tNumFreeDofs = tSpaceDim * (tMesh->nverts() - (aNy + 1));
+    const Plato::OrdinalType tNumModes = 10;
+    TEST_ASSERT(10 * tNumModes < tNumFreeDofs);
+    tProblem.setModalSuperposition(tNumModes, 1e-6);
+
+    // SET DIRICHLET BOUNDARY CONDITIONS
+    Plato::Scalar tValue = 0;
+    auto tNumDofsPerNode = 2*tSpaceDim;
+    Omega_h::LOs tCoordsX0 = PlatoUtestHelpers::get_2D_boundary_nodes_x0(*tMesh);
+    auto tNumDirichletDofs = tNumDofsPerNode*tCoordsX0.size();
+    Plato::ScalarVector tDirichletValues("DirichletValues", tNumDirichletDofs);
+    Plato::LocalOrdinalVector tDirichletDofs("DirichletDofs", tNumDirichletDofs);
+    PlatoUtestHelpers::set_dirichlet_boundary_conditions(tNumDofsPerNode, tValue, tCoordsX0, tDirichletDofs, tDirichletValues);
+    tProblem.setEssentialBoundaryConditions(tDirichletDofs, tDirichletValues);
+
+    // SET FREQUENCIES, ALL BELOW THE FIRST TRUNCATED EIGENFREQUENCY
+    std::vector<Plato::Scalar> tFreq;
+    for(Plato::OrdinalType tIndex = 1; tIndex <= 20; tIndex++)
+    {
+        tFreq.push_back(25.0 * tIndex);
+    }
+    const Plato::OrdinalType tNumFreq = tFreq.size();
+    tProblem.setFrequencyArray(tFreq);
+
+    // SET EXTERNAL FORCE
+    auto tNumDofs = tVectorFunction->size();
+    Plato::ScalarVector tPointLoad("PointLoad", tNumDofs);
+    Plato::ScalarMultiVector tValues("Values", 2, tSpaceDim);
+    auto tHostValues = Kokkos::create_mirror(tValues);
+    tHostValues(0,0) = 0;    tHostValues(1,0) = 0;
+    tHostValues(0,1) = -1e5; tHostValues(1,1) = -1e5;
+    Kokkos::deep_copy(tValues, tHostValues);
+    auto tTopOrdinalIndex = 0;
+    auto tNodeOrdinalsX1 = PlatoUtestHelpers::get_2D_boundary_nodes_x1(*tMesh);
+    PlatoUtestHelpers::set_point_load(tTopOrdinalIndex, tNodeOrdinalsX1, tValues, tPointLoad);
+    tProblem.setExternalForce(tPointLoad);
+
+    // SOLVE BY MODAL SUPERPOSITION
+    auto tNumVerts = tMesh->nverts();
+    Plato::ScalarVector tControl("Control", tNumVerts);
+    Kokkos::deep_copy(tControl, static_cast<Plato::Scalar>(1));
+    Kokkos::Timer tModalTimer;
+    auto tSolution = tProblem.solution(tControl);
+    Kokkos::fence();
+    const double tModalTime = tModalTimer.seconds();
+
+    // TEST EVERY FREQUENCY IS ACCEPTED FROM THE REDUCED BASIS AFTER AT MOST TWO CORRECTIONS
+    auto tModal = tProblem.getModalSuperposition();
+    TEST_EQUALITY(tModal->getNumModes(), tNumModes);
+    TEST_EQUALITY(tModal->getNumAcceptedSolves(), tNumFreq);
+    TEST_EQUALITY(tModal->getNumRejectedSolves(), 0);
+    TEST_ASSERT(tModal->getNumCorrections() <= 2 * tNumFreq);
+
+    // TEST REDUCED SOLUTION AGAINST THE FULL OPERATOR AT EVERY FREQUENCY
+    for(Plato::OrdinalType tFreqIndex = 0; tFreqIndex < tNumFreq; tFreqIndex++)
+    {
+        Plato::ScalarVector tState = Kokkos::subview(tSolution, tFreqIndex, Kokkos::ALL());
+        auto tJacobian = tVectorFunction->gradient_u(tState, tControl, tFreq[tFreqIndex]);
+        Plato::ScalarVector tResult("Result", tNumDofs);
+        Plato::MatrixTimesVectorPlusVector(tJacobian, tState, tResult);
+        Plato::update(static_cast<Plato::Scalar>(-1.0), tPointLoad, static_cast<Plato::Scalar>(1.0), tResult);
+        tModal->zeroConstrainedDofs(tDirichletDofs, tResult);
+        auto tRelativeResidual = std::sqrt(Plato::dot(tResult, tResult) / Plato::dot(tPointLoad, tPointLoad));
+        TEST_ASSERT(tRelativeResidual < 1e-6);
+    }
+
+#ifdef HAVE_AMGX
+    // COMPARE COST AND SOLUTION AGAINST THE DIRECT FREQUENCY SWEEP
+    Plato::StructuralDynamicsProblem<Plato::StructuralDynamics<tSpaceDim>> tDirectProblem(*tMesh, tVectorFunction);
+    tDirectProblem.setEssentialBoundaryConditions(tDirichletDofs, tDirichletValues);
+    tDirectProblem.setFrequencyArray(tFreq);
+    tDirectProblem.setExternalForce(tPointLoad);
+    Kokkos::Timer tDirectTimer;
+    auto tDirectSolution = tDirectProblem.solution(tControl);
+    Kokkos::fence();
+    const double tDirectTime = tDirectTimer.seconds();
+
+    // THE MODES ARE KEPT FOR THE SAME CONTROL, SO A SECOND SWEEP ONLY PAYS FOR THE REDUCED SOLVES
+    const Plato::OrdinalType tNumStiffnessSolves = tModal->getNumStiffnessSolves();
+    tModalTimer.reset();
+    tProblem.solution(tControl);
+    Kokkos::fence();
+    const double tModalResweepTime = tModalTimer.seconds();
+    TEST_EQUALITY(tModal->getNumAcceptedSolves(), 2 * tNumFreq);
+    out << "Modal sweep: " << tModalTime << " s with modes, " << tModalResweepTime << " s reusing them, "
+        << tModal->getNumStiffnessSolves() - tNumStiffnessSolves << " real stiffness solves per sweep, "
+        << tModal->getNumCorrections() << " corrections; direct sweep: " << tDirectTime << " s, "
+        << tNumFreq << " complex solves\n";
+
+    auto tHostSolution = Kokkos::create_mirror_view(tSolution);
+    Kokkos::deep_copy(tHostSolution, tSolution);
+    auto tHostDirectSolution = Kokkos::create_mirror_view(tDirectSolution);
+    Kokkos::deep_copy(tHostDirectSolution, tDirectSolution);
+    for(Plato::OrdinalType tFreqIndex = 0; tFreqIndex < tNumFreq; tFreqIndex++)
+    {
+        Plato::Scalar tErrorNorm = 0.0, tDirectNorm = 0.0;
+        for(Plato::OrdinalType tDof = 0; tDof < tNumDofs; tDof++)
+        {
+            auto tError = tHostSolution(tFreqIndex, tDof) - tHostDirectSolution(tFreqIndex, tDof);
+            tErrorNorm += tError * tError;
+            tDirectNorm += tHostDirectSolution(tFreqIndex, tDof) * tHostDirectSolution(tFreqIndex, tDof);
+        }
+        TEST_ASSERT(std::sqrt(tErrorNorm) < 1e-5 * std::sqrt(tDirectNorm));
+    }
+#else
+    out << "Modal sweep: " << tModalTime << " s, " << tModal->getNumStiffnessSolves() << " real stiffness solves, "
+        << tModal->getNumCorrections() << " corrections\n";
+#endif
+}
+
+TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, AdjointStructuralDynamicsModalSuperposition)
+{
+    // CREATE 2D-MESH
+    Omega_h::LO aNx = 8;
+    Omega_h::LO aNy = 8;
+    Omega_h::Real aX = 1;
+    Omega_h::Real aY = 1;
+    std::shared_ptr<Omega_h::Mesh> tMesh = PlatoUtestHelpers::build_2d_box_mesh(aX, aY, aNx, aNy);
+
+    // PROBLEM INPUTS
+    const Plato::Scalar tDensity = 1000;
+    const Plato::Scalar tPoissonRatio = 0.3;
+    const Plato::Scalar tYoungsModulus = 1e9;
+    const Plato::Scalar tMassPropDamping = 0.000025;
+    const Plato::Scalar tStiffPropDamping = 0.000023;
+
+    // ALLOCATE STRUCTURAL DYNAMICS AdjointStructuralDynamicsResidual
+    Plato::DataMap tDataMap;
+    Omega_h::MeshSets tMeshSets;
+    const Plato::OrdinalType tSpaceDim = 2;
+    using ResidualT = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Residual;
+    using JacobianU = typename Plato::Evaluation<Plato::StructuralDynamics<tSpaceDim>>::Jacobian;
+    std::shared_ptr<Plato::AdjointStructuralDynamicsResidual<ResidualT, SIMP, Plato::HyperbolicTangentProjection>> tResidual;
+    tResidual = std::make_shared<Plato::AdjointStructuralDynamicsResidual<ResidualT, SIMP, Plato::HyperbolicTangentProjection>>(*tMesh, tMeshSets, tDataMap);
+    tResidual->setMaterialDensity(tDensity);
+    tResidual->setMassPropDamping(tMassPropDamping);
+    tResidual->setStiffPropDamping(tStiffPropDamping);
+    tResidual->setIsotropicLinearElasticMaterial(tYoungsModulus, tPoissonRatio);
+
+    std::shared_ptr<Plato::AdjointStructuralDynamicsResidual<JacobianU, SIMP, Plato::HyperbolicTangentProjection>> tJacobianState;
+    tJacobianState = std::make_shared<Plato::AdjointStructuralDynamicsResidual<JacobianU, SIMP, Plato::HyperbolicTangentProjection>>(*tMesh, tMeshSets, tDataMap);
+    tJacobianState->setMaterialDensity(tDensity);
+    tJacobianState->setMassPropDamping(tMassPropDamping);
+    tJacobianState->setStiffPropDamping(tStiffPropDamping);
+    tJacobianState->setIsotropicLinearElasticMaterial(tYoungsModulus, tPoissonRatio);
+
+    // ALLOCATE VECTOR FUNCTION
+    std::shared_ptr<VectorFunction<Plato::StructuralDynamics<tSpaceDim>>> tVectorFunction =
+        std::make_shared<VectorFunction<Plato::StructuralDynamics<tSpaceDim>>>(*tMesh, tDataMap);
+    tVectorFunction->allocateResidual(tResidual, tJacobianState);
+
+    // ALLOCATE ADJOINT STRUCTURAL DYNAMICS PROBLEM, KEEP FAR FEWER MODES THAN FREE DOFS
+    Plato::StructuralDynamicsProblem<Plato::StructuralDynamics<tSpaceDim>> tProblem(*tMesh, tVectorFunction);
+    const Plato::OrdinalType tNumFreeDofs = tSpaceDim * (tMesh->nverts() - (aNy + 1));
+    const Plato::OrdinalType tNumModes = 10;
+    TEST_ASSERT(10 * tNumModes < tNumFreeDofs);
+    tProblem.setModalSuperposition(tNumModes, 1e-6);
+
+    // SET DIRICHLET BOUNDARY CONDITIONS
+    Plato::Scalar tValue = 0;
+    auto tNumDofsPerNode = 2*tSpaceDim;
+    Omega_h::LOs tCoordsX0 = PlatoUtestHelpers::get_2D_boundary_nodes_x0(*tMesh);
+    auto tNumDirichletDofs = tNumDofsPerNode*tCoordsX0.size();
+    Plato::ScalarVector tDirichletValues("DirichletValues", tNumDirichletDofs);
+    Plato::LocalOrdinalVector tDirichletDofs("DirichletDofs", tNumDirichletDofs);
+    PlatoUtestHelpers::set_dirichlet_boundary_conditions(tNumDofsPerNode, tValue, tCoordsX0, tDirichletDofs, tDirichletValues);
+    tProblem.setEssentialBoundaryConditions(tDirichletDofs, tDirichletValues);
+
+    // SET FREQUENCIES, ALL BELOW THE FIRST TRUNCATED EIGENFREQUENCY
+    std::vector<Plato::Scalar> tFreq;
+    for(Plato::OrdinalType tIndex = 1; tIndex <= 20; tIndex++)
+    {
+        tFreq.push_back(25.0 * tIndex);
+    }
+    const Plato::OrdinalType tNumFreq = tFreq.size();
+    tProblem.setFrequencyArray(tFreq);
+
+    // SET EXTERNAL FORCE
+    auto tNumDofs = tVectorFunction->size();
+    Plato::ScalarVector tPointLoad("PointLoad", tNumDofs);
+    Plato::ScalarMultiVector tValues("Values", 2, tSpaceDim);
+    auto tHostValues = Kokkos::create_mirror(tValues);
+    tHostValues(0,0) = 0;    tHostValues(1,0) = 0;
+    tHostValues(0,1) = -1e5; tHostValues(1,1) = -1e5;
+    Kokkos::deep_copy(tValues, tHostValues);
+    auto tTopOrdinalIndex = 0;
+    auto tNodeOrdinalsX1 = PlatoUtestHelpers::get_2D_boundary_nodes_x1(*tMesh);
+    PlatoUtestHelpers::set_point_load(tTopOrdinalIndex, tNodeOrdinalsX1, tValues, tPointLoad);
+    tProblem.setExternalForce(tPointLoad);
+
+    // SOLVE BY MODAL SUPERPOSITION
+    auto tNumVerts = tMesh->nverts();
+    Plato::ScalarVector tControl("Control", tNumVerts);
+    Kokkos::deep_copy(tControl, static_cast<Plato::Scalar>(1));
+    Kokkos::Timer tModalTimer;
+    auto tSolution = tProblem.solution(tControl);
+    Kokkos::fence();
+    const double tModalTime = tModalTimer.seconds();
+
+    // TEST EVERY FREQUENCY IS ACCEPTED FROM THE REDUCED BASIS AFTER AT MOST TWO CORRECTIONS
+    auto tModal = tProblem.getModalSuperposition();
+    TEST_EQUALITY(tModal->getNumModes(), tNumModes);
+    TEST_EQUALITY(tModal->getNumAcceptedSolves(), tNumFreq);
+    TEST_EQUALITY(tModal->getNumRejectedSolves(), 0);
+    TEST_ASSERT(tModal->getNumCorrections() <= 2 * tNumFreq);
+
+    // TEST REDUCED SOLUTION AGAINST THE FULL ADJOINT OPERATOR AT EVERY FREQUENCY
+    for(Plato::OrdinalType tFreqIndex = 0; tFreqIndex < tNumFreq; tFreqIndex++)
+    {
+        Plato::ScalarVector tState = Kokkos::subview(tSolution, tFreqIndex, Kokkos::ALL());
+        auto tJacobian = tVectorFunction->gradient_u(tState, tControl, tFreq[tFreqIndex]);
+        Plato::ScalarVector tResult("Result", tNumDofs);
+        Plato::MatrixTimesVectorPlusVector(tJacobian, tState, tResult);
+        Plato::update(static_cast<Plato::Scalar>(-1.0), tPointLoad, static_cast<Plato::Scalar>(1.0), tResult);
+        tModal->zeroConstrainedDofs(tDirichletDofs, tResult);
+        auto tRelativeResidual = std::sqrt(Plato::dot(tResult, tResult) / Plato::dot(tPointLoad, tPointLoad));
+        TEST_ASSERT(tRelativeResidual < 1e-6);
+    }
+    out << "Adjoint modal sweep: " << tModalTime << " s, " << tModal->getNumCorrections() << " corrections\n";
+}
+
 TEUCHOS_UNIT_TEST(PlatoLGRUnitTests, AdjointStructuralDynamicsSolve)
 {
     // CREATE 2D-MESH
@@ -0,0 +1,116 @@
+# Runs a baseline deck and a candidate deck meant to be cheaper, and fails
+# unless the candidate adapted its mesh fewer times. Both decks write a
+# CSV history with a "CPU time" column to "<deck name>_history.csv".
+# With RUNS=0 each deck runs once and the CPU time ratio is only
+# reported, since one wall-clock sample is too noisy to assert on.
+# With RUNS=<n> each deck runs n times and the test also fails unless
+# the candidate's median CPU time is at most 5/4 of the baseline's.
+#   cmake -DLGR=<lgr> -DBASELINE=<deck> -DCANDIDATE=<deck> [-DRUNS=<n>] \
+#     -P compare_timing.cmake
+
+if(NOT DEFINED RUNS)
+  set(RUNS 0)
+endif()
+
+# the last value in the "CPU time" column of a CSV history, in microseconds;
+# the CSV history prints every value as d.<17 digits>e<sign><exponent>
+function(lgr_csv_cpu_time_us csv out_us)
+  if(NOT EXISTS "${csv}")
+    message(FATAL_ERROR "no CSV history at ${csv}")
+  endif()
+  file(STRINGS "${csv}" lines)
+  list(GET lines 0 header)
+  list(GET lines -1 row)
+  string(REPLACE ", " ";" names "${header}")
+  string(REPLACE ", " ";" values "${row}")
+  list(FIND names "CPU time" column)
+  if(column LESS 0)
+    message(FATAL_ERROR "${csv} has no \"CPU time\" column")
+  endif()
+  list(GET values ${column} value)
+  if(NOT value MATCHES "^\\+?([0-9])\\.([0-9][0-9][0-9][0-9][0-9][0-9])[0-9]*e([-+][0-9]+)$")
+    message(FATAL_ERROR "${csv}: unexpected CPU time \"${value}\"")
+  endif()
+  # seven significant digits, so the value is their integer times 10^exponent
+  set(us "${CMAKE_MATCH_1}${CMAKE_MATCH_2}")
+  math(EXPR exponent "${CMAKE_MATCH_3}")
+  while(exponent GREATER 0)
+    math(EXPR us "${us} * 10")
+    math(EXPR exponent "${exponent} - 1")
+  endwhile()
+  while(exponent LESS 0)
+    math(EXPR us "${us} / 10")
+    math(EXPR exponent "${exponent} + 1")
+  endwhile()
+  set(${out_us} ${us} PARENT_SCOPE)
+endfunction()
+
+# the number of adaptations and the CPU time in microseconds of one run
+function(lgr_run_deck deck out_us out_adapts)
+  execute_process(COMMAND ${LGR} ${deck} RESULT_VARIABLE result
+    OUTPUT_VARIABLE output ERROR_VARIABLE output)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${deck} failed:\n${output}")
+  endif()
+  string(REGEX MATCHALL "adapt rebuild took" adapts "${output}")
+  list(LENGTH adapts nadapts)
+  get_filename_component(name ${deck} NAME_WE)
+  lgr_csv_cpu_time_us(${name}_history.csv us)
+  message(STATUS "${deck}: ${nadapts} adaptations, ${us} us")
+  set(${out_us} ${us} PARENT_SCOPE)
+  set(${out_adapts} ${nadapts} PARENT_SCOPE)
+endfunction()
+
+# the middle of a list of integers
+function(lgr_median values out_median)
+  set(sorted "")
+  foreach(value IN LISTS values)
+    set(index 0)
+    foreach(other IN LISTS sorted)
+      if(value LESS other)
+        break()
+      endif()
+      math(EXPR index "${index} + 1")
+    endforeach()
+    list(INSERT sorted ${index} ${value})
+  endforeach()
+  list(LENGTH sorted n)
+  math(EXPR middle "${n} / 2")
+  list(GET sorted ${middle} median)
+  set(${out_median} ${median} PARENT_SCOPE)
+endfunction()
+
+lgr_run_deck(${BASELINE} baseline_us baseline_adapts)
+lgr_run_deck(${CANDIDATE} candidate_us candidate_adapts)
+if(baseline_adapts EQUAL 0)
+  message(FATAL_ERROR "${BASELINE} never adapted, so there is nothing to save")
+endif()
+if(NOT candidate_adapts LESS baseline_adapts)
+  message(FATAL_ERROR "${CANDIDATE} adapted ${candidate_adapts} times, "
+    "no fewer than the ${baseline_adapts} of ${BASELINE}")
+endif()
+if(RUNS LESS 1)
+  message(STATUS "CPU time: ${candidate_us} us for ${CANDIDATE}, "
+    "${baseline_us} us for ${BASELINE} (one run each, not checked)")
+  return()
+endif()
+
+set(baseline_samples ${baseline_us})
+set(candidate_samples ${candidate_us})
+set(run 1)
+while(run LESS RUNS)
+  lgr_run_deck(${BASELINE} us adapts)
+  list(APPEND baseline_samples ${us})
+  lgr_run_deck(${CANDIDATE} us adapts)
+  list(APPEND candidate_samples ${us})
+  math(EXPR run "${run} + 1")
+endwhile()
+lgr_median("${baseline_samples}" baseline_us)
+lgr_median("${candidate_samples}" candidate_us)
+message(STATUS "median CPU time of ${RUNS} runs: ${candidate_us} us for "
+  "${CANDIDATE}, ${baseline_us} us for ${BASELINE}")
+math(EXPR limit_us "${baseline_us} * 5 / 4")
+if(candidate_us GREATER limit_us)
+  message(FATAL_ERROR "${CANDIDATE} took a median ${candidate_us} us, more "
+    "than 5/4 of the ${baseline_us} us of ${BASELINE}")
+endif()
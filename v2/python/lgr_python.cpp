@@ -0,0 +1,320 @@
+/* The "lgr" Python module: drives a Stepper in-process.
+
+   import lgr, numpy
+   sim = lgr.Simulation("input.yaml")
+   v = numpy.asarray(sim.field("velocity"))  # no copy, shape (n, ncomps)
+   sim.advance(10)                           # ten steps
+   v[:, 0] *= 0.5                            # seen by the next step
+   sim.set("CFL", 0.5)
+   handle = sim.snapshot()
+   sim.advance_to(1.0e-3)
+   sim.restore(handle)
+
+   Field arrays hold a reference to the storage they were taken from,
+   so they stay valid after adaptation, erosion or restore() but are then
+   detached from the simulation; take them again after any of those.
+   Unknown field or parameter names raise KeyError. */
+
+#include <Python.h>
+
+#include <Omega_h_input.hpp>
+#include <Omega_h_library.hpp>
+#include <lgr_stepper.hpp>
+
+#include <memory>
+
+namespace {
+
+std::unique_ptr<Omega_h::Library> library;
+
+Omega_h::Library* get_library() {
+  if (!library) {
+    int argc = 1;
+    char name[] = "lgr";
+    char* args[] = {name, nullptr};
+    char** argv = args;
+    library.reset(new Omega_h::Library(&argc, &argv));
+  }
+  return library.get();
+}
+
+/* a zero-copy view of one field, exported through the buffer protocol */
+struct FieldObject {
+  PyObject_HEAD
+  Omega_h::Write<double>* storage;
+  Py_ssize_t shape[2];
+  Py_ssize_t strides[2];
+};
+
+void Field_dealloc(FieldObject* self) {
+  delete self->storage;
+  Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+int Field_getbuffer(FieldObject* self, Py_buffer* view, int flags) {
+  if (view == nullptr) {
+    PyErr_SetString(PyExc_BufferError, "NULL view in getbuffer");
+    return -1;
+  }
+  view->buf = self->storage->data();
+  view->obj = reinterpret_cast<PyObject*>(self);
+  Py_INCREF(view->obj);
+  view->len = self->shape[0] * self->shape[1] * Py_ssize_t(sizeof(double));
+  view->readonly = 0;
+  view->itemsize = sizeof(double);
+  view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>("d") : nullptr;
+  // without PyBUF_ND the consumer gets the contiguous bytes, in 1-D
+  auto const is_nd = (flags & PyBUF_ND) == PyBUF_ND;
+  view->ndim = is_nd ? 2 : 1;
+  view->shape = is_nd ? self->shape : nullptr;
+  view->strides =
+      ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? self->strides : nullptr;
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+  return 0;
+}
+
+PyBufferProcs Field_as_buffer = {
+#if PY_MAJOR_VERSION < 3
+    nullptr, nullptr, nullptr, nullptr,
+#endif
+    reinterpret_cast<getbufferproc>(Field_getbuffer), nullptr};
+
+#if PY_MAJOR_VERSION < 3
+#define LGR_FIELD_FLAGS (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER)
+#else
+#define LGR_FIELD_FLAGS Py_TPFLAGS_DEFAULT
+#endif
+
+PyTypeObject FieldType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+    "lgr.Field",               /* tp_name */
+    sizeof(FieldObject),       /* tp_basicsize */
+    0,                         /* tp_itemsize */
+    (destructor)Field_dealloc, /* tp_dealloc */
+    0,                         /* tp_print */
+    0,                         /* tp_getattr */
+    0,                         /* tp_setattr */
+    0,                         /* tp_compare */
+    0,                         /* tp_repr */
+    0,                         /* tp_as_number */
+    0,                         /* tp_as_sequence */
+    0,                         /* tp_as_mapping */
+    0,                         /* tp_hash */
+    0,                         /* tp_call */
+    0,                         /* tp_str */
+    0,                         /* tp_getattro */
+    0,                         /* tp_setattro */
+    &Field_as_buffer,          /* tp_as_buffer */
+    LGR_FIELD_FLAGS,           /* tp_flags */
+    "zero-copy view of an LGR field", /* tp_doc */
+    0,                         /* tp_traverse */
+    0,                         /* tp_clear */
+    0,                         /* tp_richcompare */
+    0,                         /* tp_weaklistoffset */
+    0,                         /* tp_iter */
+    0,                         /* tp_iternext */
+    0,                         /* tp_methods */
+    0,                         /* tp_members */
+    0,                         /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,                         /* tp_init */
+    0,                         /* tp_alloc */
+    0,                         /* tp_new */
+};
+
+struct SimulationObject {
+  PyObject_HEAD
+  lgr::Stepper* stepper;
+};
+
+void Simulation_dealloc(SimulationObject* self) {
+  delete self->stepper;
+  Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+int Simulation_init(SimulationObject* self, PyObject* args, PyObject*) {
+  char* path;
+  if (!PyArg_ParseTuple(args, "s", &path)) return -1;
+  auto lib = get_library();
+  auto pl = Omega_h::read_input(path);
+  delete self->stepper;
+  self->stepper = new lgr::Stepper(lib->world(), pl);
+  return 0;
+}
+
+PyObject* Simulation_advance(SimulationObject* self, PyObject* args) {
+  int nsteps = 1;
+  if (!PyArg_ParseTuple(args, "|i", &nsteps)) return nullptr;
+  self->stepper->advance(nsteps);
+  Py_RETURN_NONE;
+}
+
+PyObject* Simulation_advance_to(SimulationObject* self, PyObject* args) {
+  double time;
+  if (!PyArg_ParseTuple(args, "d", &time)) return nullptr;
+  self->stepper->advance_to(time);
+  Py_RETURN_NONE;
+}
+
+PyObject* Simulation_done(SimulationObject* self) {
+  return PyBool_FromLong(self->stepper->is_done());
+}
+
+PyObject* Simulation_field(SimulationObject* self, PyObject* args) {
+#ifdef OMEGA_H_USE_CUDA
+  PyErr_SetString(PyExc_RuntimeError, "fields live in device memory");
+  return nullptr;
+#else
+  char* name;
+  if (!PyArg_ParseTuple(args, "s", &name)) return nullptr;
+  if (!self->stepper->has_field(name)) {
+    PyErr_Format(PyExc_KeyError, "no field named \"%s\" with values", name);
+    return nullptr;
+  }
+  auto field = PyObject_New(FieldObject, &FieldType);
+  if (field == nullptr) return nullptr;
+  field->storage = new Omega_h::Write<double>(self->stepper->field(name));
+  auto const ncomps = self->stepper->field_components(name);
+  field->shape[0] = field->storage->size() / ncomps;
+  field->shape[1] = ncomps;
+  field->strides[0] = ncomps * Py_ssize_t(sizeof(double));
+  field->strides[1] = sizeof(double);
+  return reinterpret_cast<PyObject*>(field);
+#endif
+}
+
+PyObject* Simulation_set(SimulationObject* self, PyObject* args) {
+  char* name;
+  double value;
+  if (!PyArg_ParseTuple(args, "sd", &name, &value)) return nullptr;
+  if (!self->stepper->can_set_parameter(name)) {
+    PyErr_Format(PyExc_KeyError, "no settable parameter named \"%s\"", name);
+    return nullptr;
+  }
+  self->stepper->set_parameter(name, value);
+  Py_RETURN_NONE;
+}
+
+PyObject* Simulation_get(SimulationObject* self, PyObject* args) {
+  char* name;
+  if (!PyArg_ParseTuple(args, "s", &name)) return nullptr;
+  if (!self->stepper->can_get_parameter(name)) {
+    PyErr_Format(PyExc_KeyError, "no parameter named \"%s\"", name);
+    return nullptr;
+  }
+  return PyFloat_FromDouble(self->stepper->get_parameter(name));
+}
+
+PyObject* Simulation_snapshot(SimulationObject* self) {
+  return Py_BuildValue("i", self->stepper->snapshot());
+}
+
+PyObject* Simulation_restore(SimulationObject* self, PyObject* args) {
+  int handle;
+  if (!PyArg_ParseTuple(args, "i", &handle)) return nullptr;
+  if (handle < 0 || handle >= int(self->stepper->snapshots.size())) {
+    PyErr_SetString(PyExc_IndexError, "no such snapshot");
+    return nullptr;
+  }
+  self->stepper->restore(handle);
+  Py_RETURN_NONE;
+}
+
+PyMethodDef Simulation_methods[] = {
+    {"advance", reinterpret_cast<PyCFunction>(Simulation_advance),
+        METH_VARARGS, "take up to the given number of steps (default 1)"},
+    {"advance_to", reinterpret_cast<PyCFunction>(Simulation_advance_to),
+        METH_VARARGS, "step until the given time"},
+    {"done", reinterpret_cast<PyCFunction>(Simulation_done), METH_NOARGS,
+        "whether the end time or end step has been reached"},
+    {"field", reinterpret_cast<PyCFunction>(Simulation_field), METH_VARARGS,
+        "a writable buffer over the named field"},
+    {"set", reinterpret_cast<PyCFunction>(Simulation_set), METH_VARARGS,
+        "set a scalar parameter or input variable"},
+    {"get", reinterpret_cast<PyCFunction>(Simulation_get), METH_VARARGS,
+        "get a scalar parameter, input variable, time, dt, step or CPU time"},
+    {"snapshot", reinterpret_cast<PyCFunction>(Simulation_snapshot),
+        METH_NOARGS, "save the state in memory and return a handle"},
+    {"restore", reinterpret_cast<PyCFunction>(Simulation_restore),
+        METH_VARARGS, "return to the state saved under a handle"},
+    {nullptr, nullptr, 0, nullptr} /* Sentinel */
+};
+
+PyTypeObject SimulationType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+    "lgr.Simulation",          /* tp_name */
+    sizeof(SimulationObject),  /* tp_basicsize */
+    0,                         /* tp_itemsize */
+    (destructor)Simulation_dealloc, /* tp_dealloc */
+    0,                         /* tp_print */
+    0,                         /* tp_getattr */
+    0,                         /* tp_setattr */
+    0,                         /* tp_compare */
+    0,                         /* tp_repr */
+    0,                         /* tp_as_number */
+    0,                         /* tp_as_sequence */
+    0,                         /* tp_as_mapping */
+    0,                         /* tp_hash */
+    0,                         /* tp_call */
+    0,                         /* tp_str */
+    0,                         /* tp_getattro */
+    0,                         /* tp_setattro */
+    0,                         /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,        /* tp_flags */
+    "an LGR simulation stepped from Python", /* tp_doc */
+    0,                         /* tp_traverse */
+    0,                         /* tp_clear */
+    0,                         /* tp_richcompare */
+    0,                         /* tp_weaklistoffset */
+    0,                         /* tp_iter */
+    0,                         /* tp_iternext */
+    Simulation_methods,        /* tp_methods */
+    0,                         /* tp_members */
+    0,                         /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    (initproc)Simulation_init, /* tp_init */
+    0,                         /* tp_alloc */
+    PyType_GenericNew,         /* tp_new */
+};
+
+PyMethodDef lgr_methods[] = {{nullptr, nullptr, 0, nullptr} /* Sentinel */};
+
+bool ready_types() {
+  return PyType_Ready(&FieldType) >= 0 && PyType_Ready(&SimulationType) >= 0;
+}
+
+}  // namespace
+
+#if PY_MAJOR_VERSION >= 3
+static PyModuleDef lgr_module = {PyModuleDef_HEAD_INIT, "lgr",
+    "In-process stepping of LGR simulations.", -1, lgr_methods, nullptr,
+    nullptr, nullptr, nullptr};
+
+PyMODINIT_FUNC PyInit_lgr(void) {
+  if (!ready_types()) return nullptr;
+  auto m = PyModule_Create(&lgr_module);
+  if (m == nullptr) return nullptr;
+  Py_INCREF(&SimulationType);
+  PyModule_AddObject(
+      m, "Simulation", reinterpret_cast<PyObject*>(&SimulationType));
+  return m;
+}
+#else
+PyMODINIT_FUNC initlgr(void) {
+  if (!ready_types()) return;
+  auto m = Py_InitModule3(
+      "lgr", lgr_methods, "In-process stepping of LGR simulations.");
+  Py_INCREF(&SimulationType);
+  PyModule_AddObject(
+      m, "Simulation", reinterpret_cast<PyObject*>(&SimulationType));
+}
+#endif
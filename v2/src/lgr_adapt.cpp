@@ -1,7 +1,9 @@
 #include <Omega_h_array_ops.hpp>
+#include <Omega_h_eigen.hpp>
 #include <Omega_h_map.hpp>
 #include <Omega_h_metric.hpp>
 #include <Omega_h_profile.hpp>
+#include <Omega_h_recover.hpp>
 #include <iostream>
 #include <lgr_adapt.hpp>
 #include <lgr_for.hpp>
@@ -9,7 +11,26 @@
 
 namespace lgr {
 
-Adapter::Adapter(Simulation& sim_in) : sim(sim_in) {}
+void RebuildTimes::clear() { phases.clear(); }
+
+Omega_h::Now RebuildTimes::lap(char const* phase, Omega_h::Now start) {
+  auto const end = Omega_h::now();
+  phases.push_back(std::make_pair(phase, end - start));
+  return end;
+}
+
+void RebuildTimes::print(char const* what, std::ostream& stream) const {
+  double total = 0.0;
+  for (auto& phase : phases) total += phase.second;
+  stream << what << " rebuild took " << total << " seconds:";
+  for (auto& phase : phases) {
+    stream << ' ' << phase.first << ' ' << phase.second;
+  }
+  stream << '\n';
+}
+
+Adapter::Adapter(Simulation& sim_in)
+    : sim(sim_in), should_use_solution_metric(false) {}
 
 void Adapter::setup(Omega_h::InputMap& pl) {
   should_adapt = pl.is_map("adapt");
@@ -40,6 +61,14 @@ void Adapter::setup(Omega_h::InputMap& pl) {
     this->gradation_rate = adapt_pl.get<double>("gradation rate", "1.0");
     should_coarsen_with_expansion =
         adapt_pl.get<bool>("coarsen with expansion", "false");
+    should_use_solution_metric = adapt_pl.is_map("metric");
+    if (should_use_solution_metric) {
+      if (should_coarsen_with_expansion) {
+        Omega_h_fail(
+            "\"coarsen with expansion\" only works with the implied metric\n");
+      }
+      setup_solution_metric(adapt_pl.get_map("metric"));
+    }
 #define LGR_EXPL_INST(Elem)                                                    \
   if (sim.elem_name == Elem::name()) {                                         \
     remap.reset(remap_factory<Elem>(sim));                                     \
@@ -54,6 +83,158 @@ void Adapter::setup(Omega_h::InputMap& pl) {
   }
 }
 
+/* metric:
+     sources:
+       - field: density
+         type: hessian        # or gradient
+         error: 1.0e-2        # scales the metric of this source
+         isotropic: false
+     element count: 5000      # optional: scale the metric to this many elements
+     maximum length: 0.1      # optional: a floor on the metric, so smooth
+                              # regions (zero Hessian) still get elements
+     maximum aspect ratio: 10.0
+   the metric is only generated once adaptation has been triggered; until
+   then the triggers measure the mesh against the metric it was last
+   adapted to */
+void Adapter::setup_solution_metric(Omega_h::InputMap& pl) {
+  auto& sources_pl = pl.get_list("sources");
+  bool const has_element_count = pl.is<double>("element count");
+  for (int i = 0; i < sources_pl.size(); ++i) {
+    auto& source_pl = sources_pl.get_map(i);
+    auto field_name = source_pl.get<std::string>("field");
+    auto fi = sim.fields.find(field_name);
+    if (!fi.is_valid()) {
+      Omega_h_fail("adapt metric source field \"%s\" is not defined\n",
+          field_name.c_str());
+    }
+    auto& field = sim.fields[fi];
+    if (field.ncomps != 1 ||
+        !(field.entity_type == NODES || field.entity_type == ELEMS)) {
+      Omega_h_fail(
+          "adapt metric source field \"%s\" must be a scalar on nodes or "
+          "elements\n",
+          field_name.c_str());
+    }
+    auto type_name = source_pl.get<std::string>("type", "hessian");
+    Omega_h_Source type;
+    if (type_name == "hessian") {
+      type = OMEGA_H_VARIATION;
+    } else if (type_name == "gradient") {
+      type = OMEGA_H_DERIVATIVE;
+    } else {
+      Omega_h_fail("unknown adapt metric source type \"%s\"\n",
+          type_name.c_str());
+    }
+    auto const error = source_pl.get<double>("error", "1.0");
+    auto const isotropy = source_pl.get<bool>("isotropic", "false")
+                              ? OMEGA_H_ISO_LENGTH
+                              : OMEGA_H_ANISOTROPIC;
+    auto const scales = has_element_count ? OMEGA_H_SCALES : OMEGA_H_ABSOLUTE;
+    metric_input.add_source(Omega_h::MetricSource(
+        type, error, "metric source " + field_name, isotropy, scales));
+    metric_fields.push_back(fi);
+  }
+  if (has_element_count) {
+    auto const count = pl.get<double>("element count");
+    metric_input.should_limit_element_count = true;
+    metric_input.max_element_count = count;
+    metric_input.min_element_count = count;
+  }
+  if (minimum_length > 0.0) {
+    metric_input.should_limit_lengths = true;
+    metric_input.min_length = minimum_length;
+  }
+  if (pl.is<double>("maximum length")) {
+    auto const max_length = pl.get<double>("maximum length");
+    if (!(max_length > minimum_length)) {
+      Omega_h_fail("adapt metric \"maximum length\" must exceed the "
+                   "\"minimum length\" %g\n",
+          minimum_length);
+    }
+    metric_input.should_limit_lengths = true;
+    metric_input.max_length = max_length;
+  }
+  // gradation is limited by adapt() for every kind of metric
+  metric_input.should_limit_gradation = false;
+  max_aspect_ratio = pl.get<double>("maximum aspect ratio", "0.0");
+}
+
+// raise the smallest eigenvalues of each metric so that no vertex asks for
+// elements longer than max_ratio times their shortest desired length
+template <int dim>
+static Omega_h::Reals limit_metric_aspect_ratio(
+    Omega_h::Reals metric, double max_ratio) {
+  auto const nverts = Omega_h::divide_no_remainder(
+      metric.size(), Omega_h::symm_ncomps(dim));
+  Omega_h::Write<double> out(metric.size());
+  auto const min_eigenvalue_ratio = 1.0 / square(max_ratio);
+  auto functor = OMEGA_H_LAMBDA(int vert) {
+    auto const m = Omega_h::get_symm<dim>(metric, vert);
+    auto decomp = Omega_h::decompose_eigen(m);
+    double largest = 0.0;
+    for (int i = 0; i < dim; ++i) {
+      largest = Omega_h::max2(largest, decomp.l[i]);
+    }
+    for (int i = 0; i < dim; ++i) {
+      decomp.l[i] = Omega_h::max2(decomp.l[i], largest * min_eigenvalue_ratio);
+    }
+    Omega_h::set_symm(out, vert, Omega_h::compose_ortho(decomp.q, decomp.l));
+  };
+  parallel_for(nverts, std::move(functor));
+  return out;
+}
+
+// the mean over each element's points of a scalar point field
+static Omega_h::Reals average_points(Omega_h::Reals points_data, int nelems) {
+  auto const npoints = Omega_h::divide_no_remainder(points_data.size(), nelems);
+  if (npoints == 1) return points_data;
+  Omega_h::Write<double> out(nelems);
+  auto functor = OMEGA_H_LAMBDA(int const elem) {
+    double sum = 0.0;
+    for (int point = 0; point < npoints; ++point) {
+      sum += points_data[elem * npoints + point];
+    }
+    out[elem] = sum / npoints;
+  };
+  parallel_for(nelems, std::move(functor));
+  return out;
+}
+
+void Adapter::generate_solution_metric() {
+  OMEGA_H_TIME_FUNCTION;
+  auto& mesh = sim.disc.mesh;
+  // the metric sources are recovered from vertex values, so element
+  // fields are averaged over their points and then onto vertices
+  sim.fields.copy_to_omega_h(sim.disc, metric_fields);
+  for (auto fi : metric_fields) {
+    auto& field = sim.fields[fi];
+    Omega_h::Reals vert_data;
+    if (field.entity_type == NODES) {
+      vert_data = mesh.get_array<double>(0, field.long_name);
+    } else {
+      auto const elem_data = average_points(
+          mesh.get_array<double>(mesh.dim(), field.long_name), mesh.nelems());
+      vert_data = Omega_h::project_by_average(&mesh, elem_data);
+    }
+    mesh.add_tag(0, "metric source " + field.long_name, 1, vert_data);
+  }
+  sim.fields.remove_from_omega_h(sim.disc, metric_fields);
+  auto metric = Omega_h::generate_metric(&mesh, metric_input);
+  for (auto fi : metric_fields) {
+    mesh.remove_tag(0, "metric source " + sim.fields[fi].long_name);
+  }
+  if (max_aspect_ratio > 0.0) {
+    if (mesh.dim() == 3) {
+      metric = limit_metric_aspect_ratio<3>(metric, max_aspect_ratio);
+    } else if (mesh.dim() == 2) {
+      metric = limit_metric_aspect_ratio<2>(metric, max_aspect_ratio);
+    }
+  }
+  auto const ncomps =
+      Omega_h::divide_no_remainder(metric.size(), mesh.nverts());
+  mesh.add_tag(0, "metric", ncomps, metric);
+}
+
 bool Adapter::adapt() {
   Omega_h::ScopedTimer timer("lgr::adapt");
   if (!should_adapt) return false;
@@ -73,22 +254,42 @@ bool Adapter::adapt() {
   auto const length_triggered =
       is_long_len && (is_increasing_len || is_really_long_len);
   if ((!quality_triggered) && (!length_triggered)) return false;
+  if (should_use_solution_metric) generate_solution_metric();
   if (should_coarsen_with_expansion) coarsen_metric_with_expansion();
   {
     auto metric = sim.disc.mesh.get_array<double>(0, "metric");
     metric = Omega_h::limit_metric_gradation(
         &sim.disc.mesh, metric, this->gradation_rate);
-    sim.disc.mesh.add_tag(0, "metric", 1, metric);
+    // a solution metric may be anisotropic
+    auto const ncomps =
+        Omega_h::divide_no_remainder(metric.size(), sim.disc.mesh.nverts());
+    sim.disc.mesh.add_tag(0, "metric", ncomps, metric);
   }
+  // every entity is renumbered by Omega_h::adapt, so all non-identity
+  // mappings have to be rebuilt here (unlike after flooding)
+  rebuild_times.clear();
+  auto t = Omega_h::now();
   remap->before_adapt();
+  t = rebuild_times.lap("remap before", t);
   sim.fields.forget_disc();
+  sim.supports.forget_disc();
   sim.subsets.forget_disc();
+  t = rebuild_times.lap("forget", t);
   Omega_h::adapt(&sim.disc.mesh, opts);
+  t = rebuild_times.lap("adapt", t);
   sim.disc.update_from_mesh();
+  t = rebuild_times.lap("disc", t);
   sim.subsets.learn_disc();
+  t = rebuild_times.lap("subsets", t);
   sim.fields.learn_disc();
+  t = rebuild_times.lap("fields", t);
   sim.models.learn_disc();
+  t = rebuild_times.lap("models", t);
   remap->after_adapt();
+  rebuild_times.lap("remap after", t);
+  if (opts.verbosity != Omega_h::SILENT && sim.comm->rank() == 0) {
+    rebuild_times.print("adapt", std::cout);
+  }
   old_quality = sim.disc.mesh.min_quality();
   old_length = sim.disc.mesh.max_length();
   return true;
@@ -2,12 +2,26 @@
 #define LGR_ADAPT_HPP
 
 #include <Omega_h_input.hpp>
+#include <Omega_h_metric.hpp>
+#include <Omega_h_timer.hpp>
+#include <iosfwd>
+#include <lgr_field_index.hpp>
 #include <lgr_remap.hpp>
+#include <utility>
+#include <vector>
 
 namespace lgr {
 
 struct Simulation;
 
+// wall-clock time of each phase of rebuilding LGR state after a mesh change
+struct RebuildTimes {
+  std::vector<std::pair<char const*, double>> phases;
+  void clear();
+  Omega_h::Now lap(char const* phase, Omega_h::Now start);
+  void print(char const* what, std::ostream& stream) const;
+};
+
 struct Adapter {
   Simulation& sim;
   Omega_h::AdaptOpts opts;
@@ -18,12 +32,20 @@ struct Adapter {
   double minimum_length;
   double gradation_rate;
   bool should_coarsen_with_expansion;
+  // metric built from the solution instead of the implied isotropic one
+  bool should_use_solution_metric;
+  Omega_h::MetricInput metric_input;
+  std::vector<FieldIndex> metric_fields;
+  double max_aspect_ratio;
   Adapter(Simulation& sim);
   void setup(Omega_h::InputMap& pl);
+  void setup_solution_metric(Omega_h::InputMap& pl);
   bool adapt();
   void coarsen_metric_with_expansion();
+  void generate_solution_metric();
   double old_quality;
   double old_length;
+  RebuildTimes rebuild_times;
 };
 
 }  // namespace lgr
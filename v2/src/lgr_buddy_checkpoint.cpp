@@ -0,0 +1,227 @@
+#include <Omega_h_file.hpp>
+#include <lgr_buddy_checkpoint.hpp>
+#include <lgr_response.hpp>
+#include <lgr_simulation.hpp>
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace lgr {
+
+namespace {
+
+constexpr char buddy_magic[8] = {'L', 'G', 'R', 'B', 'U', 'D', 'D', 'Y'};
+
+/* one rank's serialized state */
+struct BuddyState {
+  std::int32_t owner = -1;
+  std::int32_t step = 0;
+  std::int32_t osh_version = 0;
+  double time = 0.0;
+  double cpu_time = 0.0;
+  double dt = 0.0;
+  std::string bytes;
+};
+
+template <class T>
+void write_value(std::ostream& stream, T const& value) {
+  stream.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <class T>
+bool read_value(std::istream& stream, T& value) {
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return bool(stream);
+}
+
+void write_state(std::ostream& stream, BuddyState const& state) {
+  write_value(stream, state.owner);
+  write_value(stream, state.step);
+  write_value(stream, state.osh_version);
+  write_value(stream, state.time);
+  write_value(stream, state.cpu_time);
+  write_value(stream, state.dt);
+  write_value(stream, std::uint64_t(state.bytes.size()));
+  stream.write(state.bytes.data(), std::streamsize(state.bytes.size()));
+}
+
+bool read_state(std::istream& stream, BuddyState& state) {
+  std::uint64_t nbytes;
+  if (!(read_value(stream, state.owner) && read_value(stream, state.step) &&
+          read_value(stream, state.osh_version) &&
+          read_value(stream, state.time) &&
+          read_value(stream, state.cpu_time) && read_value(stream, state.dt) &&
+          read_value(stream, nbytes))) {
+    return false;
+  }
+  state.bytes.resize(std::size_t(nbytes));
+  stream.read(&state.bytes[0], std::streamsize(nbytes));
+  return bool(stream);
+}
+
+std::string spill_path(std::string const& directory, int rank) {
+  return directory + "/rank_" + std::to_string(rank) + ".lgrb";
+}
+
+/* looks for the state of rank "owner" in the spill file of rank "holder" */
+bool read_spill(std::string const& directory, int holder, int owner,
+    BuddyState& state) {
+  std::ifstream stream(spill_path(directory, holder), std::ios::binary);
+  if (!stream.is_open()) return false;
+  char magic[sizeof(buddy_magic)];
+  stream.read(magic, sizeof(magic));
+  if (!stream || std::memcmp(magic, buddy_magic, sizeof(magic)) != 0) {
+    return false;
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (!read_state(stream, state)) return false;
+    if (state.owner == owner) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+struct BuddyCheckpoint : public Response {
+  std::vector<FieldIndex> field_indices;
+  std::string directory;
+  int spill_every;
+  int count;
+  BuddyState own;
+  BuddyState buddy;
+  BuddyCheckpoint(Simulation& sim_in, Omega_h::InputMap& pl)
+      : Response(sim_in, pl),
+        directory(pl.get<std::string>("directory", "buddy_checkpoint")),
+        spill_every(pl.get<int>("spill every", "1")),
+        count(0) {
+    // recovery reads the spill files, so a checkpoint that never spills
+    // could not be restored from
+    if (spill_every < 1) {
+      Omega_h_fail("buddy checkpoint: \"spill every\" must be at least 1, "
+                   "got %d\n",
+          spill_every);
+    }
+    for (auto& field_ptr : sim.fields.storage) {
+      if ((field_ptr->remap_type != RemapType::NONE) &&
+          (field_ptr->remap_type != RemapType::SHAPE)) {
+        field_indices.push_back(sim.fields.find(field_ptr->long_name));
+      }
+    }
+  }
+  void out_of_line_virtual_method() override;
+  // the spill cadence
+  std::vector<long long> save_events() override final {
+    return {count};
+  }
+  void restore_events(std::vector<long long> const& events) override final {
+    count = int(events.at(0));
+  }
+  void serialize() {
+    sim.disc.mesh.set_coords(sim.get(sim.position));  // linear specific!
+    sim.fields.copy_to_omega_h(sim.disc, field_indices);
+    std::ostringstream stream(std::ios::binary);
+    Omega_h::binary::write(stream, &sim.disc.mesh);
+    sim.fields.remove_from_omega_h(sim.disc, field_indices);
+    own.owner = sim.comm->rank();
+    own.step = sim.step;
+    own.osh_version = Omega_h::binary::latest_version;
+    own.time = sim.time;
+    own.cpu_time = sim.cpu_time;
+    own.dt = sim.dt;
+    own.bytes = stream.str();
+  }
+  void exchange() {
+    auto const rank = sim.comm->rank();
+    auto const size = sim.comm->size();
+    if (size == 1) {
+      buddy = own;
+      return;
+    }
+#ifdef OMEGA_H_USE_MPI
+    auto const impl = sim.comm->get_impl();
+    int const to = (rank + 1) % size;
+    int const from = (rank + size - 1) % size;
+    std::ostringstream header_out(std::ios::binary);
+    BuddyState own_header = own;
+    own_header.bytes.clear();
+    write_state(header_out, own_header);
+    auto send_header = header_out.str();
+    std::string recv_header(send_header.size(), '\0');
+    MPI_Sendrecv(&send_header[0], int(send_header.size()), MPI_CHAR, to, 0,
+        &recv_header[0], int(recv_header.size()), MPI_CHAR, from, 0, impl,
+        MPI_STATUS_IGNORE);
+    std::istringstream header_in(recv_header, std::ios::binary);
+    OMEGA_H_CHECK(read_state(header_in, buddy));
+    std::uint64_t const send_size = own.bytes.size();
+    std::uint64_t recv_size = 0;
+    MPI_Sendrecv(&send_size, 1, MPI_UINT64_T, to, 1, &recv_size, 1,
+        MPI_UINT64_T, from, 1, impl, MPI_STATUS_IGNORE);
+    OMEGA_H_CHECK(send_size < std::uint64_t(INT_MAX));
+    OMEGA_H_CHECK(recv_size < std::uint64_t(INT_MAX));
+    buddy.bytes.resize(std::size_t(recv_size));
+    MPI_Sendrecv(&own.bytes[0], int(send_size), MPI_CHAR, to, 2,
+        &buddy.bytes[0], int(recv_size), MPI_CHAR, from, 2, impl,
+        MPI_STATUS_IGNORE);
+#else
+    (void)rank;
+    Omega_h_fail("buddy checkpoint: multiple ranks require MPI\n");
+#endif
+  }
+  void spill() {
+    Omega_h::safe_mkdir(directory.c_str());
+    auto const path = spill_path(directory, sim.comm->rank());
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) {
+      Omega_h_fail("buddy checkpoint: could not open \"%s\"\n", path.c_str());
+    }
+    stream.write(buddy_magic, sizeof(buddy_magic));
+    write_state(stream, own);
+    write_state(stream, buddy);
+  }
+  void respond() override final {
+    serialize();
+    exchange();
+    ++count;
+    if (spill_every > 0 && count % spill_every == 0) spill();
+  }
+};
+
+void BuddyCheckpoint::out_of_line_virtual_method() {}
+
+Response* buddy_checkpoint_factory(
+    Simulation& sim, std::string const&, Omega_h::InputMap& pl) {
+  return new BuddyCheckpoint(sim, pl);
+}
+
+void read_buddy_checkpoint(Simulation& sim, Omega_h::InputMap& pl) {
+  auto const directory = pl.get<std::string>("directory", "buddy_checkpoint");
+  auto const lost_rank = pl.get<int>("lost rank", "-1");
+  auto const rank = sim.comm->rank();
+  auto const size = sim.comm->size();
+  BuddyState state;
+  bool found = false;
+  if (rank != lost_rank) found = read_spill(directory, rank, rank, state);
+  if (!found) {
+    found = read_spill(directory, (rank + 1) % size, rank, state);
+  }
+  if (!found) {
+    Omega_h_fail("buddy checkpoint: no state for rank %d in \"%s\"\n", rank,
+        directory.c_str());
+  }
+  std::istringstream stream(state.bytes, std::ios::binary);
+  Omega_h::Mesh mesh(sim.comm->library());
+  Omega_h::binary::read(stream, sim.comm, &mesh, state.osh_version);
+  sim.disc.mesh = mesh;
+  sim.step = state.step;
+  sim.time = state.time;
+  sim.prev_time = state.time;
+  sim.start_cpu_time = state.cpu_time;
+  sim.cpu_time = state.cpu_time;
+  sim.dt = state.dt;
+  sim.prev_dt = state.dt;
+}
+
+}  // namespace lgr
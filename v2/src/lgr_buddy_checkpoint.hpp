@@ -0,0 +1,35 @@
+#ifndef LGR_BUDDY_CHECKPOINT_HPP
+#define LGR_BUDDY_CHECKPOINT_HPP
+
+#include <Omega_h_input.hpp>
+
+namespace lgr {
+
+struct Response;
+struct Simulation;
+
+/* Diskless checkpointing: at each event the response serializes this
+   rank's mesh and remapped fields into memory and trades a copy with its
+   buddy (rank r keeps its own state plus the state of rank r - 1).
+   Every "spill every" checkpoints (default 1) both copies are written to
+   "<directory>/rank_<r>.lgrb" on the local filesystem; only spilled
+   checkpoints can be restored.
+
+   A rerun restores from the spill files with
+
+   mesh:
+     buddy checkpoint:
+       directory: <directory>
+       lost rank: <r>       # optional, simulates losing rank r's file
+
+   A rank whose own file is missing (or is the lost rank) reads its state
+   from the copy held by rank r + 1. */
+
+Response* buddy_checkpoint_factory(
+    Simulation& sim, std::string const&, Omega_h::InputMap& pl);
+
+void read_buddy_checkpoint(Simulation& sim, Omega_h::InputMap& pl);
+
+}  // namespace lgr
+
+#endif
@@ -1,6 +1,7 @@
 #include <lgr_comparison.hpp>
 #include <lgr_response.hpp>
 #include <lgr_simulation.hpp>
+#include <limits>
 
 namespace lgr {
 
@@ -11,10 +12,24 @@ struct Comparison : public Response {
   std::shared_ptr<Omega_h::ExprOp> op;
   double tolerance;
   double floor;
+  // bounds may be given instead of an expected value
+  bool is_bound;
+  double minimum;
+  double maximum;
   Comparison(
       Simulation& sim_in, std::string const& name_in, Omega_h::InputMap& pl)
       : Response(sim_in, pl), name(name_in), env(1, 1) {
     scalar = pl.get<std::string>("scalar");
+    is_bound = pl.is<double>("minimum") || pl.is<double>("maximum");
+    if (is_bound) {
+      minimum = pl.is<double>("minimum")
+                    ? pl.get<double>("minimum")
+                    : -std::numeric_limits<double>::max();
+      maximum = pl.is<double>("maximum")
+                    ? pl.get<double>("maximum")
+                    : std::numeric_limits<double>::max();
+      return;
+    }
     tolerance = pl.get<double>("tolerance", "1e-10");
     floor = pl.get<double>("floor", "1e-10");
     auto str = pl.get<std::string>("expected value");
@@ -23,6 +38,14 @@ struct Comparison : public Response {
   }
   void respond() override final {
     auto value = sim.scalars.ask_value(scalar);
+    if (is_bound) {
+      if (!(minimum <= value && value <= maximum)) {
+        Omega_h_fail("Comparison %s of %s value %.17e to bounds [%.17e, "
+                     "%.17e] failed!\n",
+            name.c_str(), scalar.c_str(), value, minimum, maximum);
+      }
+      return;
+    }
     env.register_variable("t", Omega_h::any(sim.time));
     auto expected_value = Omega_h::any_cast<double>(op->eval(env));
     if (!Omega_h::are_close(value, expected_value, tolerance, floor)) {
@@ -34,7 +34,9 @@ void Condition::init() {
   auto vars_used = Omega_h::math_lang::get_symbols_used(str);
   uses_old_vals = (vars_used.count(field->short_name) != 0);
   needs_coords = vars_used.count("x");
-  needs_reeval = (needs_coords || uses_old_vals || vars_used.count("t"));
+  uses_time = vars_used.count("t");
+  needs_reeval = (needs_coords || uses_old_vals || uses_time);
+  cached_coords_version = 0;
   Omega_h::ExprOpsReader reader;
   try {
     op = reader.read_ops(str);
@@ -79,6 +81,7 @@ Condition::Condition(Field* field_in, Simulation& sim_in, Omega_h::InputMap& pl)
 
 void Condition::forget_disc() {
   env = decltype(env)();
+  cached_coords_version = 0;
   cached_values = decltype(cached_values)();
 }
 
@@ -106,18 +109,29 @@ void Condition::learn_disc() {
 
 double Condition::next_event(double time) { return when->next_event(time); }
 
-void Condition::apply(double prev_time, double time,
-    Omega_h::Read<double> node_coords, Fields& fields) {
+void Condition::apply(double prev_time, double time, Fields& fields) {
   if (!when->active(prev_time, time)) return;
-  apply(time, node_coords, fields);
+  apply(time, fields);
 }
 
-void Condition::apply(
-    double time, Omega_h::Read<double> node_coords, Fields& fields) {
+/* conditions that depend only on position are re-evaluated
+   when the position field changes, not on every application */
+bool Condition::needs_evaluation(Fields& fields) {
+  if (!cached_values.exists()) return true;
+  if (uses_old_vals || uses_time) return true;
+  if (needs_coords) {
+    return fields[sim_ptr->position].version != cached_coords_version;
+  }
+  return false;
+}
+
+void Condition::apply(double time, Fields& fields) {
   OMEGA_H_CHECK(field->storage.exists());
-  if (needs_reeval || (!cached_values.exists())) {
+  if (needs_evaluation(fields)) {
     if (needs_coords) {
-      Omega_h::Reals coords = support->ask_coords(time, node_coords);
+      auto& position = fields[sim_ptr->position];
+      Omega_h::Reals coords = support->ask_coords(position);
+      cached_coords_version = position.version;
       env.register_variable("x", Omega_h::any(coords));
     }
     env.register_variable("t", Omega_h::any(time));
@@ -168,4 +182,35 @@ void Condition::apply(
   fields.print_and_clear_set_fields();
 }
 
+// true if this condition sets the whole field to the same value everywhere
+bool Condition::is_uniform() {
+  return (support == field->support) && (!needs_reeval);
+}
+
+Omega_h::Read<double> Condition::evaluate_uniform(double time) {
+  OMEGA_H_CHECK(is_uniform());
+  Omega_h::ExprEnv uniform_env(1, support->subset->disc.dim());
+  for (auto& pair : sim_ptr->input_variables.env.variables) {
+    uniform_env.register_variable(pair.first, pair.second);
+  }
+  uniform_env.register_variable("t", Omega_h::any(time));
+  Omega_h::any result;
+  try {
+    result = op->eval(uniform_env);
+  } catch (Omega_h::ParserFail& e) {
+    Omega_h_fail(
+        "Caught exception while evaluating condition \"%s\" for field "
+        "\"%s\":\n%s\n",
+        str.c_str(), field->long_name.c_str(), e.what());
+  }
+  uniform_env.repeat(result);
+  auto values = Omega_h::any_cast<Omega_h::Reals>(result);
+  if (values.size() != field->ncomps) {
+    Omega_h_fail(
+        "Value of condition \"%s\" on field \"%s\" was of the wrong size\n",
+        str.c_str(), field->long_name.c_str());
+  }
+  return values;
+}
+
 }  // namespace lgr
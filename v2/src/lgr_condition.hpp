@@ -2,6 +2,7 @@
 #define LGR_CONDITION_HPP
 
 #include <Omega_h_expr.hpp>
+#include <cstdint>
 #include <lgr_class_names.hpp>
 #include <lgr_when.hpp>
 
@@ -24,7 +25,10 @@ struct Condition {
   std::unique_ptr<When> when;
   bool needs_reeval;
   bool needs_coords;
+  bool uses_time;
   bool uses_old_vals;
+  // version of the position field that cached_values were computed from
+  std::uint64_t cached_coords_version;
   SubsetBridge* bridge;
   Omega_h::Read<double> cached_values;
   Simulation* sim_ptr;
@@ -34,9 +38,11 @@ struct Condition {
   void forget_disc();
   void learn_disc();
   double next_event(double time);
-  void apply(double prev_time, double time, Omega_h::Read<double> node_coords,
-      Fields& fields);
-  void apply(double time, Omega_h::Read<double> node_coords, Fields& fields);
+  void apply(double prev_time, double time, Fields& fields);
+  void apply(double time, Fields& fields);
+  bool needs_evaluation(Fields& fields);
+  bool is_uniform();
+  Omega_h::Read<double> evaluate_uniform(double time);
 };
 
 }  // namespace lgr
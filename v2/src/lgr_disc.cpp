@@ -166,6 +166,8 @@ void Disc::setup(Omega_h::CommPtr comm, Omega_h::InputMap& pl) {
     Omega_h_fail(
         "CUBIT mesh requested but LGRTK not compiled with CUBIT support!\n");
 #endif
+  } else if (pl.is_map("buddy checkpoint")) {
+    // the mesh was already restored by read_buddy_checkpoint
   } else {
     Omega_h_fail("no input mesh!\n");
   }
@@ -199,6 +201,9 @@ void Disc::setup(Omega_h::CommPtr comm, Omega_h::InputMap& pl) {
     }
   }
   this->is_second_order_ = pl.get<bool>("add mid edge nodes", "false");
+  this->use_padded_adjacency_ = pl.get<bool>("padded adjacency", "false");
+  this->padded_block_size_ = pl.get<int>("padded adjacency block size", "32");
+  OMEGA_H_CHECK(padded_block_size_ > 0);
   std::set<int> volume_ids;
   for (auto& s : mesh.class_sets) {
     for (auto& cp : s.second) {
@@ -214,6 +219,50 @@ void Disc::setup(Omega_h::CommPtr comm, Omega_h::InputMap& pl) {
   this->update_from_mesh();
 }
 
+static PaddedAdj build_padded_adj(
+    Omega_h::Adj const adj, int block_size, int nodes_per_ent) {
+  auto const a2ab = adj.a2ab;
+  auto const ab2b = adj.ab2b;
+  auto const codes = adj.codes;
+  auto const nnodes = a2ab.size() - 1;
+  auto const nblocks = (nnodes + block_size - 1) / block_size;
+  Omega_h::Write<Omega_h::LO> block_sizes(nblocks, "padded_block_sizes");
+  auto size_functor = OMEGA_H_LAMBDA(int block) {
+    int width = 0;
+    for (int lane = 0; lane < block_size; ++lane) {
+      auto const node = block * block_size + lane;
+      if (node >= nnodes) break;
+      width = Omega_h::max2(width, a2ab[node + 1] - a2ab[node]);
+    }
+    block_sizes[block] = width * block_size;
+  };
+  Omega_h::parallel_for(nblocks, std::move(size_functor));
+  PaddedAdj out;
+  out.block_size = block_size;
+  out.block_offsets =
+      Omega_h::offset_scan(Omega_h::LOs(block_sizes), "padded_block_offsets");
+  auto const block_offsets = out.block_offsets;
+  auto const nslots = block_offsets.last();
+  Omega_h::Write<Omega_h::LO> ent_nodes(nslots, -1, "padded_ent_nodes");
+  auto fill_functor = OMEGA_H_LAMBDA(int node) {
+    auto const block = node / block_size;
+    auto const lane = node % block_size;
+    auto const block_begin = block_offsets[block];
+    auto const width = (block_offsets[block + 1] - block_begin) / block_size;
+    auto const begin = a2ab[node];
+    auto const valence = a2ab[node + 1] - begin;
+    OMEGA_H_CHECK(valence <= width);
+    for (int slot = 0; slot < valence; ++slot) {
+      auto const i = block_begin + slot * block_size + lane;
+      auto const ent_node = Omega_h::code_which_down(codes[begin + slot]);
+      ent_nodes[i] = ab2b[begin + slot] * nodes_per_ent + ent_node;
+    }
+  };
+  Omega_h::parallel_for(nnodes, std::move(fill_functor));
+  out.ent_nodes = ent_nodes;
+  return out;
+}
+
 void Disc::update_from_mesh() {
   if (is_second_order_) {
     OMEGA_H_CHECK(is_simplex_);
@@ -226,6 +275,10 @@ void Disc::update_from_mesh() {
     nodes2ents_[dim_] = mesh.ask_up(0, mesh.dim());
     node_coords_ = mesh.coords();
   }
+  if (use_padded_adjacency_) {
+    padded_nodes2ents_ = build_padded_adj(
+        nodes2ents_[dim_], padded_block_size_, nodes_per_ent_[ELEMS]);
+  }
 }
 
 int Disc::dim() { return mesh.dim(); }
@@ -246,6 +299,14 @@ Omega_h::Adj Disc::nodes_to_ents(EntityType type) {
   return nodes2ents_[dim_];
 }
 
+bool Disc::has_padded_nodes_to_ents() { return use_padded_adjacency_; }
+
+PaddedAdj Disc::padded_nodes_to_ents(EntityType type) {
+  OMEGA_H_CHECK(type == ELEMS);
+  OMEGA_H_CHECK(use_padded_adjacency_);
+  return padded_nodes2ents_;
+}
+
 Omega_h::LOs Disc::ents_on_closure(
     std::set<std::string> const& class_names, EntityType type) {
   if (class_names.empty()) return Omega_h::LOs({});
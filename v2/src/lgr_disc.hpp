@@ -10,12 +10,31 @@
 
 namespace lgr {
 
+/* ELLPACK-style copy of a nodes-to-entities adjacency.  Nodes are grouped
+   in blocks of block_size and every node in a block gets as many slots as
+   the largest valence in that block.  Slots are stored slot-major within
+   a block, so slot k of consecutive nodes is contiguous and node-centric
+   gathers can vectorize across nodes.  Each slot holds the flat offset
+   ent * nodes_per_ent + local node, so kernels index entity-node arrays
+   directly; padding slots hold -1.  Kernels visit every slot of their
+   block and skip the padding instead of exiting early, so all lanes of a
+   block run the same trip count without reading any entity through a
+   padding slot.  Only compute_stress_divergence uses this layout; mass
+   lumping does too little work per slot to pay for the padding. */
+struct PaddedAdj {
+  int block_size;
+  Omega_h::LOs block_offsets;
+  Omega_h::LOs ent_nodes;
+};
+
 struct Disc {
   int dim();
   int count(EntityType type);
   void setup(Omega_h::CommPtr comm, Omega_h::InputMap& pl);
   Omega_h::LOs ents_to_nodes(EntityType type);
   Omega_h::Adj nodes_to_ents(EntityType type);
+  bool has_padded_nodes_to_ents();
+  PaddedAdj padded_nodes_to_ents(EntityType type);
   Omega_h::LOs ents_on_closure(ClassNames const& class_names, EntityType type);
   ClassNames const& covering_class_names();
   int nodes_per_ent(EntityType type);
@@ -32,6 +51,9 @@ struct Disc {
   int nodes_per_ent_[4];
   Omega_h::LOs ents2nodes_[4];
   Omega_h::Adj nodes2ents_[4];
+  bool use_padded_adjacency_;
+  int padded_block_size_;
+  PaddedAdj padded_nodes2ents_;
   Omega_h::Reals node_coords_;
   ClassNames covering_class_names_;
 };
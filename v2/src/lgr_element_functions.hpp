@@ -249,7 +249,7 @@ OMEGA_H_INLINE Matrix<Tri6::nodes, Tri6::points> Tri6::basis_values() {
 }
 #endif
 
-#ifdef LGR_QUAD4
+#if defined(LGR_QUAD4) || defined(LGR_QUAD4R)
 OMEGA_H_INLINE Matrix<Quad4Side::nodes, Quad4Side::points>
 Quad4Side::basis_values() {
   Matrix<nodes, points> out;
@@ -258,6 +258,31 @@ Quad4Side::basis_values() {
   return out;
 }
 
+template <class Elem>
+OMEGA_H_INLINE void compute_quad_lengths(
+    Matrix<2, 4> node_coords, Shape<Elem>& shape) {
+  Matrix<2, 4> edge_vectors;
+  edge_vectors[0] = node_coords[1] - node_coords[0];
+  edge_vectors[1] = node_coords[2] - node_coords[1];
+  edge_vectors[2] = node_coords[3] - node_coords[2];
+  edge_vectors[3] = node_coords[0] - node_coords[3];
+  Vector<4> squared_edge_lengths;
+  for (int i = 0; i < 4; ++i) {
+    squared_edge_lengths[i] = Omega_h::norm_squared(edge_vectors[i]);
+  }
+  auto const max_squared_edge_length =
+      Omega_h::reduce(squared_edge_lengths, Omega_h::maximum<double>());
+  auto const min_squared_edge_length =
+      Omega_h::reduce(squared_edge_lengths, Omega_h::minimum<double>());
+  auto const max_edge_length = std::sqrt(max_squared_edge_length);
+  auto const min_edge_length = std::sqrt(min_squared_edge_length);
+  shape.lengths.viscosity_length = max_edge_length;
+  shape.lengths.time_step_length = min_edge_length;
+}
+#endif
+
+#ifdef LGR_QUAD4
+
 OMEGA_H_INLINE Matrix<2, 4> Quad4::pts() {
   Matrix<2, 4> out;
   out[0][0] = -1.0 / std::sqrt(3.0);
@@ -286,23 +311,7 @@ OMEGA_H_INLINE Matrix<2, 4> Quad4::bgrads(Vector<2> xi) {
 
 OMEGA_H_INLINE void Quad4::compute_lengths(
     Matrix<2, 4> node_coords, Shape<Quad4>& shape) {
-  Matrix<2, 4> edge_vectors;
-  edge_vectors[0] = node_coords[1] - node_coords[0];
-  edge_vectors[1] = node_coords[2] - node_coords[1];
-  edge_vectors[2] = node_coords[3] - node_coords[2];
-  edge_vectors[3] = node_coords[0] - node_coords[3];
-  Vector<4> squared_edge_lengths;
-  for (int i = 0; i < 4; ++i) {
-    squared_edge_lengths[i] = Omega_h::norm_squared(edge_vectors[i]);
-  }
-  auto const max_squared_edge_length =
-      Omega_h::reduce(squared_edge_lengths, Omega_h::maximum<double>());
-  auto const min_squared_edge_length =
-      Omega_h::reduce(squared_edge_lengths, Omega_h::minimum<double>());
-  auto const max_edge_length = std::sqrt(max_squared_edge_length);
-  auto const min_edge_length = std::sqrt(min_squared_edge_length);
-  shape.lengths.viscosity_length = max_edge_length;
-  shape.lengths.time_step_length = min_edge_length;
+  compute_quad_lengths(node_coords, shape);
 }
 
 OMEGA_H_INLINE void Quad4::compute_gradients(
@@ -355,6 +364,48 @@ OMEGA_H_INLINE Matrix<Quad4::nodes, Quad4::points> Quad4::basis_values() {
 }
 #endif
 
+#ifdef LGR_QUAD4R
+OMEGA_H_INLINE
+Shape<Quad4R> Quad4R::shape(Matrix<dim, nodes> node_coords) {
+  Shape<Quad4R> out;
+  compute_quad_lengths(node_coords, out);
+  // bilinear basis gradients at the centroid, xi = (0, 0)
+  Matrix<2, 4> dNdxi;
+  dNdxi[0] = Omega_h::vector_2(-0.25, -0.25);
+  dNdxi[1] = Omega_h::vector_2(0.25, -0.25);
+  dNdxi[2] = Omega_h::vector_2(0.25, 0.25);
+  dNdxi[3] = Omega_h::vector_2(-0.25, 0.25);
+  Matrix<4, 2> x = Omega_h::transpose(node_coords);
+  Matrix<2, 2> J = dNdxi * x;
+  Matrix<2, 2> Jinv = Omega_h::invert(J);
+  out.basis_gradients[0] = Jinv * dNdxi;
+  // |J| is linear in xi for a bilinear quad, so the centroid value
+  // times the reference area (4) is the exact element area
+  out.weights[0] = 4.0 * Omega_h::determinant(J);
+  return out;
+}
+
+OMEGA_H_INLINE
+constexpr double Quad4R::lumping_factor(int const /* node */) {
+  return 1.0 / 4.0;
+}
+
+OMEGA_H_INLINE Matrix<Quad4R::nodes, Quad4R::points> Quad4R::basis_values() {
+  Matrix<nodes, points> out;
+  for (int node = 0; node < nodes; ++node) out[0][node] = 1.0 / 4.0;
+  return out;
+}
+
+OMEGA_H_INLINE Vector<Quad4R::nodes> Quad4R::hourglass_base() {
+  Vector<nodes> out;
+  out[0] = 1.0;
+  out[1] = -1.0;
+  out[2] = 1.0;
+  out[3] = -1.0;
+  return out;
+}
+#endif
+
 #ifdef LGR_TET4
 OMEGA_H_INLINE Matrix<Tet4Side::nodes, Tet4Side::points>
 Tet4Side::basis_values() {
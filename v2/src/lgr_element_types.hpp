@@ -109,7 +109,7 @@ struct Tri6 {
 };
 #endif
 
-#ifdef LGR_QUAD4
+#if defined(LGR_QUAD4) || defined(LGR_QUAD4R)
 struct Quad4Side {
   static constexpr int dim = 2;
   static constexpr int nodes = 2;
@@ -119,7 +119,9 @@ struct Quad4Side {
   static OMEGA_H_INLINE Vector<points> weights(Matrix<dim, nodes>);
   static OMEGA_H_INLINE constexpr double lumping(int const node);
 };
+#endif
 
+#ifdef LGR_QUAD4
 struct Quad4 {
  public:
   static constexpr int dim = 2;
@@ -144,6 +146,25 @@ struct Quad4 {
 };
 #endif
 
+#ifdef LGR_QUAD4R
+// Quad4 with a single integration point at the centroid.
+// the hourglass modes this leaves unresisted are controlled by
+// apply_hourglass_forces (lgr_hourglass.hpp)
+struct Quad4R {
+  static constexpr int dim = 2;
+  static constexpr int nodes = 4;
+  static constexpr int points = 1;
+  static constexpr bool is_simplex = false;
+  static OMEGA_H_INLINE Shape<Quad4R> shape(Matrix<dim, nodes> node_coords);
+  static OMEGA_H_INLINE constexpr double lumping_factor(int /* node */);
+  static OMEGA_H_INLINE Matrix<nodes, points> basis_values();
+  // the nodal pattern of the hourglass mode in reference space
+  static OMEGA_H_INLINE Vector<nodes> hourglass_base();
+  static constexpr char const* name() { return "Quad4R"; }
+  using side = Quad4Side;
+};
+#endif
+
 #ifdef LGR_TET4
 struct Tet4Side {
   static constexpr int dim = 3;
@@ -262,6 +283,19 @@ struct CompTet {
 #define LGR_EXPL_INST_QUAD4_SIDE
 #endif
 
+#ifdef LGR_QUAD4R
+#define LGR_EXPL_INST_QUAD4R LGR_EXPL_INST(::lgr::Quad4R)
+#ifdef LGR_QUAD4
+// same side type as Quad4, which already instantiates it
+#define LGR_EXPL_INST_QUAD4R_SIDE
+#else
+#define LGR_EXPL_INST_QUAD4R_SIDE LGR_EXPL_INST(::lgr::Quad4R::side)
+#endif
+#else
+#define LGR_EXPL_INST_QUAD4R
+#define LGR_EXPL_INST_QUAD4R_SIDE
+#endif
+
 #ifdef LGR_TET4
 #define LGR_EXPL_INST_TET4 LGR_EXPL_INST(::lgr::Tet4)
 #define LGR_EXPL_INST_TET4_SIDE LGR_EXPL_INST(::lgr::Tet4::side)
@@ -282,6 +316,7 @@ struct CompTet {
   LGR_EXPL_INST_TRI3                                                           \
   LGR_EXPL_INST_TRI6                                                           \
   LGR_EXPL_INST_QUAD4                                                          \
+  LGR_EXPL_INST_QUAD4R                                                         \
   LGR_EXPL_INST_TET4                                                           \
   LGR_EXPL_INST_COMPTET
 
@@ -294,6 +329,8 @@ struct CompTet {
   LGR_EXPL_INST_TRI6_SIDE                                                      \
   LGR_EXPL_INST_QUAD4                                                          \
   LGR_EXPL_INST_QUAD4_SIDE                                                     \
+  LGR_EXPL_INST_QUAD4R                                                         \
+  LGR_EXPL_INST_QUAD4R_SIDE                                                    \
   LGR_EXPL_INST_TET4                                                           \
   LGR_EXPL_INST_TET4_SIDE                                                      \
   LGR_EXPL_INST_COMPTET
@@ -0,0 +1,411 @@
+#include <Omega_h_array_ops.hpp>
+#include <Omega_h_map.hpp>
+#include <Omega_h_mark.hpp>
+#include <Omega_h_profile.hpp>
+#include <Omega_h_unmap_mesh.hpp>
+#include <iostream>
+#include <lgr_erosion.hpp>
+#include <lgr_for.hpp>
+#include <lgr_scalar.hpp>
+#include <lgr_simulation.hpp>
+
+namespace lgr {
+
+Eroder::Eroder(Simulation& sim_in)
+    : sim(sim_in),
+      enabled(false),
+      eroded_mass(0.0),
+      eroded_energy(0.0),
+      eroded_elements(0) {}
+
+static void require_field(Simulation& sim, char const* name) {
+  if (!sim.fields.find(name).is_valid()) {
+    Omega_h_fail("erosion by %s needs a model that defines it\n", name);
+  }
+}
+
+void Eroder::setup(Omega_h::InputMap& pl) {
+  enabled = pl.is_map("erosion");
+  if (!enabled) return;
+  auto& erosion_pl = pl.get_map("erosion");
+  min_time_step = sim.get_double(erosion_pl, "minimum time step", "0.0");
+  max_plastic_strain =
+      sim.get_double(erosion_pl, "maximum equivalent plastic strain", "0.0");
+  max_volumetric_strain =
+      sim.get_double(erosion_pl, "maximum volumetric strain", "0.0");
+  min_quality = sim.get_double(erosion_pl, "minimum quality", "0.0");
+  if (!(min_time_step > 0.0 || max_plastic_strain > 0.0 ||
+          max_volumetric_strain > 0.0 || min_quality > 0.0)) {
+    Omega_h_fail("erosion needs at least one criterion\n");
+  }
+  if (sim.comm->size() != 1) {
+    Omega_h_fail("erosion is only supported in serial runs\n");
+  }
+  if (sim.disc.is_second_order_) {
+    Omega_h_fail("erosion is not supported with mid edge nodes\n");
+  }
+  if (max_plastic_strain > 0.0) {
+    require_field(sim, "equivalent plastic strain");
+  }
+  if (max_volumetric_strain > 0.0) require_field(sim, "deformation gradient");
+  eroded_nodal_mass = sim.fields.define("m_e", "eroded nodal mass", 1, NODES,
+      false, sim.disc.covering_class_names());
+  // an amount per node, which adaptation has to conserve
+  sim.fields[eroded_nodal_mass].remap_type = RemapType::LUMPED;
+  sim.fields[eroded_nodal_mass].default_value = "0.0";
+}
+
+// marks the elements of every point of the named field where
+// failed(data, point) is true
+template <class Elem, class Failed>
+static void mark_failed_points(Simulation& sim, char const* name,
+    Omega_h::Write<Omega_h::I8> elems_will_erode, Failed failed) {
+  auto const fi = sim.fields.find(name);
+  auto& field = sim.fields[fi];
+  if (!field.has()) return;
+  auto const data = sim.get(fi);
+  auto const mapping = field.support->subset->mapping;
+  auto const npoints = divide_no_remainder(data.size(), field.ncomps);
+  auto functor = OMEGA_H_LAMBDA(int point) {
+    if (!failed(data, point)) return;
+    auto const elem = mapping[point / Elem::points];
+    elems_will_erode[elem] = Omega_h::I8(1);
+  };
+  parallel_for("erosion by field", npoints, std::move(functor));
+}
+
+template <class Elem>
+Omega_h::Read<Omega_h::I8> Eroder::choose() {
+  Omega_h::ScopedTimer timer("Eroder::choose");
+  auto const nelems = sim.elems();
+  Omega_h::Write<Omega_h::I8> elems_will_erode(nelems, Omega_h::I8(0));
+  if (min_time_step > 0.0) {
+    auto const points_to_dt = sim.get(sim.point_time_step);
+    auto const cfl = sim.cfl;
+    auto const min_dt = min_time_step;
+    auto functor = OMEGA_H_LAMBDA(int elem) {
+      for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+        auto const point = elem * Elem::points + elem_pt;
+        if (cfl * points_to_dt[point] < min_dt) {
+          elems_will_erode[elem] = Omega_h::I8(1);
+        }
+      }
+    };
+    parallel_for("erosion by time step", nelems, std::move(functor));
+  }
+  if (max_plastic_strain > 0.0) {
+    auto const max_ep = max_plastic_strain;
+    mark_failed_points<Elem>(sim, "equivalent plastic strain",
+        elems_will_erode, OMEGA_H_LAMBDA(Omega_h::Reals data, int point) {
+          return data[point] > max_ep;
+        });
+  }
+  if (max_volumetric_strain > 0.0) {
+    auto const max_ev = max_volumetric_strain;
+    mark_failed_points<Elem>(sim, "deformation gradient", elems_will_erode,
+        OMEGA_H_LAMBDA(Omega_h::Reals data, int point) {
+          auto const J = determinant(getfull<Elem>(data, point));
+          return std::abs(J - 1.0) > max_ev;
+        });
+  }
+  if (min_quality > 0.0) {
+    sim.disc.mesh.set_coords(sim.get(sim.position));  // linear specific!
+    auto const qualities = sim.disc.mesh.ask_qualities();
+    auto const min_qual = min_quality;
+    auto functor = OMEGA_H_LAMBDA(int elem) {
+      if (qualities[elem] < min_qual) elems_will_erode[elem] = Omega_h::I8(1);
+    };
+    parallel_for("erosion by quality", nelems, std::move(functor));
+  }
+  return elems_will_erode;
+}
+
+/* moves the mass and momentum of each eroded element onto its surviving
+   nodes, and adds to the running totals what leaves the simulation:
+   the mass of eroded elements without surviving nodes, the eroded mass
+   earlier erosions left on nodes that are now dropped, their internal
+   energy, and the kinetic energy lost by merging momentum */
+template <class Elem>
+void Eroder::account(Omega_h::Read<Omega_h::I8> elems_will_erode,
+    Omega_h::Read<Omega_h::I8> nodes_will_stay) {
+  OMEGA_H_TIME_FUNCTION;
+  auto const nelems = sim.elems();
+  auto const elems_to_nodes = sim.elems_to_nodes();
+  auto const points_to_rho = sim.get(sim.density);
+  auto const points_to_w = sim.get(sim.weight);
+  auto const nodes_to_v = sim.get(sim.velocity);
+  auto const elems_to_mass = Omega_h::Write<double>(nelems, 0.0);
+  auto const elems_to_lost_mass = Omega_h::Write<double>(nelems, 0.0);
+  auto const elems_to_share = Omega_h::Write<double>(nelems, 0.0);
+  auto const elems_to_v = Omega_h::Write<double>(nelems * Elem::dim, 0.0);
+  auto elem_functor = OMEGA_H_LAMBDA(int elem) {
+    if (!elems_will_erode[elem]) return;
+    double elem_mass = 0.0;
+    for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+      auto const point = elem * Elem::points + elem_pt;
+      elem_mass += points_to_rho[point] * points_to_w[point];
+    }
+    int nstaying = 0;
+    // the velocity of the element's lumped mass
+    auto v = zero_vector<Elem::dim>();
+    for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+      auto const node = elems_to_nodes[elem * Elem::nodes + elem_node];
+      if (nodes_will_stay[node]) ++nstaying;
+      v += Elem::lumping_factor(elem_node) * getvec<Elem>(nodes_to_v, node);
+    }
+    elems_to_mass[elem] = elem_mass;
+    if (nstaying == 0) {
+      elems_to_lost_mass[elem] = elem_mass;
+    } else {
+      elems_to_share[elem] = elem_mass / nstaying;
+    }
+    setvec<Elem>(elems_to_v, elem, v);
+  };
+  parallel_for("erosion element mass", nelems, std::move(elem_functor));
+  eroded_mass +=
+      Omega_h::get_sum(sim.comm, Omega_h::Reals(elems_to_lost_mass));
+  // internal energy of the eroded elements
+  auto const sie_fi = sim.fields.find("specific internal energy");
+  if (sie_fi.is_valid() && sim.fields[sie_fi].has()) {
+    auto const points_to_e = sim.get(sie_fi);
+    auto const mapping = sim.fields[sie_fi].support->subset->mapping;
+    auto const npoints = points_to_e.size();
+    auto const points_to_energy = Omega_h::Write<double>(npoints, 0.0);
+    auto functor = OMEGA_H_LAMBDA(int subset_point) {
+      auto const elem = mapping[subset_point / Elem::points];
+      if (!elems_will_erode[elem]) return;
+      auto const point = elem * Elem::points + subset_point % Elem::points;
+      points_to_energy[subset_point] =
+          points_to_rho[point] * points_to_w[point] * points_to_e[subset_point];
+    };
+    parallel_for("erosion internal energy", npoints, std::move(functor));
+    eroded_energy +=
+        Omega_h::get_sum(sim.comm, Omega_h::Reals(points_to_energy));
+  }
+  /* a surviving node keeps its mass minus what the eroded elements had
+     lumped onto it, and gains their shares at their velocity, which
+     conserves momentum. the kinetic energy this merge loses, and that of
+     the dropped nodes, is eroded */
+  auto const nnodes = sim.nodes();
+  auto const nodes_to_m = sim.get(sim.nodal_mass);
+  auto const nodes_to_new_v = sim.getset(sim.velocity);
+  auto const nodes_to_elems = sim.nodes_to_elems();
+  auto const nodes_to_eroded_m = sim.getset(eroded_nodal_mass);
+  auto const nodes_to_energy = Omega_h::Write<double>(nnodes, 0.0);
+  auto const nodes_to_lost_mass = Omega_h::Write<double>(nnodes, 0.0);
+  auto node_functor = OMEGA_H_LAMBDA(int node) {
+    auto const m = nodes_to_m[node];
+    auto const v = getvec<Elem>(nodes_to_new_v, node);
+    auto const old_kinetic = 0.5 * m * (v * v);
+    if (!nodes_will_stay[node]) {
+      nodes_to_energy[node] = old_kinetic;
+      nodes_to_lost_mass[node] = nodes_to_eroded_m[node];
+      return;
+    }
+    auto kept = m;
+    double gained = 0.0;
+    auto momentum = zero_vector<Elem::dim>();
+    auto const begin = nodes_to_elems.a2ab[node];
+    auto const end = nodes_to_elems.a2ab[node + 1];
+    for (auto node_elem = begin; node_elem < end; ++node_elem) {
+      auto const elem = nodes_to_elems.ab2b[node_elem];
+      if (!elems_will_erode[elem]) continue;
+      for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+        if (elems_to_nodes[elem * Elem::nodes + elem_node] == node) {
+          kept -= elems_to_mass[elem] * Elem::lumping_factor(elem_node);
+        }
+      }
+      auto const share = elems_to_share[elem];
+      gained += share;
+      momentum += share * getvec<Elem>(elems_to_v, elem);
+    }
+    if (gained == 0.0) return;
+    auto const new_m = kept + gained;
+    auto const new_v = (kept * v + momentum) / new_m;
+    setvec<Elem>(nodes_to_new_v, node, new_v);
+    nodes_to_eroded_m[node] += gained;
+    nodes_to_energy[node] = old_kinetic - 0.5 * new_m * (new_v * new_v);
+  };
+  parallel_for("erosion nodes", nnodes, std::move(node_functor));
+  eroded_energy += Omega_h::get_sum(sim.comm, Omega_h::Reals(nodes_to_energy));
+  eroded_mass +=
+      Omega_h::get_sum(sim.comm, Omega_h::Reals(nodes_to_lost_mass));
+}
+
+// gives the sides exposed by erosion one new boundary class,
+// which is also added to the "eroded surface" set
+static void classify_eroded_sides(Omega_h::Mesh& mesh) {
+  auto const dim = mesh.dim();
+  auto const sides_are_exposed = Omega_h::mark_exposed_sides(&mesh);
+  auto const sides_were_interior = Omega_h::each_eq_to(
+      mesh.get_array<Omega_h::I8>(dim - 1, "class_dim"), Omega_h::I8(dim));
+  auto const sides_are_new =
+      Omega_h::land_each(sides_are_exposed, sides_were_interior);
+  if (Omega_h::get_max(sides_are_new) != Omega_h::I8(1)) return;
+  auto const new_class_id =
+      Omega_h::get_max(
+          mesh.get_array<Omega_h::ClassId>(dim - 1, "class_id")) +
+      1;
+  for (int ent_dim = 0; ent_dim < dim; ++ent_dim) {
+    auto const ents_are_new =
+        (ent_dim == dim - 1)
+            ? sides_are_new
+            : Omega_h::mark_down(&mesh, dim - 1, ent_dim, sides_are_new);
+    auto const class_dims =
+        Omega_h::deep_copy(mesh.get_array<Omega_h::I8>(ent_dim, "class_dim"));
+    auto const class_ids = Omega_h::deep_copy(
+        mesh.get_array<Omega_h::ClassId>(ent_dim, "class_id"));
+    auto functor = OMEGA_H_LAMBDA(int ent) {
+      if (ents_are_new[ent] && class_dims[ent] == Omega_h::I8(dim)) {
+        class_dims[ent] = Omega_h::I8(dim - 1);
+        class_ids[ent] = new_class_id;
+      }
+    };
+    parallel_for("classify eroded sides", mesh.nents(ent_dim),
+        std::move(functor));
+    mesh.set_tag(ent_dim, "class_dim", Omega_h::read(class_dims));
+    mesh.set_tag(ent_dim, "class_id", Omega_h::read(class_ids));
+  }
+  mesh.class_sets["eroded surface"].push_back(
+      {Omega_h::I8(dim - 1), new_class_id});
+}
+
+void Eroder::remove(Omega_h::Read<Omega_h::I8> elems_will_erode,
+    Omega_h::Read<Omega_h::I8> nodes_will_stay) {
+  OMEGA_H_TIME_FUNCTION;
+  auto& mesh = sim.disc.mesh;
+  auto const dim = mesh.dim();
+  rebuild_times.clear();
+  auto t = Omega_h::now();
+  // erosion only renumbers what survives, so every field with values
+  // is carried through exactly, whatever its remap type
+  std::vector<FieldIndex> field_indices;
+  for (auto const& field_ptr : sim.fields.storage) {
+    if (!field_ptr->has() || field_ptr->is_uniform) continue;
+    if (field_ptr->entity_type != NODES && field_ptr->entity_type != ELEMS) {
+      continue;
+    }
+    field_indices.push_back(sim.fields.find(field_ptr->long_name));
+  }
+  sim.fields.copy_to_omega_h(sim.disc, field_indices);
+  t = rebuild_times.lap("save fields", t);
+  sim.fields.forget_disc();
+  sim.supports.forget_disc();
+  sim.subsets.forget_disc();
+  t = rebuild_times.lap("forget", t);
+  auto const elems_will_stay = Omega_h::invert_marks(elems_will_erode);
+  Omega_h::LOs new_ents2old_ents[4];
+  new_ents2old_ents[0] = Omega_h::collect_marked(nodes_will_stay);
+  for (int ent_dim = 1; ent_dim < dim; ++ent_dim) {
+    new_ents2old_ents[ent_dim] = Omega_h::collect_marked(
+        Omega_h::mark_down(&mesh, dim, ent_dim, elems_will_stay));
+  }
+  new_ents2old_ents[dim] = Omega_h::collect_marked(elems_will_stay);
+  auto const class_sets = mesh.class_sets;
+  Omega_h::unmap_mesh(&mesh, new_ents2old_ents);
+  mesh.class_sets = class_sets;
+  classify_eroded_sides(mesh);
+  t = rebuild_times.lap("unmap", t);
+  sim.disc.update_from_mesh();
+  t = rebuild_times.lap("disc", t);
+  sim.subsets.learn_disc();
+  t = rebuild_times.lap("subsets", t);
+  sim.fields.learn_disc();
+  sim.models.learn_disc();
+  t = rebuild_times.lap("learn", t);
+  sim.fields.copy_from_omega_h(sim.disc, field_indices);
+  sim.fields.remove_from_omega_h(sim.disc, field_indices);
+  rebuild_times.lap("restore fields", t);
+  if (kernel_stats_enabled() && sim.comm->rank() == 0) {
+    rebuild_times.print("erosion", std::cout);
+  }
+}
+
+template <class Elem>
+bool Eroder::erode() {
+  if (!enabled) return false;
+  OMEGA_H_TIME_FUNCTION;
+  auto const elems_will_erode = choose<Elem>();
+  auto const nelems = sim.elems();
+  auto const nerode = Omega_h::collect_marked(elems_will_erode).size();
+  if (nerode == 0) return false;
+  if (nerode == nelems) Omega_h_fail("erosion would remove every element\n");
+  auto const nodes_will_stay = Omega_h::mark_down(&sim.disc.mesh, sim.dim(),
+      0, Omega_h::invert_marks(elems_will_erode));
+  auto const nnodes = sim.nodes();
+  auto const ndrop = nnodes - Omega_h::collect_marked(nodes_will_stay).size();
+  account<Elem>(elems_will_erode, nodes_will_stay);
+  remove(elems_will_erode, nodes_will_stay);
+  eroded_elements += nerode;
+  if (sim.comm->rank() == 0) {
+    std::cout << "eroded " << nerode << " elements and " << ndrop
+              << " nodes (" << eroded_elements << " elements in total)\n";
+  }
+  return true;
+}
+
+struct ErodedMass : public Scalar {
+  ErodedMass(Simulation& sim_in, std::string const& name_in)
+      : Scalar(sim_in, name_in) {}
+  void out_of_line_virtual_method() override;
+  double compute_value() override { return sim.eroder.eroded_mass; }
+};
+
+void ErodedMass::out_of_line_virtual_method() {}
+
+struct ErodedEnergy : public Scalar {
+  ErodedEnergy(Simulation& sim_in, std::string const& name_in)
+      : Scalar(sim_in, name_in) {}
+  void out_of_line_virtual_method() override;
+  double compute_value() override { return sim.eroder.eroded_energy; }
+};
+
+void ErodedEnergy::out_of_line_virtual_method() {}
+
+struct ErodedElements : public Scalar {
+  ErodedElements(Simulation& sim_in, std::string const& name_in)
+      : Scalar(sim_in, name_in) {}
+  void out_of_line_virtual_method() override;
+  double compute_value() override { return sim.eroder.eroded_elements; }
+};
+
+void ErodedElements::out_of_line_virtual_method() {}
+
+// the nodal mass plus the eroded mass, which stays constant
+struct TotalMass : public Scalar {
+  TotalMass(Simulation& sim_in, std::string const& name_in)
+      : Scalar(sim_in, name_in) {}
+  void out_of_line_virtual_method() override;
+  double compute_value() override {
+    return Omega_h::get_sum(sim.comm, sim.get(sim.nodal_mass)) +
+           sim.eroder.eroded_mass;
+  }
+};
+
+void TotalMass::out_of_line_virtual_method() {}
+
+Scalar* eroded_mass_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap&) {
+  return new ErodedMass(sim, name);
+}
+
+Scalar* eroded_energy_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap&) {
+  return new ErodedEnergy(sim, name);
+}
+
+Scalar* eroded_elements_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap&) {
+  return new ErodedElements(sim, name);
+}
+
+Scalar* total_mass_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap&) {
+  return new TotalMass(sim, name);
+}
+
+#define LGR_EXPL_INST(Elem) template bool Eroder::erode<Elem>();
+LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+
+}  // namespace lgr
@@ -0,0 +1,81 @@
+#ifndef LGR_EROSION_HPP
+#define LGR_EROSION_HPP
+
+#include <Omega_h_input.hpp>
+#include <lgr_adapt.hpp>
+#include <lgr_element_types.hpp>
+#include <lgr_field_index.hpp>
+#include <string>
+
+namespace lgr {
+
+struct Simulation;
+struct Scalar;
+
+/* Opt-in removal of failed elements, so that a few crushed elements
+   cannot dictate the global time step for the rest of a run.
+   erosion:
+     minimum time step: 1.0e-9   # CFL times the smallest point time step
+     maximum equivalent plastic strain: 2.0
+     maximum volumetric strain: 0.9   # |det(F) - 1|
+     minimum quality: 0.05
+   An element is eroded when any of the given criteria fails.
+   Eroded elements are removed from the mesh together with the nodes
+   that no longer touch a surviving element, and all subsets, fields
+   and models are rebuilt on the smaller mesh.
+   The mass of an eroded element is split evenly among its surviving
+   nodes, together with its momentum, and kept in the "eroded nodal mass"
+   field, which lump_masses adds to the nodal mass from then on and
+   adaptation remaps as a LUMPED amount per node.
+   Newly exposed sides are classified as one new boundary.
+   The rebuild phase times are printed when the "statistics" option of
+   the scheduling block is on.
+   Running totals are kept of what leaves the simulation: the mass of
+   eroded elements with no surviving node and the eroded nodal mass
+   carried by dropped nodes, and the internal energy of eroded elements
+   plus the kinetic energy lost by dropping nodes and merging momentum
+   onto the survivors. */
+struct Eroder {
+  Simulation& sim;
+  bool enabled;
+  double min_time_step;
+  double max_plastic_strain;
+  double max_volumetric_strain;
+  double min_quality;
+  FieldIndex eroded_nodal_mass;
+  double eroded_mass;
+  double eroded_energy;
+  int eroded_elements;
+  RebuildTimes rebuild_times;
+  Eroder(Simulation& sim_in);
+  void setup(Omega_h::InputMap& pl);
+  // returns true if any element was eroded
+  template <class Elem>
+  bool erode();
+  template <class Elem>
+  Omega_h::Read<Omega_h::I8> choose();
+  template <class Elem>
+  void account(Omega_h::Read<Omega_h::I8> elems_will_erode,
+      Omega_h::Read<Omega_h::I8> nodes_will_stay);
+  void remove(Omega_h::Read<Omega_h::I8> elems_will_erode,
+      Omega_h::Read<Omega_h::I8> nodes_will_stay);
+};
+
+// the running totals of the Eroder
+Scalar* eroded_mass_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap& pl);
+Scalar* eroded_energy_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap& pl);
+Scalar* eroded_elements_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap& pl);
+// the nodal mass plus the eroded mass
+Scalar* total_mass_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap& pl);
+
+#define LGR_EXPL_INST(Elem) extern template bool Eroder::erode<Elem>();
+LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+
+}  // namespace lgr
+
+#endif
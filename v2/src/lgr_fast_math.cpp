@@ -0,0 +1,15 @@
+#include <Omega_h_fail.hpp>
+#include <lgr_fast_math.hpp>
+
+namespace lgr {
+
+MathAccuracy read_math_accuracy(Omega_h::InputMap& pl) {
+  auto const name = pl.get<std::string>("math accuracy", "full");
+  if (name == "full") return MathAccuracy::FULL;
+  if (name == "high") return MathAccuracy::HIGH;
+  if (name == "low") return MathAccuracy::LOW;
+  Omega_h_fail("unknown math accuracy \"%s\", expected full, high or low\n",
+      name.c_str());
+}
+
+}  // namespace lgr
@@ -0,0 +1,158 @@
+#ifndef LGR_FAST_MATH_HPP
+#define LGR_FAST_MATH_HPP
+
+#include <Omega_h_input.hpp>
+#include <Omega_h_macros.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace lgr {
+
+/* Inline replacements for the libm functions used by constitutive
+   kernels. They are straight-line polynomial evaluations after an
+   exponent/mantissa range reduction, so they inline into kernels and
+   vectorize instead of becoming opaque calls.
+   A material model picks its tier with "math accuracy" in the input deck:
+     full: the std:: functions themselves (the default)
+     high: relative error below about 1e-12
+     low:  relative error below about 1e-7
+   pow(x, y) is computed as exp(y log(x)), whose relative error grows
+   with |y log(x)|; the tier bounds hold for |y log(x)| up to about 10.
+   Unlike std::pow it is NaN for all negative bases, even with integer
+   exponents, which constitutive laws do not need.
+   sqrt is a hardware instruction and is exact in every tier, so models
+   whose only libm call is sqrt (ideal gas, Mie-Gruneisen) have no tier. */
+enum class MathAccuracy { FULL, HIGH, LOW };
+
+// reads "math accuracy" from a material model's parameters
+MathAccuracy read_math_accuracy(Omega_h::InputMap& pl);
+
+namespace fast_math {
+
+OMEGA_H_INLINE std::uint64_t to_bits(double const x) {
+  std::uint64_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+OMEGA_H_INLINE double from_bits(std::uint64_t const bits) {
+  double x;
+  std::memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+// 2^k for normal results, -1022 <= k <= 1023
+OMEGA_H_INLINE double exp2i(int const k) {
+  return from_bits(std::uint64_t(k + 1023) << 52);
+}
+
+// ln(2) split so that k * ln2_hi is exact for |k| < 2^11
+constexpr double ln2_hi = 6.93147180369123816490e-01;
+constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+// exp(r) for |r| <= ln(2) / 2, truncated Taylor series.
+// the degree 10 remainder is below 2.2e-13, the degree 7 one below 5.3e-9
+OMEGA_H_INLINE double exp_reduced(double const r, bool const high) {
+  if (high) {
+    return 1.0 + r * (1.0 + r * (1.0 / 2.0 + r * (1.0 / 6.0 +
+           r * (1.0 / 24.0 + r * (1.0 / 120.0 + r * (1.0 / 720.0 +
+           r * (1.0 / 5040.0 + r * (1.0 / 40320.0 + r * (1.0 / 362880.0 +
+           r / 3628800.0)))))))));
+  }
+  return 1.0 + r * (1.0 + r * (1.0 / 2.0 + r * (1.0 / 6.0 +
+         r * (1.0 / 24.0 + r * (1.0 / 120.0 + r * (1.0 / 720.0 +
+         r / 5040.0))))));
+}
+
+// log(m) / (2 s) as a series in z = s^2, s = (m - 1) / (m + 1),
+// for sqrt(1/2) <= m <= sqrt(2), where z <= 0.0295.
+// the relative remainders are below 6.6e-14 and 2.0e-9
+OMEGA_H_INLINE double log_reduced(double const z, bool const high) {
+  if (high) {
+    return 1.0 + z * (1.0 / 3.0 + z * (1.0 / 5.0 + z * (1.0 / 7.0 +
+           z * (1.0 / 9.0 + z * (1.0 / 11.0 + z * (1.0 / 13.0 +
+           z / 15.0))))));
+  }
+  return 1.0 + z * (1.0 / 3.0 + z * (1.0 / 5.0 + z * (1.0 / 7.0 +
+         z / 9.0)));
+}
+
+}  // namespace fast_math
+
+// the special cases are selected after the main evaluation rather than
+// branched around, so that loops over points still vectorize
+OMEGA_H_INLINE double fast_exp(double const x, MathAccuracy const accuracy) {
+  using namespace fast_math;
+  if (accuracy == MathAccuracy::FULL) return std::exp(x);
+  constexpr double x_max = 709.782712893384;
+  constexpr double x_min = -745.1332191019412;
+  constexpr double log2e = 1.4426950408889634;
+  // adding and subtracting 1.5 * 2^52 rounds to the nearest integer
+  constexpr double shifter = 6755399441055744.0;
+  auto xc = (x < x_max) ? x : x_max;
+  xc = (xc > x_min) ? xc : x_min;
+  auto const k = (xc * log2e + shifter) - shifter;
+  auto const r = (xc - k * ln2_hi) - k * ln2_lo;
+  auto const p = exp_reduced(r, accuracy == MathAccuracy::HIGH);
+  // two factors keep 2^k representable at both ends of the range
+  auto const k1 = int(k) / 2;
+  auto const k2 = int(k) - k1;
+  auto const y = (p * exp2i(k1)) * exp2i(k2);
+  auto const y_big = (x > x_max) ? std::numeric_limits<double>::infinity() : y;
+  auto const y_small = (x < x_min) ? 0.0 : y_big;
+  return (x == x) ? y_small : x;
+}
+
+OMEGA_H_INLINE double fast_log(double const x, MathAccuracy const accuracy) {
+  using namespace fast_math;
+  if (accuracy == MathAccuracy::FULL) return std::log(x);
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  // subnormals are brought into the normal range first
+  auto const subnormal = x < std::numeric_limits<double>::min();
+  auto const y = subnormal ? x * 18014398509481984.0 : x;  // 2^54
+  auto const bits = to_bits(y);
+  // the biased exponent is converted to a double through its bits rather
+  // than through an integer, which has no vector conversion before AVX-512
+  auto const biased = from_bits(((bits >> 52) & 0x7ff) | 0x4330000000000000ULL);
+  auto e = (biased - 4503599627370496.0) - (subnormal ? 1077.0 : 1023.0);
+  auto m = from_bits((bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+  auto const big = m > 1.4142135623730951;
+  m = big ? 0.5 * m : m;
+  e = big ? e + 1.0 : e;
+  auto const s = (m - 1.0) / (m + 1.0);
+  auto const p = log_reduced(s * s, accuracy == MathAccuracy::HIGH);
+  auto const result = e * ln2_hi + ((2.0 * s) * p + e * ln2_lo);
+  auto const result_inf = (x == inf) ? inf : result;
+  auto const result_zero = (x == 0.0) ? -inf : result_inf;
+  return (x >= 0.0) ? result_zero : std::numeric_limits<double>::quiet_NaN();
+}
+
+OMEGA_H_INLINE double fast_pow(
+    double const x, double const y, MathAccuracy const accuracy) {
+  if (accuracy == MathAccuracy::FULL) return std::pow(x, y);
+  // a zero base gives exp(-inf) or exp(inf), a negative one NaN
+  auto const result = fast_exp(y * fast_log(x, accuracy), accuracy);
+  return (y == 0.0) ? 1.0 : result;
+}
+
+OMEGA_H_INLINE double fast_sqrt(double const x, MathAccuracy const) {
+  return std::sqrt(x);
+}
+
+OMEGA_H_INLINE double fast_cbrt(double const x, MathAccuracy const accuracy) {
+  if (accuracy == MathAccuracy::FULL) return std::cbrt(x);
+  auto const a = std::abs(x);
+  if (x == 0.0 || !(a < std::numeric_limits<double>::infinity())) return x;
+  auto y = fast_exp(fast_log(a, MathAccuracy::LOW) / 3.0, MathAccuracy::LOW);
+  if (accuracy == MathAccuracy::HIGH) {
+    // one Newton step squares the relative error of the low tier
+    y -= (y - a / (y * y)) / 3.0;
+  }
+  return (x < 0.0) ? -y : y;
+}
+
+}  // namespace lgr
+
+#endif
@@ -1,3 +1,5 @@
+#include <Omega_h_array_ops.hpp>
+#include <Omega_h_for.hpp>
 #include <lgr_field.hpp>
 #include <lgr_subset.hpp>
 #include <lgr_support.hpp>
@@ -16,11 +18,15 @@ Field::Field(std::string const& short_name_in, std::string const& long_name_in,
       on_points(on_points_in),
       class_names(class_names_in),
       filling_with_nan(filling_with_nan_in),
+      uniform_allowed(false),
+      is_uniform(false),
+      version(0),
       remap_type(RemapType::NONE) {}
 
 bool Field::has() { return storage.exists(); }
 
 void Field::ensure_allocated() {
+  if (is_uniform) promote();
   if (!has()) {
     storage = Omega_h::Write<double>(ncomps * support->count(), long_name);
     if (filling_with_nan) {
@@ -37,11 +43,13 @@ Omega_h::Read<double> Field::get() {
         "field \"%s\"\n",
         long_name.c_str());
   }
+  if (is_uniform) promote();
   return storage;
 }
 
 Omega_h::Write<double> Field::set() {
   ensure_allocated();
+  bump_version();
   return storage;
 }
 
@@ -52,17 +60,56 @@ Omega_h::Write<double> Field::getset() {
         "field \"%s\"\n",
         long_name.c_str());
   }
+  if (is_uniform) promote();
+  bump_version();
   return storage;
 }
 
-void Field::del() { storage = decltype(storage)(); }
+Omega_h::Read<double> Field::get_uniform_or_full() {
+  if (!has()) {
+    Omega_h_fail(
+        "attempt to read uninitialized "
+        "field \"%s\"\n",
+        long_name.c_str());
+  }
+  return storage;
+}
+
+Omega_h::Read<double> Field::broadcast() {
+  if (!is_uniform) return get();
+  auto const n = support->count();
+  auto const nc = ncomps;
+  Omega_h::Read<double> const value = storage;
+  Omega_h::Write<double> out(n * nc, long_name);
+  auto functor = OMEGA_H_LAMBDA(int i) {
+    for (int comp = 0; comp < nc; ++comp) out[i * nc + comp] = value[comp];
+  };
+  Omega_h::parallel_for(n, std::move(functor));
+  return out;
+}
+
+void Field::promote() {
+  OMEGA_H_CHECK(is_uniform);
+  auto const full = broadcast();
+  is_uniform = false;
+  storage = Omega_h::deep_copy(full, long_name);
+}
+
+void Field::del() {
+  storage = decltype(storage)();
+  is_uniform = false;
+  bump_version();
+}
+
+void Field::bump_version() { ++version; }
 
 void Field::finalize_definition(Supports& ss) {
   support = ss.get_support(entity_type, on_points, class_names);
 }
 
 void Field::forget_disc() {
-  del();
+  // a uniform value does not depend on the mesh, so it survives adaptation
+  if (!is_uniform) del();
   for (auto& c : conditions) c.forget_disc();
 }
 
@@ -81,13 +128,32 @@ bool Field::is_covered_by_conditions(double prev_time, double time) {
   return (covered_class_names == class_names);
 }
 
-void Field::apply_conditions(double prev_time, double time,
-    Omega_h::Read<double> node_coords, Fields& fields) {
+bool Field::apply_uniform_conditions(double prev_time, double time) {
+  if (!uniform_allowed) return false;
+  if (has() && !is_uniform) return false;
+  Condition* last_active = nullptr;
+  for (auto& c : conditions) {
+    if (!c.when->active(prev_time, time)) continue;
+    if (!c.is_uniform()) return false;
+    last_active = &c;
+  }
+  if (last_active == nullptr) return has();
+  // each active condition covers the whole field, so the last one wins
+  auto const values = last_active->evaluate_uniform(time);
+  storage = Omega_h::deep_copy(values, long_name);
+  is_uniform = true;
+  bump_version();
+  return true;
+}
+
+void Field::apply_conditions(
+    double prev_time, double time, Fields& fields) {
+  if (apply_uniform_conditions(prev_time, time)) return;
   if (!conditions.empty()) {
     ensure_allocated();
   }
   for (auto& c : conditions) {
-    c.apply(prev_time, time, node_coords, fields);
+    c.apply(prev_time, time, fields);
   }
 }
 
@@ -1,6 +1,7 @@
 #ifndef LGR_FIELD_HPP
 #define LGR_FIELD_HPP
 
+#include <cstdint>
 #include <lgr_condition.hpp>
 #include <lgr_entity_type.hpp>
 #include <lgr_remap_type.hpp>
@@ -25,7 +26,14 @@ struct Field {
   ClassNames class_names;
   bool filling_with_nan;
   Support* support;
+  /* when allowed (material constants), a field whose conditions all set
+     the same value everywhere keeps just ncomps values in storage and is
+     promoted to a full array the first time anything asks for one */
+  bool uniform_allowed;
+  bool is_uniform;
   Omega_h::Write<double> storage;
+  // bumped whenever storage may have changed; keys caches of derived arrays
+  std::uint64_t version;
   std::string default_value;
   RemapType remap_type;
   std::vector<Condition> conditions;
@@ -34,12 +42,18 @@ struct Field {
   Omega_h::Read<double> get();
   Omega_h::Write<double> set();
   Omega_h::Write<double> getset();
+  // the raw storage: ncomps values if is_uniform, else one per support entity
+  Omega_h::Read<double> get_uniform_or_full();
+  // full per-entity values without promoting a uniform field
+  Omega_h::Read<double> broadcast();
+  void promote();
   void del();
+  void bump_version();
   void finalize_definition(Supports& ss);
   void forget_disc();
   void learn_disc();
-  void apply_conditions(double prev_time, double time,
-      Omega_h::Read<double> node_coords, Fields& fields);
+  void apply_conditions(double prev_time, double time, Fields& fields);
+  bool apply_uniform_conditions(double prev_time, double time);
   bool is_covered_by_conditions(double prev_time, double time);
   double next_event(double time);
   void setup_conditions(Simulation& sim, Omega_h::InputList& pl);
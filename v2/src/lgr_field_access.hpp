@@ -157,6 +157,17 @@ struct MappedPointRead {
   }
 };
 
+/* scalar point data that may be stored as a single uniform value,
+   in which case every point reads data[0] */
+template <class Elem>
+struct UniformPointRead {
+  MappedPointRead<Elem> points;
+  bool is_uniform;
+  OMEGA_H_DEVICE double operator[](int const i) const {
+    return is_uniform ? points.data[0] : points[i];
+  }
+};
+
 struct MappedElemsToNodes {
   Mapping mapping;
   Omega_h::LOs data;
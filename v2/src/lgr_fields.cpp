@@ -197,7 +197,7 @@ void Fields::copy_to_omega_h(
       entity_dim = disc.dim();
     }
     auto& mapping = field.support->subset->mapping;
-    auto const data = field.get();
+    auto const data = field.broadcast();
     if (field.support->subset->mapping.is_identity) {
       auto ncomps =
           divide_no_remainder(data.size(), disc.mesh.nents(entity_dim));
@@ -216,6 +216,8 @@ void Fields::copy_from_omega_h(
   // linear specific!
   for (auto fi : field_indices) {
     auto& field = operator[](fi);
+    // uniform values were kept through forget_disc() and need no remap
+    if (field.is_uniform) continue;
     int entity_dim = -1;
     if (field.entity_type == NODES) {
       entity_dim = 0;
@@ -234,6 +236,7 @@ void Fields::copy_from_omega_h(
       auto subset_data = Omega_h::unmap(mapping.things, full_data, ncomps);
       field.storage = subset_data;
     }
+    field.bump_version();
   }
 }
 
@@ -8,6 +8,7 @@
 #include <lgr_flood.hpp>
 #include <lgr_for.hpp>
 #include <lgr_simulation.hpp>
+#include <set>
 
 namespace lgr {
 
@@ -110,7 +111,7 @@ Omega_h::LOs Flooder::choose() {
       cavity_volumes[vert] = min_volume;
     }
   };
-  parallel_for(nverts, std::move(predict_functor));
+  parallel_for("flood predict", nverts, std::move(predict_functor));
   verts_are_cands_r = read(verts_are_cands);
   if (get_max(verts_are_cands_r) != Omega_h::Byte(1)) {
     return Omega_h::LOs();
@@ -168,16 +169,50 @@ Omega_h::LOs Flooder::choose() {
       }
     }
   };
-  parallel_for(nverts, std::move(apply_functor));
+  parallel_for("flood apply", nverts, std::move(apply_functor));
   return pull_mapping;
 }
 
+using ClassPairs = std::set<std::pair<int, Omega_h::ClassId>>;
+
+static void insert_class_pairs(ClassPairs& pairs,
+    Omega_h::Read<Omega_h::I8> dims, Omega_h::Read<Omega_h::ClassId> ids,
+    Omega_h::Read<Omega_h::I8> marks) {
+  auto const marked = Omega_h::collect_marked(marks);
+  auto const marked_dims = Omega_h::HostRead<Omega_h::I8>(
+      Omega_h::unmap(marked, dims, 1));
+  auto const marked_ids = Omega_h::HostRead<Omega_h::ClassId>(
+      Omega_h::unmap(marked, ids, 1));
+  for (int i = 0; i < marked_ids.size(); ++i) {
+    pairs.insert(std::make_pair(int(marked_dims[i]), marked_ids[i]));
+  }
+}
+
+// the names of all sets containing one of the given classes
+static ClassNames get_class_names(
+    Omega_h::Mesh& mesh, ClassPairs const& pairs) {
+  ClassNames out;
+  for (auto& set : mesh.class_sets) {
+    for (auto& cp : set.second) {
+      if (pairs.count(std::make_pair(int(cp.dim), cp.id))) {
+        out.insert(set.first);
+        break;
+      }
+    }
+  }
+  return out;
+}
+
 void Flooder::flood_by_mapping(Omega_h::LOs pull_mapping) {
   OMEGA_H_TIME_FUNCTION;
   auto const dim = sim.disc.mesh.dim();
   auto const nelems = sim.disc.mesh.nelems();
+  rebuild_times.clear();
+  auto t = Omega_h::now();
   auto const elems_will_flood =
       neq_each(pull_mapping, Omega_h::LOs(nelems, 0, 1));
+  // classes of every entity whose classification this flood changes
+  ClassPairs changed_classes;
   Omega_h::Few<Omega_h::Read<Omega_h::I8>, 3> old_class_dims;
   Omega_h::Few<Omega_h::Read<Omega_h::ClassId>, 3> old_class_ids;
   for (int ent_dim = 0; ent_dim < dim; ++ent_dim) {
@@ -193,6 +228,8 @@ void Flooder::flood_by_mapping(Omega_h::LOs pull_mapping) {
       ents_should_declass =
           land_each(ents_should_declass, invert_marks(exposed_sides));
     }
+    insert_class_pairs(changed_classes, old_class_dims[ent_dim],
+        old_class_ids[ent_dim], ents_should_declass);
     auto const class_ids_w = deep_copy(old_class_ids[ent_dim]);
     auto const class_dims_w = deep_copy(old_class_dims[ent_dim]);
     auto const clear_functor = OMEGA_H_LAMBDA(int ent) {
@@ -206,26 +243,42 @@ void Flooder::flood_by_mapping(Omega_h::LOs pull_mapping) {
     sim.disc.mesh.set_tag(ent_dim, "class_id", Omega_h::read(class_ids_w));
     sim.disc.mesh.set_tag(ent_dim, "class_dim", Omega_h::read(class_dims_w));
   }
+  auto const elem_class_dims =
+      Omega_h::Read<Omega_h::I8>(nelems, Omega_h::I8(dim));
+  insert_class_pairs(changed_classes, elem_class_dims,
+      sim.disc.mesh.get_array<Omega_h::ClassId>(dim, "class_id"),
+      elems_will_flood);
   sim.disc.mesh.add_tag(dim, "class_id", 1,
       read(unmap(pull_mapping,
           sim.disc.mesh.get_array<Omega_h::ClassId>(dim, "class_id"), 1)));
+  insert_class_pairs(changed_classes, elem_class_dims,
+      sim.disc.mesh.get_array<Omega_h::ClassId>(dim, "class_id"),
+      elems_will_flood);
   Omega_h::finalize_classification(&sim.disc.mesh);
+  t = rebuild_times.lap("classify", t);
   std::vector<SavedField> saved_fields;
   for (auto const& field_ptr : sim.fields.storage) {
     if (field_ptr->remap_type == RemapType::NONE &&
         field_ptr->long_name != "position")
       continue;
+    if (field_ptr->is_uniform) continue;
     SavedField saved_field;
     saved_field.name = field_ptr->long_name;
     saved_field.data = field_ptr->storage;
     saved_field.mapping = field_ptr->support->subset->mapping;
     saved_fields.push_back(std::move(saved_field));
   }
+  t = rebuild_times.lap("save fields", t);
   sim.fields.forget_disc();
-  sim.subsets.forget_disc();
-  sim.subsets.learn_disc();
+  sim.supports.forget_disc();
+  t = rebuild_times.lap("forget", t);
+  // flooding keeps the entity numbering, so only subsets using a class
+  // that gained or lost entities are rebuilt
+  sim.subsets.relearn_disc(get_class_names(sim.disc.mesh, changed_classes));
+  t = rebuild_times.lap("subsets", t);
   sim.fields.learn_disc();
   sim.models.learn_disc();
+  t = rebuild_times.lap("learn", t);
   Omega_h::Write<int> old_inverse(nelems, -1);
   Omega_h::Write<int> new_inverse(nelems, -1);
   for (auto& saved_field : saved_fields) {
@@ -235,6 +288,7 @@ void Flooder::flood_by_mapping(Omega_h::LOs pull_mapping) {
     auto const new_mapping = field.support->subset->mapping;
     if (field.entity_type != ELEMS || field.remap_type == RemapType::SHAPE) {
       field.storage = saved_field.data;
+      field.bump_version();
       OMEGA_H_CHECK((old_mapping.is_identity && new_mapping.is_identity) ||
                     (old_mapping.things.size() == new_mapping.things.size()));
       continue;
@@ -274,6 +328,12 @@ void Flooder::flood_by_mapping(Omega_h::LOs pull_mapping) {
       Omega_h::map_value_into(-1, new_mapping.things, new_inverse);
     }
   }
+  rebuild_times.lap("flood fields", t);
+  // flooding only follows adaptation, so it shares the adapter's verbosity
+  if (sim.adapter.opts.verbosity != Omega_h::SILENT &&
+      sim.comm->rank() == 0) {
+    rebuild_times.print("flood", std::cout);
+  }
   std::cout << "done flooding\n";
 }
 
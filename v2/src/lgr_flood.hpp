@@ -2,6 +2,8 @@
 #define LGR_FLOOD_HPP
 
 #include <Omega_h_input.hpp>
+#include <lgr_adapt.hpp>
+#include <lgr_class_names.hpp>
 #include <lgr_field_index.hpp>
 
 namespace lgr {
@@ -13,6 +15,7 @@ struct Flooder {
   bool enabled;
   int max_depth;
   FieldIndex flood_priority;
+  RebuildTimes rebuild_times;
   Flooder(Simulation& sim_in);
   void setup(Omega_h::InputMap& pl);
   void flood();
@@ -0,0 +1,119 @@
+#include <Omega_h_fail.hpp>
+#include <Omega_h_input.hpp>
+#include <lgr_for.hpp>
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace lgr {
+
+namespace {
+
+struct Scheduling {
+  KernelPolicy default_policy;
+  bool statistics = false;
+  std::map<std::string, Schedule> by_name;
+  // resolved policies, one per kernel name
+  std::map<std::string, KernelPolicy> policies;
+  // call site name pointer -> its entry above, so repeated launches skip
+  // building a string; literals with the same text share one policy
+  std::map<char const*, KernelPolicy const*> by_site;
+  std::map<std::string, std::unique_ptr<KernelStats>> stats;
+};
+
+Scheduling& scheduling() {
+  static Scheduling singleton;
+  return singleton;
+}
+
+Schedule parse_schedule(std::string const& name) {
+  if (name == "static") return Schedule::STATIC;
+  if (name == "dynamic") return Schedule::DYNAMIC;
+  if (name == "guided") {
+#ifdef LGR_FOR_USE_KOKKOS
+    Omega_h_fail(
+        "kernel schedule \"guided\" is not available with Kokkos; "
+        "use \"dynamic\"\n");
+#endif
+    return Schedule::GUIDED;
+  }
+  Omega_h_fail("unknown kernel schedule \"%s\"\n", name.c_str());
+  return Schedule::STATIC;
+}
+
+char const* schedule_name(Schedule schedule) {
+  switch (schedule) {
+    case Schedule::STATIC: return "static";
+    case Schedule::DYNAMIC: return "dynamic";
+    case Schedule::GUIDED: return "guided";
+  }
+  return "";
+}
+
+}  // namespace
+
+KernelPolicy const& get_kernel_policy(char const* name) {
+  auto& s = scheduling();
+  auto it = s.by_site.find(name);
+  if (it != s.by_site.end()) return *(it->second);
+  std::string const key(name);
+  auto policy_it = s.policies.find(key);
+  if (policy_it == s.policies.end()) {
+    auto policy = s.default_policy;
+    auto named_it = s.by_name.find(key);
+    if (named_it != s.by_name.end()) policy.schedule = named_it->second;
+    if (s.statistics) {
+      auto& stats = s.stats[key];
+      if (!stats) stats.reset(new KernelStats());
+      policy.stats = stats.get();
+    }
+    policy_it = s.policies.emplace(key, policy).first;
+  }
+  s.by_site.emplace(name, &(policy_it->second));
+  return policy_it->second;
+}
+
+void setup_scheduling(Omega_h::InputMap& pl) {
+  auto& s = scheduling();
+  s.by_site.clear();
+  s.policies.clear();
+  s.default_policy.schedule =
+      parse_schedule(pl.get<std::string>("default", "static"));
+  s.default_policy.chunk_size = pl.get<int>("chunk size", "0");
+  s.statistics = pl.get<bool>("statistics", "false");
+  if (pl.is_map("kernels")) {
+    auto& kernels = pl.get_map("kernels");
+    for (auto it = kernels.map.begin(); it != kernels.map.end(); ++it) {
+      s.by_name[it->first] =
+          parse_schedule(kernels.get<std::string>(it->first));
+    }
+  }
+}
+
+bool kernel_stats_enabled() { return scheduling().statistics; }
+
+void print_kernel_stats() {
+  auto& s = scheduling();
+  if (s.stats.empty()) return;
+  std::printf("%-32s %9s %8s %12s %10s\n", "kernel", "schedule", "calls",
+      "seconds", "imbalance");
+  for (auto& pair : s.stats) {
+    auto& stats = *pair.second;
+    auto policy_it = s.by_name.find(pair.first);
+    auto const schedule = policy_it == s.by_name.end()
+                              ? s.default_policy.schedule
+                              : policy_it->second;
+    std::printf("%-32s %9s %8ld %12.6e ", pair.first.c_str(),
+        schedule_name(schedule), stats.calls, stats.seconds);
+    // only backends that time their threads can report an imbalance
+    if (stats.thread_timed_calls > 0 && stats.mean_thread_seconds > 0.0) {
+      std::printf("%10.3f\n", stats.max_thread_seconds / stats.mean_thread_seconds);
+    } else {
+      std::printf("%10s\n", "n/a");
+    }
+  }
+}
+
+}  // namespace lgr
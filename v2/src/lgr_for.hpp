@@ -2,11 +2,163 @@
 #define LGR_FOR_HPP
 
 #include <Omega_h_for.hpp>
+#include <Omega_h_profile.hpp>
+#include <Omega_h_timer.hpp>
+#include <utility>
+
+#if defined(OMEGA_H_USE_KOKKOS) || defined(OMEGA_H_USE_KOKKOSCORE)
+#define LGR_FOR_USE_KOKKOS
+#elif defined(OMEGA_H_USE_OPENMP)
+#define LGR_FOR_USE_OPENMP
+#include <omp.h>
+#endif
+
+namespace Omega_h {
+class InputMap;
+}
 
 namespace lgr {
 
-using Omega_h::parallel_for;
+/* Unnamed kernels always use the backend's static partition.  Named
+   kernels look up a schedule chosen in the "scheduling" block of the
+   input deck, so irregular loops (node valence, Newton iteration counts,
+   flood cavities) can be switched to dynamic or guided chunking without
+   touching the code (Kokkos has no guided schedule, so it is rejected
+   there):
+
+   scheduling:
+     default: static
+     chunk size: 64
+     statistics: true
+     kernels:
+       hyper ep kernel: dynamic
+*/
+
+enum class Schedule { STATIC, DYNAMIC, GUIDED };
+
+struct KernelStats {
+  long calls = 0;
+  double seconds = 0.0;
+  // per-call busiest and average thread time, summed over the calls that
+  // measured them; only the OpenMP backend times its threads
+  long thread_timed_calls = 0;
+  double max_thread_seconds = 0.0;
+  double mean_thread_seconds = 0.0;
+};
+
+struct KernelPolicy {
+  Schedule schedule = Schedule::STATIC;
+  int chunk_size = 0;
+  KernelStats* stats = nullptr;
+};
+
+KernelPolicy const& get_kernel_policy(char const* name);
+void setup_scheduling(Omega_h::InputMap& pl);
+// true when "statistics" is on, which also enables the phase timers
+bool kernel_stats_enabled();
+void print_kernel_stats();
 
+template <class T>
+void parallel_for(int n, T&& f) {
+  Omega_h::parallel_for(n, std::forward<T>(f));
 }
 
+/* runs f over [0, n) with the given schedule.  Returns whether the busiest
+   and the average per-thread time of this call were measured. */
+template <class T>
+bool scheduled_for(KernelPolicy const& policy, int n, T const& f,
+    double& max_thread_seconds, double& mean_thread_seconds) {
+#if defined(LGR_FOR_USE_KOKKOS)
+  if (policy.schedule == Schedule::STATIC) {
+    Kokkos::RangePolicy<Kokkos::Schedule<Kokkos::Static>> range(0, n);
+    if (policy.chunk_size > 0) range.set_chunk_size(policy.chunk_size);
+    Kokkos::parallel_for(range, f);
+  } else {
+    // setup_scheduling rejects "guided" on this backend
+    Kokkos::RangePolicy<Kokkos::Schedule<Kokkos::Dynamic>> range(0, n);
+    if (policy.chunk_size > 0) range.set_chunk_size(policy.chunk_size);
+    Kokkos::parallel_for(range, f);
+  }
+  Kokkos::fence();
+  // the range policy does not expose its threads, so there is no
+  // per-thread time to compare
+  (void)max_thread_seconds;
+  (void)mean_thread_seconds;
+  return false;
+#elif defined(LGR_FOR_USE_OPENMP)
+  // schedule(runtime) reads a global ICV; set it for this loop only and
+  // put back whatever the caller (or OMP_SCHEDULE) had before
+  omp_sched_t previous_kind;
+  int previous_chunk;
+  omp_get_schedule(&previous_kind, &previous_chunk);
+  switch (policy.schedule) {
+    case Schedule::STATIC:
+      omp_set_schedule(omp_sched_static, policy.chunk_size);
+      break;
+    case Schedule::DYNAMIC:
+      omp_set_schedule(omp_sched_dynamic, policy.chunk_size);
+      break;
+    case Schedule::GUIDED:
+      omp_set_schedule(omp_sched_guided, policy.chunk_size);
+      break;
+  }
+  double max_busy = 0.0;
+  double mean_busy = 0.0;
+#pragma omp parallel reduction(max : max_busy) reduction(+ : mean_busy)
+  {
+    auto const thread_start = Omega_h::now();
+#pragma omp for schedule(runtime) nowait
+    for (int i = 0; i < n; ++i) f(i);
+    double const busy = Omega_h::now() - thread_start;
+    max_busy = busy;
+    mean_busy = busy / omp_get_num_threads();
+  }
+  omp_set_schedule(previous_kind, previous_chunk);
+  max_thread_seconds = max_busy;
+  mean_thread_seconds = mean_busy;
+  return true;
+#else
+  // serial or CUDA: the schedule has no meaning, only timings are kept
+  (void)policy;
+  (void)max_thread_seconds;
+  (void)mean_thread_seconds;
+  Omega_h::parallel_for(n, f);
+  return false;
+#endif
+}
+
+template <class T>
+void parallel_for(char const* name, int n, T&& f) {
+  auto const& policy = get_kernel_policy(name);
+  if (policy.schedule == Schedule::STATIC && !policy.stats) {
+    Omega_h::parallel_for(name, n, std::forward<T>(f));
+    return;
+  }
+  if (n <= 0) return;
+  Omega_h::ScopedTimer timer(name);
+  auto const start = Omega_h::now();
+  double max_thread_seconds = 0.0;
+  double mean_thread_seconds = 0.0;
+  bool const thread_timed =
+      scheduled_for(policy, n, f, max_thread_seconds, mean_thread_seconds);
+  if (policy.stats) {
+    auto& stats = *policy.stats;
+    ++stats.calls;
+    stats.seconds += Omega_h::now() - start;
+    if (thread_timed) {
+      ++stats.thread_timed_calls;
+      stats.max_thread_seconds += max_thread_seconds;
+      stats.mean_thread_seconds += mean_thread_seconds;
+    }
+  }
+}
+
+// older Omega_h call form, kept for the call sites that still use it
+template <class T>
+void parallel_for(int n, T&& f, char const* name) {
+  parallel_for(name, n, std::forward<T>(f));
+}
+
+}  // namespace lgr
+
 #endif
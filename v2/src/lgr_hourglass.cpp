@@ -0,0 +1,64 @@
+#include <Omega_h_profile.hpp>
+#include <lgr_for.hpp>
+#include <lgr_hourglass.hpp>
+#include <lgr_simulation.hpp>
+
+namespace lgr {
+
+#ifdef LGR_QUAD4R
+static void apply_quad4r_hourglass_forces(Simulation& sim) {
+  using Elem = Quad4R;
+  auto const kappa = sim.hourglass_viscosity;
+  if (kappa == 0.0) return;
+  auto const nodes_to_x = sim.get(sim.position);
+  auto const nodes_to_v = sim.get(sim.velocity);
+  auto const points_to_grads = sim.get(sim.gradient);
+  auto const points_to_weights = sim.get(sim.weight);
+  auto const points_to_rho = sim.get(sim.density);
+  auto const points_to_c = sim.get(sim.wave_speed);
+  auto const elems_to_nodes = sim.elems_to_nodes();
+  auto const nodes_to_elems = sim.nodes_to_elems();
+  auto const nodes_to_f = sim.getset(sim.force);
+  // one point per element, so points and elements share an index.
+  // each element's forces are computed once and then gathered by node
+  auto const nelems = sim.elems();
+  Omega_h::Write<double> elems_to_f(
+      nelems * Elem::nodes * Elem::dim, "hourglass element forces");
+  auto elem_functor = OMEGA_H_LAMBDA(int const elem) {
+    auto const elem_nodes = getnodes<Elem>(elems_to_nodes, elem);
+    auto const x = getvecs<Elem>(nodes_to_x, elem_nodes);
+    auto const v = getvecs<Elem>(nodes_to_v, elem_nodes);
+    auto const grads = getgrads<Elem>(points_to_grads, elem);
+    auto const f = get_hourglass_forces(x, v, grads, points_to_weights[elem],
+        points_to_rho[elem], points_to_c[elem], kappa);
+    for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+      setvec<Elem>(elems_to_f, elem * Elem::nodes + elem_node, f[elem_node]);
+    }
+  };
+  parallel_for("hourglass element forces", nelems, std::move(elem_functor));
+  auto functor = OMEGA_H_LAMBDA(int const node) {
+    auto node_f = getvec<Elem>(nodes_to_f, node);
+    auto const begin = nodes_to_elems.a2ab[node];
+    auto const end = nodes_to_elems.a2ab[node + 1];
+    for (auto node_elem = begin; node_elem < end; ++node_elem) {
+      auto const elem = nodes_to_elems.ab2b[node_elem];
+      auto const code = nodes_to_elems.codes[node_elem];
+      auto const elem_node = Omega_h::code_which_down(code);
+      node_f += getvec<Elem>(elems_to_f, elem * Elem::nodes + elem_node);
+    }
+    setvec<Elem>(nodes_to_f, node, node_f);
+  };
+  parallel_for("hourglass forces", sim.nodes(), std::move(functor));
+}
+#endif
+
+void apply_hourglass_forces(Simulation& sim) {
+  OMEGA_H_TIME_FUNCTION;
+#ifdef LGR_QUAD4R
+  if (sim.elem_name == Quad4R::name()) apply_quad4r_hourglass_forces(sim);
+#else
+  (void)sim;
+#endif
+}
+
+}  // namespace lgr
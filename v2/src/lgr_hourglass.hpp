@@ -0,0 +1,54 @@
+#ifndef LGR_HOURGLASS_HPP
+#define LGR_HOURGLASS_HPP
+
+#include <lgr_element_functions.hpp>
+
+namespace lgr {
+
+struct Simulation;
+
+#ifdef LGR_QUAD4R
+/* Flanagan-Belytschko viscous hourglass forces for one element of a
+   one-point quadrilateral, given its nodal positions x, nodal velocities v,
+   centroid basis gradients, area and the density and wave speed at its
+   point. The hourglass shape vector
+     gamma = (1/4) (h - (h . x_i) dN/dx_i)
+   is orthogonal to all linear velocity fields, so the forces
+     f = -(kappa / 2) rho c A |dN/dx| (v . gamma) gamma
+   only resist the hourglass mode, sum to zero, and always dissipate. */
+OMEGA_H_INLINE Matrix<Quad4R::dim, Quad4R::nodes> get_hourglass_forces(
+    Matrix<Quad4R::dim, Quad4R::nodes> x, Matrix<Quad4R::dim, Quad4R::nodes> v,
+    Matrix<Quad4R::dim, Quad4R::nodes> grads, double area, double rho,
+    double c, double kappa) {
+  auto const h = Quad4R::hourglass_base();
+  Vector<Quad4R::nodes> gamma = h;
+  double grad_norm_squared = 0.0;
+  for (int i = 0; i < Quad4R::dim; ++i) {
+    double h_dot_x = 0.0;
+    for (int node = 0; node < Quad4R::nodes; ++node) {
+      h_dot_x += h[node] * x[node][i];
+    }
+    for (int node = 0; node < Quad4R::nodes; ++node) {
+      gamma[node] -= h_dot_x * grads[node][i];
+      grad_norm_squared += grads[node][i] * grads[node][i];
+    }
+  }
+  gamma = gamma / 4.0;
+  Vector<Quad4R::dim> q = v * gamma;
+  auto const coefficient =
+      0.5 * kappa * rho * c * area * std::sqrt(grad_norm_squared);
+  Matrix<Quad4R::dim, Quad4R::nodes> f;
+  for (int node = 0; node < Quad4R::nodes; ++node) {
+    f[node] = -(coefficient * gamma[node]) * q;
+  }
+  return f;
+}
+#endif
+
+// adds hourglass control forces to the nodal forces,
+// for element types that need it
+void apply_hourglass_forces(Simulation& sim);
+
+}  // namespace lgr
+
+#endif
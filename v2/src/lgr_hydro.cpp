@@ -36,8 +36,25 @@ void lump_masses(Simulation& sim) {
   LGR_SCOPE(sim);
   auto const points_to_rho = sim.get(sim.density);
   auto const points_to_w = sim.get(sim.weight);
-  auto const nodes_to_elems = sim.nodes_to_elems();
   auto const nodes_to_mass = sim.set(sim.nodal_mass);
+  // mass that eroded elements left on their surviving nodes
+  auto const nodes_to_eroded_mass = sim.eroder.enabled
+                                        ? sim.get(sim.eroder.eroded_nodal_mass)
+                                        : Omega_h::Reals();
+  auto const has_eroded_mass = nodes_to_eroded_mass.exists();
+  auto elem_node_mass = OMEGA_H_LAMBDA(int elem, int elem_node)->double {
+    double elem_mass = 0.0;
+    for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+      auto const point = elem * Elem::points + elem_pt;
+      auto const rho = points_to_rho[point];
+      auto const w = points_to_w[point];
+      elem_mass += rho * w;
+    }
+    return elem_mass * Elem::lumping_factor(elem_node);
+  };
+  // the padded adjacency is not used here: the per-element work is too
+  // cheap to pay for the extra padding slots
+  auto const nodes_to_elems = sim.nodes_to_elems();
   auto functor = OMEGA_H_LAMBDA(int node) {
     double node_mass = 0.0;
     auto const begin = nodes_to_elems.a2ab[node];
@@ -46,18 +63,12 @@ void lump_masses(Simulation& sim) {
       auto const elem = nodes_to_elems.ab2b[node_elem];
       auto const code = nodes_to_elems.codes[node_elem];
       auto const elem_node = Omega_h::code_which_down(code);
-      double elem_mass = 0.0;
-      for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
-        auto const point = elem * Elem::points + elem_pt;
-        auto const rho = points_to_rho[point];
-        auto const w = points_to_w[point];
-        elem_mass += rho * w;
-      }
-      node_mass += elem_mass * Elem::lumping_factor(elem_node);
+      node_mass += elem_node_mass(elem, elem_node);
     }
+    if (has_eroded_mass) node_mass += nodes_to_eroded_mass[node];
     nodes_to_mass[node] = node_mass;
   };
-  parallel_for(sim.nodes(), std::move(functor));
+  parallel_for("lump masses", sim.nodes(), std::move(functor));
 }
 
 template <class Elem>
@@ -128,10 +139,47 @@ void correct_velocity(Simulation& sim) {
 template <class Elem>
 void compute_stress_divergence(Simulation& sim) {
   LGR_SCOPE(sim);
-  auto const points_to_sigma = sim.get(sim.stress);
+  compute_stress_divergence<Elem>(
+      sim, sim.get(sim.stress), sim.set(sim.force));
+}
+
+template <class Elem>
+void compute_stress_divergence(Simulation& sim,
+    Omega_h::Read<double> points_to_sigma, Omega_h::Write<double> nodes_to_f) {
   auto const points_to_grads = sim.get(sim.gradient);
   auto const points_to_weights = sim.get(sim.weight);
-  auto const nodes_to_f = sim.set(sim.force);
+  auto add_elem_node_force =
+      OMEGA_H_LAMBDA(int elem, int elem_node, Vector<Elem::dim>& f) {
+    for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+      auto const point = elem * Elem::points + elem_pt;
+      auto const grad =
+          getvec<Elem>(points_to_grads, point * Elem::nodes + elem_node);
+      auto const sigma = getsymm<Elem>(points_to_sigma, point);
+      auto const weight = points_to_weights[point];
+      auto const cell_f = -(sigma * grad) * weight;
+      f += cell_f;
+    }
+  };
+  if (sim.disc.has_padded_nodes_to_ents()) {
+    auto const nodes_to_elems = sim.padded_nodes_to_elems();
+    auto const block_size = nodes_to_elems.block_size;
+    auto functor = OMEGA_H_LAMBDA(int const node) {
+      auto node_f = zero_vector<Elem::dim>();
+      auto const block = node / block_size;
+      auto const begin = nodes_to_elems.block_offsets[block] + node % block_size;
+      auto const end = nodes_to_elems.block_offsets[block + 1];
+      for (auto slot = begin; slot < end; slot += block_size) {
+        auto const elem_node = nodes_to_elems.ent_nodes[slot];
+        // padding slots are skipped, never read
+        if (elem_node < 0) continue;
+        add_elem_node_force(
+            elem_node / Elem::nodes, elem_node % Elem::nodes, node_f);
+      }
+      setvec<Elem>(nodes_to_f, node, node_f);
+    };
+    parallel_for("stress divergence", sim.nodes(), std::move(functor));
+    return;
+  }
   auto const nodes_to_elems = sim.nodes_to_elems();
   auto functor = OMEGA_H_LAMBDA(int const node) {
     auto node_f = zero_vector<Elem::dim>();
@@ -141,19 +189,11 @@ void compute_stress_divergence(Simulation& sim) {
       auto const elem = nodes_to_elems.ab2b[node_elem];
       auto const code = nodes_to_elems.codes[node_elem];
       auto const elem_node = Omega_h::code_which_down(code);
-      for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
-        auto const point = elem * Elem::points + elem_pt;
-        auto const grad =
-            getvec<Elem>(points_to_grads, point * Elem::nodes + elem_node);
-        auto const sigma = getsymm<Elem>(points_to_sigma, point);
-        auto const weight = points_to_weights[point];
-        auto const cell_f = -(sigma * grad) * weight;
-        node_f += cell_f;
-      }
+      add_elem_node_force(elem, elem_node, node_f);
     }
     setvec<Elem>(nodes_to_f, node, node_f);
   };
-  parallel_for(sim.nodes(), std::move(functor));
+  parallel_for("stress divergence", sim.nodes(), std::move(functor));
 }
 
 template <class Elem>
@@ -198,6 +238,8 @@ void compute_point_time_steps(Simulation& sim) {
   template void update_configuration<Elem>(Simulation & sim);                  \
   template void correct_velocity<Elem>(Simulation & sim);                      \
   template void compute_stress_divergence<Elem>(Simulation & sim);             \
+  template void compute_stress_divergence<Elem>(                               \
+      Simulation & sim, Omega_h::Read<double>, Omega_h::Write<double>);        \
   template void compute_nodal_acceleration<Elem>(Simulation & sim);            \
   template void compute_point_time_steps<Elem>(Simulation & sim);
 LGR_EXPL_INST_ELEMS
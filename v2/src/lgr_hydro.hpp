@@ -1,6 +1,7 @@
 #ifndef LGR_HYDRO_HPP
 #define LGR_HYDRO_HPP
 
+#include <Omega_h_array.hpp>
 #include <lgr_element_types.hpp>
 
 namespace lgr {
@@ -19,6 +20,10 @@ template <class Elem>
 void correct_velocity(Simulation& sim);
 template <class Elem>
 void compute_stress_divergence(Simulation& sim);
+// nodal forces from the given point stresses instead of the stress field
+template <class Elem>
+void compute_stress_divergence(Simulation& sim,
+    Omega_h::Read<double> points_to_sigma, Omega_h::Write<double> nodes_to_f);
 template <class Elem>
 void compute_nodal_acceleration(Simulation& sim);
 template <class Elem>
@@ -31,6 +36,8 @@ void compute_point_time_steps(Simulation& sim);
   extern template void update_configuration<Elem>(Simulation & sim);           \
   extern template void correct_velocity<Elem>(Simulation & sim);               \
   extern template void compute_stress_divergence<Elem>(Simulation & sim);      \
+  extern template void compute_stress_divergence<Elem>(                        \
+      Simulation & sim, Omega_h::Read<double>, Omega_h::Write<double>);        \
   extern template void compute_nodal_acceleration<Elem>(Simulation & sim);     \
   extern template void compute_point_time_steps<Elem>(Simulation & sim);
 LGR_EXPL_INST_ELEMS
@@ -1,5 +1,6 @@
 #include <lgr_for.hpp>
 #include <lgr_hyper_ep.hpp>
+#include <lgr_quiescence.hpp>
 #include <lgr_simulation.hpp>
 #include <sstream>
 
@@ -213,6 +214,9 @@ struct HyperEP : public Model<Elem> {
   // Kinematics
   FieldIndex defgrad;
 
+  // Skipping updates at quiescent points
+  Quiescence quiescence;
+
   HyperEP(Simulation& sim_in, Omega_h::InputMap& params) :
     Model<Elem>(sim_in, params)
   {
@@ -223,6 +227,8 @@ struct HyperEP : public Model<Elem> {
     hyper_ep::read_and_validate_plastic_params(params, this->properties);
     // Damage model
     hyper_ep::read_and_validate_damage_params(params, this->properties);
+    // Accuracy of the hardening and damage laws' transcendentals
+    this->properties.math_accuracy = read_math_accuracy(params);
     // Problem dimension
     constexpr auto dim = Elem::dim;
     // Define state dependent variables
@@ -238,6 +244,7 @@ struct HyperEP : public Model<Elem> {
     // Define kinematic quantities
     this->defgrad =
         this->point_define("F", "deformation gradient", square(dim), "I");
+    this->quiescence.define(*this, params);
   }
 
   std::uint64_t exec_stages() override final { return AT_MATERIAL_MODEL; }
@@ -265,16 +272,31 @@ struct HyperEP : public Model<Elem> {
     auto points_to_grad = this->points_get(this->sim.gradient);
     auto elems_to_nodes = this->get_elems_to_nodes();
     auto props = this->properties;
+    auto quiescent = this->quiescence.points(*this);
+    auto const bulk_modulus = props.E / (3.0 * (1.0 - 2.0 * props.Nu));
+    auto const shear_modulus = props.E / (2.0 * (1.0 + props.Nu));
     auto functor = OMEGA_H_LAMBDA(int const point) {
       auto const dxnp1_dX = getfull<Elem>(points_to_F, point);
-      auto const F = resize<3>(dxnp1_dX);
-      auto const rho = points_to_rho[point];
-      double const temp = 0.;  // FIXME
       // State dependent variables
       auto ep = points_to_ep[point];
       auto epdot = points_to_epdot[point];
       auto dp = points_to_dp[point];
       auto localized = points_to_localized[point];
+      // Only points that were elastic and undamaged at their last
+      // full update may skip it
+      if (epdot == 0.0 && dp == 0.0 && localized == 0.0) {
+        Matrix<Elem::dim, Elem::dim> T_small;
+        double c;
+        if (quiescent.skip(point, dxnp1_dX, bulk_modulus, shear_modulus,
+                T_small, c)) {
+          setsymm<Elem>(points_to_stress, point, T_small);
+          points_to_wave_speed[point] = c;
+          return;
+        }
+      }
+      auto const F = resize<3>(dxnp1_dX);
+      auto const rho = points_to_rho[point];
+      double const temp = 0.;  // FIXME
       auto Fp = resize<3>(getfull<Elem>(points_to_fp, point));
       // Update the material response
       tensor_type T;  // stress tensor
@@ -291,6 +313,7 @@ struct HyperEP : public Model<Elem> {
       points_to_localized[point] = localized;
       setfull<Elem>(points_to_F, point, resize<Elem::dim>(F));
       setfull<Elem>(points_to_fp, point, resize<Elem::dim>(Fp));
+      quiescent.record(point, dxnp1_dX, resize<Elem::dim>(T), c);
     };
     parallel_for("hyper ep kernel", this->points(), std::move(functor));
   }
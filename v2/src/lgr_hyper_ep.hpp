@@ -4,6 +4,7 @@
 #include <string>
 
 #include <lgr_element_types.hpp>
+#include <lgr_fast_math.hpp>
 #include <lgr_model.hpp>
 
 namespace lgr {
@@ -69,6 +70,9 @@ struct Properties {
   double DC;
   double eps_f_min;
 
+  // accuracy of exp, log and pow in the hardening and damage laws
+  MathAccuracy math_accuracy;
+
   Properties() :
     elastic(Elastic::LINEAR_ELASTIC),
     hardening(Hardening::NONE),
@@ -76,7 +80,8 @@ struct Properties {
     damage(Damage::NONE),
     allow_no_tension(true),
     allow_no_shear(false),
-    set_stress_to_zero(false)
+    set_stress_to_zero(false),
+    math_accuracy(MathAccuracy::FULL)
     {}
 };
 
@@ -159,6 +164,7 @@ tensor_type find_bbe(tensor_type const tau, double const mu) {
 OMEGA_H_INLINE
 double flow_stress(Properties props, double const temp, double const ep,
     double const epdot, double const dp) {
+  auto const acc = props.math_accuracy;
   auto Y = Omega_h::ArithTraits<double>::max();
   if (props.hardening == Hardening::NONE) {
     Y = props.A;
@@ -168,21 +174,21 @@ double flow_stress(Properties props, double const temp, double const ep,
     auto const a = props.A;
     auto const b = props.B;
     auto const n = props.n;
-    Y = (ep > 0.0) ? (a + b * std::pow(ep, n)) : a;
+    Y = (ep > 0.0) ? (a + b * fast_pow(ep, n, acc)) : a;
   } else if (props.hardening == Hardening::ZERILLI_ARMSTRONG) {
     auto const a = props.A;
     auto const b = props.B;
     auto const n = props.n;
-    Y = (ep > 0.0) ? (a + b * std::pow(ep, n)) : a;
+    Y = (ep > 0.0) ? (a + b * fast_pow(ep, n, acc)) : a;
     auto const C1 = props.C1;
     auto const C2 = props.C2;
     auto const C3 = props.C3;
     auto alpha = C3;
     if (props.rate_dep == RateDependence::ZERILLI_ARMSTRONG) {
       auto const C4 = props.C4;
-      alpha -= C4 * std::log(epdot);
+      alpha -= C4 * fast_log(epdot, acc);
     }
-    Y += (C1 + C2 * std::sqrt(ep)) * std::exp(-alpha * temp);
+    Y += (C1 + C2 * std::sqrt(ep)) * fast_exp(-alpha * temp, acc);
   } else if (props.hardening == Hardening::JOHNSON_COOK) {
     auto const ajo = props.A;
     auto const bjo = props.B;
@@ -194,7 +200,7 @@ double flow_stress(Properties props, double const temp, double const ep,
     Y = ajo;
     // Plastic strain contribution
     if (bjo > 0.0) {
-      Y += (std::abs(njo) > 0.0) ? bjo * std::pow(ep, njo) : bjo;
+      Y += (std::abs(njo) > 0.0) ? bjo * fast_pow(ep, njo, acc) : bjo;
     }
     // Temperature contribution
     if (std::abs(temp_melt - Omega_h::ArithTraits<double>::max()) + 1.0 !=
@@ -202,7 +208,7 @@ double flow_stress(Properties props, double const temp, double const ep,
       auto const tstar = (temp > temp_melt)
                              ? 1.0
                              : ((temp - temp_ref) / (temp_melt - temp_ref));
-      Y *= (tstar < 0.0) ? (1.0 - tstar) : (1.0 - std::pow(tstar, mjo));
+      Y *= (tstar < 0.0) ? (1.0 - tstar) : (1.0 - fast_pow(tstar, mjo, acc));
     }
   }
   if (props.rate_dep == RateDependence::JOHNSON_COOK) {
@@ -214,8 +220,8 @@ double flow_stress(Properties props, double const temp, double const ep,
     // use actual strain rate.
     // Rate of plastic strain contribution
     if (cjo > 0.0) {
-      Y *= (rfac < 1.0) ? std::pow((1.0 + rfac), cjo)
-                        : (1.0 + cjo * std::log(rfac));
+      Y *= (rfac < 1.0) ? fast_pow((1.0 + rfac), cjo, acc)
+                        : (1.0 + cjo * fast_log(rfac, acc));
     }
   }
   return (1 - dp) * Y;
@@ -225,6 +231,7 @@ OMEGA_H_INLINE
 double dflow_stress(Properties const props, double const temp, double const ep,
     double const epdot, double const dtime, double const dp)
 {
+  auto const acc = props.math_accuracy;
   double deriv = 0.;
   if (props.hardening == Hardening::LINEAR_ISOTROPIC) {
     auto const b = props.B;
@@ -232,25 +239,26 @@ double dflow_stress(Properties const props, double const temp, double const ep,
   } else if (props.hardening == Hardening::POWER_LAW) {
     auto const b = props.B;
     auto const n = props.n;
-    deriv = (ep > 0.0) ? b * n * std::pow(ep, n - 1) : 0.0;
+    deriv = (ep > 0.0) ? b * n * fast_pow(ep, n - 1, acc) : 0.0;
   } else if (props.hardening == Hardening::ZERILLI_ARMSTRONG) {
     auto const b = props.B;
     auto const n = props.n;
-    deriv = (ep > 0.0) ? b * n * std::pow(ep, n - 1) : 0.0;
+    deriv = (ep > 0.0) ? b * n * fast_pow(ep, n - 1, acc) : 0.0;
     auto const C1 = props.C1;
     auto const C2 = props.C2;
     auto const C3 = props.C3;
     auto alpha = C3;
     if (props.rate_dep == RateDependence::ZERILLI_ARMSTRONG) {
       auto const C4 = props.C4;
-      alpha -= C4 * std::log(epdot);
+      alpha -= C4 * fast_log(epdot, acc);
     }
-    deriv +=
-        .5 * C2 / std::sqrt(ep <= 0.0 ? 1.e-8 : ep) * std::exp(-alpha * temp);
+    deriv += .5 * C2 / std::sqrt(ep <= 0.0 ? 1.e-8 : ep) *
+             fast_exp(-alpha * temp, acc);
     if (props.rate_dep == RateDependence::ZERILLI_ARMSTRONG) {
       auto const C4 = props.C4;
-      auto const term1 = C1 * C4 * temp * std::exp(-alpha * temp);
-      auto const term2 = C2 * sqrt(ep) * C4 * temp * std::exp(-alpha * temp);
+      auto const term1 = C1 * C4 * temp * fast_exp(-alpha * temp, acc);
+      auto const term2 =
+          C2 * sqrt(ep) * C4 * temp * fast_exp(-alpha * temp, acc);
       deriv += (term1 + term2) / (epdot <= 0.0 ? 1.e-8 : epdot) / dtime;
     }
   } else if (props.hardening == Hardening::JOHNSON_COOK) {
@@ -266,21 +274,22 @@ double dflow_stress(Properties const props, double const temp, double const ep,
       auto const tstar =
           (temp > temp_melt) ? 1.0 : (temp - temp_ref) / (temp_melt - temp_ref);
       temp_contrib =
-          (tstar < 0.0) ? (1.0 - tstar) : (1.0 - std::pow(tstar, mjo));
+          (tstar < 0.0) ? (1.0 - tstar) : (1.0 - fast_pow(tstar, mjo, acc));
     }
     deriv =
-        (ep > 0.0) ? (bjo * njo * std::pow(ep, njo - 1) * temp_contrib) : 0.0;
+        (ep > 0.0) ? (bjo * njo * fast_pow(ep, njo - 1, acc) * temp_contrib)
+                   : 0.0;
     if (props.rate_dep == RateDependence::JOHNSON_COOK) {
       auto const ajo = props.A;
       auto const cjo = props.C4;
       auto const epdot0 = props.ep_dot_0;
       auto const rfac = epdot / epdot0;
       // Calculate strain rate contribution
-      auto const term1 = (rfac < 1.0) ? (std::pow((1.0 + rfac), cjo))
-                                      : (1.0 + cjo * std::log(rfac));
-      auto term2 = (ajo + bjo * std::pow(ep, njo)) * temp_contrib;
+      auto const term1 = (rfac < 1.0) ? (fast_pow((1.0 + rfac), cjo, acc))
+                                      : (1.0 + cjo * fast_log(rfac, acc));
+      auto term2 = (ajo + bjo * fast_pow(ep, njo, acc)) * temp_contrib;
       if (rfac < 1.0) {
-        term2 *= cjo * std::pow((1.0 + rfac), (cjo - 1.0));
+        term2 *= cjo * fast_pow((1.0 + rfac), (cjo - 1.0), acc);
       } else {
         term2 *= cjo / rfac;
       }
@@ -301,6 +310,7 @@ double scalar_damage(Properties const props, tensor_type& T, double const dp,
     return 0.0;
   }
   else if (props.damage == Damage::JOHNSON_COOK) {
+    auto const acc = props.math_accuracy;
     double tolerance = 1e-10;
     auto const I = identity_matrix<3, 3>();
     auto const T_mean = (trace(T) / 3.0);
@@ -317,14 +327,15 @@ double scalar_damage(Properties const props, tensor_type& T, double const dp,
       sig_star = std::max(std::min(sig_star, 1.5), -1.5);
 
       // Stress contribution to damage
-      double stress_contrib = props.D1 + props.D2 * exp(props.D3 * sig_star);
+      double stress_contrib =
+          props.D1 + props.D2 * fast_exp(props.D3 * sig_star, acc);
 
       // Strain rate contribution to damage
       double dep_contrib = 1.0;
       if (epdot < 1.0) {
-        dep_contrib = std::pow((1.0 + epdot), props.D4);
+        dep_contrib = fast_pow((1.0 + epdot), props.D4, acc);
       } else {
-        dep_contrib = 1.0 + props.D4 * std::log(epdot);
+        dep_contrib = 1.0 + props.D4 * fast_log(epdot, acc);
       }
 
       double temp_contrib = 1.0;
@@ -450,7 +461,7 @@ ErrorCode radial_return(Properties const props, tensor_type const Te,
     // determine elastic deformation
     auto const jac = determinant(F);
     auto const Bbe = find_bbe(T, mu);
-    auto const Be = Bbe * std::pow(jac, 2.0 / 3.0);
+    auto const Be = Bbe * fast_pow(jac, 2.0 / 3.0, props.math_accuracy);
     auto const Ve = sqrt_spd(Be);
     Fp = invert(Ve) * F;
     if (flag == StateFlag::REMAPPED) {
@@ -490,7 +501,7 @@ tensor_type hyper_elastic_stress(Properties const props, tensor_type const Fe,
   auto const E = props.E;
   auto const Nu = props.Nu;
   // Jacobian and distortion tensor
-  auto const scale = std::pow(jac, -1.0 / 3.0);
+  auto const scale = fast_pow(jac, -1.0 / 3.0, props.math_accuracy);
   auto const Fb = scale * Fe;
   // Elastic moduli
   auto const C10 = E / (4.0 * (1.0 + Nu));
@@ -14,13 +14,15 @@ struct IdealGas : public Model<Elem> {
         "e", "specific internal energy", 1, RemapType::PER_UNIT_MASS, pl, "");
     this->heat_capacity_ratio = this->point_define(
         "gamma", "heat capacity ratio", 1, RemapType::PER_UNIT_VOLUME, pl, "");
+    this->sim.fields[this->heat_capacity_ratio].uniform_allowed = true;
   }
   std::uint64_t exec_stages() override final { return AT_MATERIAL_MODEL; }
   char const* name() override final { return "ideal gas"; }
   void at_material_model() override final {
     auto const points_to_rho = this->points_get(this->sim.density);
     auto const points_to_e = this->points_get(this->specific_internal_energy);
-    auto const points_to_gamma = this->points_get(this->heat_capacity_ratio);
+    auto const points_to_gamma =
+        this->points_get_uniform(this->heat_capacity_ratio);
     auto const points_to_sigma = this->points_set(this->sim.stress);
     auto const points_to_c = this->points_set(this->sim.wave_speed);
     auto functor = OMEGA_H_LAMBDA(int point) {
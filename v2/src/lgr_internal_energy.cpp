@@ -18,66 +18,14 @@ struct InternalEnergy : public Model<Elem> {
             sim_in.fields.find("specific internal energy")) {
     specific_internal_energy_rate = this->point_define(
         "e_dot", "specific internal energy rate", 1, RemapType::NONE, "0.0");
+    sim.models.rates.add(
+        specific_internal_energy, specific_internal_energy_rate, true);
   }
-  std::uint64_t exec_stages() override final {
-    return BEFORE_MATERIAL_MODEL | BEFORE_SECONDARIES | AFTER_CORRECTION;
-  }
+  std::uint64_t exec_stages() override final { return AFTER_CORRECTION; }
   char const* name() override final { return "internal energy"; }
-  void before_material_model() override final {
-    if (sim.dt == 0.0 &&
-        (!sim.fields[specific_internal_energy_rate].storage.exists())) {
-      zero_internal_energy_rate();
-    }
-    compute_internal_energy_predictor();
-  }
-  void before_secondaries() override final {
-    backtrack_to_midpoint_internal_energy();
-    zero_internal_energy_rate();
-  }
-  void after_correction() override final {
-    contribute_stress_power();
-    correct_internal_energy();
-  }
-  // based on the previous energy and energy rate, compute a predicted
-  // energy using forward Euler. this predicted energy is what material models
-  // use
-  void compute_internal_energy_predictor() {
-    OMEGA_H_TIME_FUNCTION;
-    auto const points_to_e =
-        this->points_getset(this->specific_internal_energy);
-    auto const points_to_e_dot =
-        this->points_get(this->specific_internal_energy_rate);
-    auto const dt = this->sim.dt;
-    auto functor = OMEGA_H_LAMBDA(int const point) {
-      auto const e_dot_n = points_to_e_dot[point];
-      auto const e_n = points_to_e[point];
-      auto const e_np1_tilde = e_n + dt * e_dot_n;
-      points_to_e[point] = e_np1_tilde;
-    };
-    parallel_for(this->points(), std::move(functor));
-  }
-  void backtrack_to_midpoint_internal_energy() {
-    OMEGA_H_TIME_FUNCTION;
-    auto const points_to_e =
-        this->points_getset(this->specific_internal_energy);
-    auto const points_to_e_dot =
-        this->points_get(this->specific_internal_energy_rate);
-    auto const dt = this->sim.dt;
-    auto functor = OMEGA_H_LAMBDA(int const point) {
-      auto const e_dot_n = points_to_e_dot[point];
-      auto const e_np1_tilde = points_to_e[point];
-      auto const e_np12 = e_np1_tilde - (0.5 * dt) * e_dot_n;
-      points_to_e[point] = e_np12;
-    };
-    parallel_for(this->points(), std::move(functor));
-  }
-  // zero the rate before other models contribute to it
-  void zero_internal_energy_rate() {
-    OMEGA_H_TIME_FUNCTION;
-    auto const points_to_e_dot =
-        this->sim.set(this->specific_internal_energy_rate);
-    Omega_h::fill(points_to_e_dot, 0.0);
-  }
+  // the predictor, backtrack and corrector are done by sim.models.rates;
+  // the rate is zeroed there before other models contribute to it
+  void after_correction() override final { contribute_stress_power(); }
   void contribute_stress_power() {
     OMEGA_H_TIME_FUNCTION;
     auto const points_to_e_dot =
@@ -101,23 +49,6 @@ struct InternalEnergy : public Model<Elem> {
     };
     parallel_for(this->points(), std::move(functor));
   }
-  // using the previous midpoint energy and the current energy rate,
-  // compute the current energy
-  void correct_internal_energy() {
-    OMEGA_H_TIME_FUNCTION;
-    auto const points_to_e =
-        this->points_getset(this->specific_internal_energy);
-    auto const points_to_e_dot =
-        this->points_get(this->specific_internal_energy_rate);
-    auto const dt = this->sim.dt;
-    auto functor = OMEGA_H_LAMBDA(int const point) {
-      auto const e_dot_np1 = points_to_e_dot[point];
-      auto const e_np12 = points_to_e[point];
-      auto const e_np1 = e_np12 + (0.5 * dt) * e_dot_np1;
-      points_to_e[point] = e_np1;
-    };
-    parallel_for(this->points(), std::move(functor));
-  }
 };
 
 template <class Elem>
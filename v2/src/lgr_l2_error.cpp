@@ -32,8 +32,7 @@ struct L2Error : public Scalar {
   }
   double compute_value() override {
     auto& expected_field = sim.fields[expected_field_index];
-    auto node_coords = sim.get(sim.position);
-    expected_field.conditions[0].apply(sim.time, node_coords, sim.fields);
+    expected_field.conditions[0].apply(sim.time, sim.fields);
     auto support = expected_field.support;
     auto& field = sim.fields[field_index];
     auto computed_data = Omega_h::read(field.storage);
@@ -41,8 +40,8 @@ struct L2Error : public Scalar {
     if (field.entity_type == NODES) {
       support =
           sim.supports.get_support(ELEMS, true, support->subset->class_names);
-      computed_data = support->interpolate_nodal(field.ncomps, computed_data);
-      expected_data = support->interpolate_nodal(field.ncomps, expected_data);
+      computed_data = support->ask_interpolated(field);
+      expected_data = support->ask_interpolated(expected_field);
     }
 #define LGR_EXPL_INST(Elem)                                                    \
   if (sim.elem_name == Elem::name()) {                                         \
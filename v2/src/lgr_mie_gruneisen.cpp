@@ -21,6 +21,11 @@ struct MieGruneisen : public Model<Elem> {
     this->s1_ = this->point_define("S1", "Us/Up ratio", 1, "");
     this->specific_internal_energy = this->point_define(
         "e", "specific internal energy", 1, RemapType::PER_UNIT_MASS, "");
+    // material constants are usually the same across the whole model
+    this->sim.fields[this->rho0_].uniform_allowed = true;
+    this->sim.fields[this->gamma0_].uniform_allowed = true;
+    this->sim.fields[this->cs_].uniform_allowed = true;
+    this->sim.fields[this->s1_].uniform_allowed = true;
   }
 
   std::uint64_t exec_stages() override final { return AT_MATERIAL_MODEL; }
@@ -31,10 +36,10 @@ struct MieGruneisen : public Model<Elem> {
     auto points_to_rho = this->points_get(this->sim.density);
 
     auto points_to_e = this->points_get(this->specific_internal_energy);
-    auto points_to_rho0 = this->points_get(this->rho0_);
-    auto points_to_gamma0 = this->points_get(this->gamma0_);
-    auto points_to_cs = this->points_get(this->cs_);
-    auto points_to_s1 = this->points_get(this->s1_);
+    auto points_to_rho0 = this->points_get_uniform(this->rho0_);
+    auto points_to_gamma0 = this->points_get_uniform(this->gamma0_);
+    auto points_to_cs = this->points_get_uniform(this->cs_);
+    auto points_to_s1 = this->points_get_uniform(this->s1_);
 
     auto points_to_sigma = this->points_set(this->sim.stress);
     auto points_to_c = this->points_set(this->sim.wave_speed);
@@ -139,6 +139,11 @@ MappedPointRead<Elem> Model<Elem>::points_get(FieldIndex fi) {
   return sim.points_get<Elem>(fi, point_support->subset);
 }
 
+template <class Elem>
+UniformPointRead<Elem> Model<Elem>::points_get_uniform(FieldIndex fi) {
+  return sim.points_get_uniform<Elem>(fi, point_support->subset);
+}
+
 template <class Elem>
 MappedPointWrite<Elem> Model<Elem>::points_set(FieldIndex fi) {
   return sim.points_set<Elem>(fi, point_support->subset);
@@ -81,6 +81,7 @@ struct Model : public ModelBase {
   Model(Simulation&, Omega_h::InputMap&);
   Model(Simulation&, ClassNames const&);
   MappedPointRead<Elem> points_get(FieldIndex fi);
+  UniformPointRead<Elem> points_get_uniform(FieldIndex fi);
   MappedPointWrite<Elem> points_set(FieldIndex fi);
   MappedPointWrite<Elem> points_getset(FieldIndex fi);
   MappedPointRead<Elem> elems_get(FieldIndex fi);
@@ -17,7 +17,7 @@
 
 namespace lgr {
 
-Models::Models(Simulation& sim_in) : sim(sim_in) {}
+Models::Models(Simulation& sim_in) : sim(sim_in), rates(sim_in) {}
 
 void Models::setup_material_models_and_modifiers(Omega_h::InputMap& pl) {
   ::lgr::setup(sim.factories.material_model_factories, sim,
@@ -59,12 +59,14 @@ void Models::learn_disc() {
 #define LGR_STAGE_DEF(lowercase, uppercase)                                    \
   void Models::lowercase() {                                                   \
     OMEGA_H_TIME_FUNCTION;                                                     \
+    rates.begin_stage(uppercase);                                              \
     for (auto& model : models) {                                               \
       if ((model->exec_stages() & uppercase) != 0) {                           \
         Scope scope{sim, model->name()};                                       \
         model->lowercase();                                                    \
       }                                                                        \
     }                                                                          \
+    rates.end_stage(uppercase);                                                \
   }
 LGR_STAGE_DEF(after_configuration, AFTER_CONFIGURATION)
 LGR_STAGE_DEF(before_field_update, BEFORE_FIELD_UPDATE)
@@ -4,12 +4,14 @@
 #include <lgr_element_types.hpp>
 #include <lgr_factories.hpp>
 #include <lgr_model.hpp>
+#include <lgr_rate_integrator.hpp>
 
 namespace lgr {
 
 struct Models {
   Simulation& sim;
   std::vector<std::unique_ptr<ModelBase>> models;
+  RateIntegrator rates;
   Models(Simulation& sim_in);
   void setup_material_models_and_modifiers(Omega_h::InputMap& pl);
   void setup_field_updates();
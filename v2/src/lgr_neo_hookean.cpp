@@ -1,5 +1,6 @@
 #include <lgr_for.hpp>
 #include <lgr_neo_hookean.hpp>
+#include <lgr_quiescence.hpp>
 #include <lgr_simulation.hpp>
 
 namespace lgr {
@@ -35,6 +36,7 @@ struct NeoHookean : public Model<Elem> {
   FieldIndex bulk_modulus;
   FieldIndex shear_modulus;
   FieldIndex deformation_gradient;
+  Quiescence quiescence;
   NeoHookean(Simulation& sim_in, Omega_h::InputMap& pl)
       : Model<Elem>(sim_in, pl) {
     this->bulk_modulus = this->point_define(
@@ -44,6 +46,7 @@ struct NeoHookean : public Model<Elem> {
     constexpr auto dim = Elem::dim;
     this->deformation_gradient = this->point_define("F", "deformation gradient",
         square(dim), RemapType::POSITIVE_DETERMINANT, pl, "I");
+    this->quiescence.define(*this, pl);
   }
   std::uint64_t exec_stages() override final { return AT_MATERIAL_MODEL; }
   char const* name() override final { return "neo-Hookean"; }
@@ -54,19 +57,28 @@ struct NeoHookean : public Model<Elem> {
     auto points_to_F = this->points_get(this->deformation_gradient);
     auto points_to_stress = this->points_set(this->sim.stress);
     auto points_to_wave_speed = this->points_set(this->sim.wave_speed);
+    auto quiescent = this->quiescence.points(*this);
     auto functor = OMEGA_H_LAMBDA(int point) {
       auto F_small = getfull<Elem>(points_to_F, point);
       auto kappa = points_to_kappa[point];
       auto nu = points_to_nu[point];
       auto rho = points_to_rho[point];
+      Matrix<Elem::dim, Elem::dim> sigma_small;
+      double c;
+      if (quiescent.skip(point, F_small, kappa, nu, sigma_small, c)) {
+        setsymm<Elem>(points_to_stress, point, sigma_small);
+        points_to_wave_speed[point] = c;
+        return;
+      }
       auto F = identity_matrix<3, 3>();
       for (int i = 0; i < Elem::dim; ++i)
         for (int j = 0; j < Elem::dim; ++j) F(i, j) = F_small(i, j);
       Matrix<3, 3> sigma;
-      double c;
       neo_hookean_update(kappa, nu, rho, F, sigma, c);
-      setsymm<Elem>(points_to_stress, point, resize<Elem::dim>(sigma));
+      sigma_small = resize<Elem::dim>(sigma);
+      setsymm<Elem>(points_to_stress, point, sigma_small);
       points_to_wave_speed[point] = c;
+      quiescent.record(point, F_small, sigma_small, c);
     };
     parallel_for("neo-Hookean kernel", this->points(), std::move(functor));
   }
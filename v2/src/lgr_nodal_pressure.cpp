@@ -28,6 +28,7 @@ struct NodalPressure : public Model<Elem> {
         "kappa_tilde", "effective bulk modulus", 1, ELEMS, true, everywhere);
     velocity_constant = pl.get<double>("velocity constant", "1.0");
     pressure_constant = pl.get<double>("pressure constant", "1.0");
+    this->sim.models.rates.add(nodal_pressure, nodal_pressure_rate, false);
   }
 
   void compute_pressure_rate() {
@@ -94,16 +95,9 @@ struct NodalPressure : public Model<Elem> {
     parallel_for(this->sim.disc.count(NODES), std::move(functor));
   }
   std::uint64_t exec_stages() override final {
-    return BEFORE_MATERIAL_MODEL | BEFORE_SECONDARIES | AFTER_CORRECTION |
-           AFTER_MATERIAL_MODEL;
+    return AFTER_MATERIAL_MODEL | BEFORE_SECONDARIES;
   }
   char const* name() override final { return "nodal pressure"; }
-  void before_material_model() override final {
-    if (sim.dt == 0.0 && (!sim.fields[nodal_pressure_rate].storage.exists())) {
-      zero_nodal_pressure_rate();
-    }
-    compute_nodal_pressure_predictor();
-  }
   void after_material_model() override final {
     auto const points_to_sigma = this->points_getset(sim.stress);
     auto const nodes_to_p = sim.get(nodal_pressure);
@@ -139,62 +133,8 @@ struct NodalPressure : public Model<Elem> {
     };
     parallel_for(this->points(), std::move(functor));
   }
-  void before_secondaries() override final {
-    backtrack_to_midpoint_nodal_pressure();
-    compute_pressure_rate();
-  }
-  void after_correction() override final { correct_nodal_pressure(); }
-  // based on the previous pressure and pressure rate, compute a predicted
-  // energy using forward Euler. this predicted pressure is what material models
-  // use
-  void compute_nodal_pressure_predictor() {
-    OMEGA_H_TIME_FUNCTION;
-    auto const nodes_to_p = this->sim.getset(this->nodal_pressure);
-    auto const nodes_to_p_dot = this->sim.get(this->nodal_pressure_rate);
-    auto const dt = this->sim.dt;
-    auto functor = OMEGA_H_LAMBDA(int const node) {
-      auto const p_dot_n = nodes_to_p_dot[node];
-      auto const p_n = nodes_to_p[node];
-      auto const p_np1_tilde = p_n + dt * p_dot_n;
-      nodes_to_p[node] = p_np1_tilde;
-    };
-    parallel_for(this->sim.disc.count(NODES), std::move(functor));
-  }
-  void backtrack_to_midpoint_nodal_pressure() {
-    OMEGA_H_TIME_FUNCTION;
-    auto const nodes_to_p = this->sim.getset(this->nodal_pressure);
-    auto const nodes_to_p_dot = this->sim.get(this->nodal_pressure_rate);
-    auto const dt = this->sim.dt;
-    auto functor = OMEGA_H_LAMBDA(int const node) {
-      auto const p_dot_n = nodes_to_p_dot[node];
-      auto const p_np1_tilde = nodes_to_p[node];
-      auto const p_np12 = p_np1_tilde - (0.5 * dt) * p_dot_n;
-      nodes_to_p[node] = p_np12;
-    };
-    parallel_for(this->sim.disc.count(NODES), std::move(functor));
-  }
-  // zero the rate before other models contribute to it
-  void zero_nodal_pressure_rate() {
-    OMEGA_H_TIME_FUNCTION;
-    auto const nodes_to_p_dot = this->sim.set(this->nodal_pressure_rate);
-    Omega_h::fill(nodes_to_p_dot, 0.0);
-  }
-
-  // using the previous midpoint nodal pressure and the current pressure rate,
-  // compute the current pressure
-  void correct_nodal_pressure() {
-    OMEGA_H_TIME_FUNCTION;
-    auto const nodes_to_p = this->sim.getset(this->nodal_pressure);
-    auto const nodes_to_p_dot = this->sim.get(this->nodal_pressure_rate);
-    auto const dt = this->sim.dt;
-    auto functor = OMEGA_H_LAMBDA(int const node) {
-      auto const p_dot_np1 = nodes_to_p_dot[node];
-      auto const p_np12 = nodes_to_p[node];
-      auto const p_np1 = p_np12 + (0.5 * dt) * p_dot_np1;
-      nodes_to_p[node] = p_np1;
-    };
-    parallel_for(this->sim.disc.count(NODES), std::move(functor));
-  }
+  // sim.models.rates has already backtracked the pressure to the midpoint
+  void before_secondaries() override final { compute_pressure_rate(); }
 };
 
 template <class Elem>
@@ -0,0 +1,55 @@
+#include <Omega_h_reduce.hpp>
+#include <lgr_quiescence.hpp>
+#include <lgr_scalar.hpp>
+#include <lgr_simulation.hpp>
+
+namespace lgr {
+
+Quiescence::Quiescence() : tolerance(0.0) {}
+
+void Quiescence::define(ModelBase& model, Omega_h::InputMap& pl) {
+  tolerance = model.sim.get_double(pl, "quiescence tolerance", "0.0");
+  if (!(tolerance > 0.0)) return;
+  auto const dim = model.sim.dim();
+  reference_deformation_gradient = model.point_define("F_q",
+      "quiescent deformation gradient", square(dim), RemapType::NONE, "I");
+  reference_stress = model.point_define("sigma_q", "quiescent stress",
+      Omega_h::symm_ncomps(dim), RemapType::NONE, "0.0");
+  // a zero wave speed forces a full update, which is what
+  // the first step needs
+  reference_wave_speed = model.point_define(
+      "c_q", "quiescent wave speed", 1, RemapType::NONE, "0.0");
+  // a sum of stress errors, transferred like the stress it bounds
+  error = model.point_define("err_q", "accumulated quiescent stress error", 1,
+      RemapType::PER_UNIT_VOLUME, "0.0");
+}
+
+void Quiescence::reset_if_forgotten(ModelBase& model) {
+  auto& c_q = model.sim.fields[reference_wave_speed];
+  if (c_q.has()) return;
+  Omega_h::fill(c_q.set(), 0.0);
+  model.sim.fields[reference_deformation_gradient].set();
+  model.sim.fields[reference_stress].set();
+}
+
+struct QuiescentError : public Scalar {
+  QuiescentError(Simulation& sim_in, std::string const& name_in)
+      : Scalar(sim_in, name_in) {}
+  void out_of_line_virtual_method() override;
+  double compute_value() override {
+    auto const fi = sim.fields.find("accumulated quiescent stress error");
+    if (!fi.is_valid()) return 0.0;
+    auto& field = sim.fields[fi];
+    if (!field.has()) return 0.0;
+    return Omega_h::get_max(Omega_h::read(field.storage));
+  }
+};
+
+void QuiescentError::out_of_line_virtual_method() {}
+
+Scalar* quiescent_error_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap&) {
+  return new QuiescentError(sim, name);
+}
+
+}  // namespace lgr
@@ -0,0 +1,129 @@
+#ifndef LGR_QUIESCENCE_HPP
+#define LGR_QUIESCENCE_HPP
+
+#include <lgr_model.hpp>
+#include <string>
+
+namespace lgr {
+
+struct Scalar;
+
+/* Opt-in skipping of expensive material updates at points whose
+   deformation has barely changed since their last full update.
+   Each such point remembers the deformation gradient F_r, stress sigma_r
+   and wave speed of its last full update. With the relative increment
+     dF = F F_r^{-1} - I,  delta = |dF|
+   a point whose delta is below the "quiescence tolerance" gets the
+   linear rate-form update
+     sigma = sigma_r + W sigma_r - sigma_r W + lambda tr(e) I + 2 mu e
+   where e and W are the symmetric and skew parts of dF, instead of
+   the full constitutive update. This uses the small strain moduli, not
+   the model's tangent at F_r, and leaves out the stress dependent terms
+   of the exact linearization (e sigma_r + sigma_r e, the Cauchy factor
+   tr(e) sigma_r), so its error is first order in delta. The estimate
+     ((2 + sqrt(dim)) |sigma_r| + (lambda + 2 mu) |F_r - I|) delta
+       + (lambda + 2 mu + |sigma_r|) delta^2
+   covers the stress dependent terms, the difference between the tangent
+   at F_r and the small strain moduli (which grows with the reference
+   strain), and the second order remainder. It is an estimate, not a
+   bound. It is added to that point's "accumulated quiescent stress
+   error", which full updates leave alone, so it sums every skipped step
+   of the run.
+   The reference state is not remapped: after adaptation every point
+   starts over with a full update. */
+template <class Elem>
+struct QuiescentPoints {
+  double tolerance;
+  MappedPointWrite<Elem> reference_deformation_gradient;
+  MappedPointWrite<Elem> reference_stress;
+  MappedPointWrite<Elem> reference_wave_speed;
+  MappedPointWrite<Elem> error;
+  // returns true if the linear update was used and the full update
+  // can be skipped at this point
+  OMEGA_H_DEVICE bool skip(int const point, Matrix<Elem::dim, Elem::dim> F,
+      double const bulk_modulus, double const shear_modulus,
+      Matrix<Elem::dim, Elem::dim>& stress, double& wave_speed) const {
+    constexpr auto dim = Elem::dim;
+    if (!(tolerance > 0.0)) return false;
+    auto const c_r = reference_wave_speed[point];
+    // points that have never had a full update have no wave speed yet
+    if (!(c_r > 0.0)) return false;
+    auto const F_r = getfull<Elem>(reference_deformation_gradient, point);
+    auto const dF = F * Omega_h::invert(F_r) - identity_matrix<dim, dim>();
+    double delta_squared = 0.0;
+    for (int i = 0; i < dim; ++i) {
+      for (int j = 0; j < dim; ++j) delta_squared += square(dF(i, j));
+    }
+    if (delta_squared >= square(tolerance)) return false;
+    auto const sigma_r = getsymm<Elem>(reference_stress, point);
+    auto const e = 0.5 * (dF + transpose(dF));
+    auto const W = 0.5 * (dF - transpose(dF));
+    auto const lambda = bulk_modulus - (2.0 / 3.0) * shear_modulus;
+    stress = sigma_r + (W * sigma_r - sigma_r * W) +
+             (lambda * trace(e)) * identity_matrix<dim, dim>() +
+             (2.0 * shear_modulus) * e;
+    wave_speed = c_r;
+    double sigma_r_squared = 0.0;
+    double reference_strain_squared = 0.0;
+    for (int i = 0; i < dim; ++i) {
+      for (int j = 0; j < dim; ++j) {
+        sigma_r_squared += square(sigma_r(i, j));
+        reference_strain_squared += square(F_r(i, j) - (i == j ? 1.0 : 0.0));
+      }
+    }
+    auto const sigma_r_norm = std::sqrt(sigma_r_squared);
+    auto const plane_wave_modulus =
+        bulk_modulus + (4.0 / 3.0) * shear_modulus;
+    auto const first_order =
+        (2.0 + std::sqrt(double(dim))) * sigma_r_norm +
+        plane_wave_modulus * std::sqrt(reference_strain_squared);
+    error[point] += first_order * std::sqrt(delta_squared) +
+                    (plane_wave_modulus + sigma_r_norm) * delta_squared;
+    return true;
+  }
+  // makes the state of a full update the new reference state
+  OMEGA_H_DEVICE void record(int const point, Matrix<Elem::dim, Elem::dim> F,
+      Matrix<Elem::dim, Elem::dim> stress, double const wave_speed) const {
+    if (!(tolerance > 0.0)) return;
+    setfull<Elem>(reference_deformation_gradient, point, F);
+    setsymm<Elem>(reference_stress, point, stress);
+    reference_wave_speed[point] = wave_speed;
+  }
+};
+
+struct Quiescence {
+  double tolerance;
+  FieldIndex reference_deformation_gradient;
+  FieldIndex reference_stress;
+  FieldIndex reference_wave_speed;
+  FieldIndex error;
+  Quiescence();
+  // reads "quiescence tolerance" from a material model's parameters
+  // and defines the reference state fields when it is positive
+  void define(ModelBase& model, Omega_h::InputMap& pl);
+  // after adaptation the reference state is gone; a zero wave speed
+  // sends every point through a full update, which rebuilds it
+  void reset_if_forgotten(ModelBase& model);
+  template <class Elem>
+  QuiescentPoints<Elem> points(Model<Elem>& model) {
+    QuiescentPoints<Elem> out;
+    out.tolerance = tolerance;
+    if (tolerance > 0.0) {
+      reset_if_forgotten(model);
+      out.reference_deformation_gradient =
+          model.points_getset(reference_deformation_gradient);
+      out.reference_stress = model.points_getset(reference_stress);
+      out.reference_wave_speed = model.points_getset(reference_wave_speed);
+      out.error = model.points_getset(error);
+    }
+    return out;
+  }
+};
+
+// the largest "accumulated quiescent stress error" over all points
+Scalar* quiescent_error_factory(
+    Simulation& sim, std::string const& name, Omega_h::InputMap& pl);
+
+}  // namespace lgr
+
+#endif
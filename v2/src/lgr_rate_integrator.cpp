@@ -0,0 +1,90 @@
+#include <Omega_h_few.hpp>
+#include <Omega_h_profile.hpp>
+#include <lgr_for.hpp>
+#include <lgr_rate_integrator.hpp>
+#include <lgr_simulation.hpp>
+
+namespace lgr {
+
+// variables per fused kernel; more than this are done in several passes
+constexpr int max_fused_rates = 8;
+
+RateIntegrator::RateIntegrator(Simulation& sim_in) : sim(sim_in) {}
+
+void RateIntegrator::add(FieldIndex value, FieldIndex rate, bool zero_rate) {
+  OMEGA_H_CHECK(sim.fields[value].ncomps == sim.fields[rate].ncomps);
+  RateVariable variable;
+  variable.value = value;
+  variable.rate = rate;
+  variable.zero_rate = zero_rate;
+  variables.push_back(variable);
+}
+
+void RateIntegrator::begin_stage(std::uint64_t stage) {
+  if (stage == BEFORE_MATERIAL_MODEL) predict();
+  if (stage == BEFORE_SECONDARIES) backtrack();
+}
+
+void RateIntegrator::end_stage(std::uint64_t stage) {
+  if (stage == AFTER_CORRECTION) correct();
+}
+
+// based on the previous value and rate, compute a predicted value
+// using forward Euler. this predicted value is what material models use
+void RateIntegrator::predict() {
+  OMEGA_H_TIME_FUNCTION;
+  for (auto& variable : variables) {
+    if (sim.dt == 0.0 && (!sim.fields.has(variable.rate))) {
+      Omega_h::fill(sim.set(variable.rate), 0.0);
+    }
+  }
+  update("rate predictor", sim.dt, false);
+}
+
+// go back to the midpoint value and zero the rates that models accumulate
+void RateIntegrator::backtrack() {
+  OMEGA_H_TIME_FUNCTION;
+  update("rate backtrack", -(0.5 * sim.dt), true);
+}
+
+// using the midpoint value and the current rate, compute the current value
+void RateIntegrator::correct() {
+  OMEGA_H_TIME_FUNCTION;
+  update("rate corrector", 0.5 * sim.dt, false);
+}
+
+void RateIntegrator::update(
+    char const* kernel_name, double factor, bool zeroing) {
+  int const nvariables = int(variables.size());
+  for (int first = 0; first < nvariables; first += max_fused_rates) {
+    Omega_h::Few<Omega_h::Write<double>, max_fused_rates> values;
+    Omega_h::Few<Omega_h::Write<double>, max_fused_rates> rates;
+    Omega_h::Few<int, max_fused_rates> sizes;
+    Omega_h::Few<int, max_fused_rates> zero_rates;
+    int const nfused = Omega_h::min2(max_fused_rates, nvariables - first);
+    int max_size = 0;
+    for (int i = 0; i < nfused; ++i) {
+      auto& variable = variables[std::size_t(first + i)];
+      zero_rates[i] = zeroing && variable.zero_rate;
+      values[i] = sim.getset(variable.value);
+      // rates that are only read are not marked as modified
+      OMEGA_H_CHECK(sim.fields.has(variable.rate));
+      rates[i] = zero_rates[i] ? sim.getset(variable.rate)
+                               : sim.fields[variable.rate].storage;
+      OMEGA_H_CHECK(values[i].size() == rates[i].size());
+      sizes[i] = values[i].size();
+      max_size = Omega_h::max2(max_size, sizes[i]);
+    }
+    auto functor = OMEGA_H_LAMBDA(int const entry) {
+      for (int i = 0; i < nfused; ++i) {
+        if (entry >= sizes[i]) continue;
+        auto const x_dot = rates[i][entry];
+        values[i][entry] = values[i][entry] + factor * x_dot;
+        if (zero_rates[i]) rates[i][entry] = 0.0;
+      }
+    };
+    parallel_for(kernel_name, max_size, std::move(functor));
+  }
+}
+
+}  // namespace lgr
@@ -0,0 +1,45 @@
+#ifndef LGR_RATE_INTEGRATOR_HPP
+#define LGR_RATE_INTEGRATOR_HPP
+
+#include <cstdint>
+#include <lgr_field_index.hpp>
+#include <vector>
+
+namespace lgr {
+
+struct Simulation;
+
+/* A state variable evolved alongside velocity by the predictor-corrector
+   time integrator:
+     before material models:  x = x_n + dt * x_dot_n
+     before secondaries:      x = x - (dt / 2) * x_dot_n
+     after correction:        x = x + (dt / 2) * x_dot_np1
+   The value and rate fields must share a support. */
+struct RateVariable {
+  FieldIndex value;
+  FieldIndex rate;
+  // zero the rate after backtracking so models can accumulate into it
+  bool zero_rate;
+};
+
+/* Models register their evolving variables once and the integrator
+   updates all of them together in one kernel per stage, instead of
+   each model running its own predictor, backtrack and corrector passes */
+struct RateIntegrator {
+  Simulation& sim;
+  std::vector<RateVariable> variables;
+  RateIntegrator(Simulation& sim_in);
+  void add(FieldIndex value, FieldIndex rate, bool zero_rate);
+  void begin_stage(std::uint64_t stage);
+  void end_stage(std::uint64_t stage);
+  void predict();
+  void backtrack();
+  void correct();
+
+ private:
+  void update(char const* kernel_name, double factor, bool zeroing);
+};
+
+}  // namespace lgr
+
+#endif
@@ -345,6 +345,23 @@ struct Remap : public RemapBase {
             std::move(interp_functor));
         new_mesh.add_tag(0, name, ncomps, Omega_h::read(new_data));
       }
+      // lumped values stay on the old vertices, so midpoints start empty
+      for (auto& name : fields_to_remap[RemapType::LUMPED]) {
+        auto tag = old_mesh.get_tag<double>(0, name);
+        auto ncomps = tag->ncomps();
+        auto old_data = tag->array();
+        auto new_data = allocate_and_fill_with_same(new_mesh, 0, ncomps,
+            same_ents2old_ents, same_ents2new_ents, old_data);
+        auto zero_functor = OMEGA_H_LAMBDA(int key) {
+          auto new_vert = keys2midverts[key];
+          for (int comp = 0; comp < ncomps; ++comp) {
+            new_data[new_vert * ncomps + comp] = 0.0;
+          }
+        };
+        parallel_for("zero lumped midpoint data", keys2midverts.size(),
+            std::move(zero_functor));
+        new_mesh.add_tag(0, name, ncomps, Omega_h::read(new_data));
+      }
     }
     if (prod_dim == old_mesh.dim()) {
       remap_shape(old_mesh, new_mesh, keys2prods, prods2new_ents,
@@ -364,7 +381,7 @@ struct Remap : public RemapBase {
     }
   }
   void coarsen(Omega_h::Mesh& old_mesh, Omega_h::Mesh& new_mesh,
-      Omega_h::LOs /*keys2verts*/, Omega_h::Adj keys2doms, int prod_dim,
+      Omega_h::LOs keys2verts, Omega_h::Adj keys2doms, int prod_dim,
       Omega_h::LOs prods2new_ents, Omega_h::LOs same_ents2old_ents,
       Omega_h::LOs same_ents2new_ents) override final {
     if (prod_dim == 0) {
@@ -376,6 +393,10 @@ struct Remap : public RemapBase {
             same_ents2old_ents, same_ents2new_ents, old_data);
         new_mesh.add_tag(0, name, ncomps, Omega_h::read(new_data));
       }
+      if (!fields_to_remap[RemapType::LUMPED].empty()) {
+        coarsen_lumped(old_mesh, new_mesh, keys2verts, same_ents2old_ents,
+            same_ents2new_ents);
+      }
     }
     if (prod_dim == old_mesh.dim()) {
       remap_shape(old_mesh, new_mesh, keys2doms.a2ab, prods2new_ents,
@@ -394,6 +415,63 @@ struct Remap : public RemapBase {
           same_ents2new_ents);
     }
   }
+  /* a collapsed vertex hands its lumped values to its surviving
+     neighbors in equal shares, so their sum is kept. coarsening keys
+     are an independent set, so every neighbor of a key survives */
+  void coarsen_lumped(Omega_h::Mesh& old_mesh, Omega_h::Mesh& new_mesh,
+      Omega_h::LOs keys2verts, Omega_h::LOs same_ents2old_ents,
+      Omega_h::LOs same_ents2new_ents) {
+    auto const old_nverts = old_mesh.nverts();
+    auto const old_verts_stay = Omega_h::Write<Omega_h::I8>(
+        old_nverts, Omega_h::I8(0));
+    auto mark_functor = OMEGA_H_LAMBDA(int same_vert) {
+      old_verts_stay[same_ents2old_ents[same_vert]] = Omega_h::I8(1);
+    };
+    parallel_for("mark same verts", same_ents2old_ents.size(),
+        std::move(mark_functor));
+    auto const old_verts2verts = old_mesh.ask_star(0);
+    for (auto& name : fields_to_remap[RemapType::LUMPED]) {
+      auto tag = old_mesh.get_tag<double>(0, name);
+      auto ncomps = tag->ncomps();
+      auto old_data = tag->array();
+      auto new_data = allocate_and_fill_with_same(new_mesh, 0, ncomps,
+          same_ents2old_ents, same_ents2new_ents, old_data);
+      auto const old_verts_to_share =
+          Omega_h::Write<double>(old_nverts * ncomps, 0.0);
+      auto key_functor = OMEGA_H_LAMBDA(int key) {
+        auto const vert = keys2verts[key];
+        int nstaying = 0;
+        auto const begin = old_verts2verts.a2ab[vert];
+        auto const end = old_verts2verts.a2ab[vert + 1];
+        for (auto vert_vert = begin; vert_vert < end; ++vert_vert) {
+          if (old_verts_stay[old_verts2verts.ab2b[vert_vert]]) ++nstaying;
+        }
+        OMEGA_H_CHECK(nstaying > 0);
+        for (int comp = 0; comp < ncomps; ++comp) {
+          old_verts_to_share[vert * ncomps + comp] =
+              old_data[vert * ncomps + comp] / double(nstaying);
+        }
+      };
+      parallel_for("share lumped data", keys2verts.size(),
+          std::move(key_functor));
+      auto gather_functor = OMEGA_H_LAMBDA(int same_vert) {
+        auto const old_vert = same_ents2old_ents[same_vert];
+        auto const new_vert = same_ents2new_ents[same_vert];
+        auto const begin = old_verts2verts.a2ab[old_vert];
+        auto const end = old_verts2verts.a2ab[old_vert + 1];
+        for (auto vert_vert = begin; vert_vert < end; ++vert_vert) {
+          auto const other = old_verts2verts.ab2b[vert_vert];
+          for (int comp = 0; comp < ncomps; ++comp) {
+            new_data[new_vert * ncomps + comp] +=
+                old_verts_to_share[other * ncomps + comp];
+          }
+        }
+      };
+      parallel_for("gather lumped data", same_ents2old_ents.size(),
+          std::move(gather_functor));
+      new_mesh.add_tag(0, name, ncomps, Omega_h::read(new_data));
+    }
+  }
   void swap_copy_verts(
       Omega_h::Mesh& old_mesh, Omega_h::Mesh& new_mesh) override final {
     for (auto& name : fields_to_remap[RemapType::NODAL]) {
@@ -402,6 +480,12 @@ struct Remap : public RemapBase {
       auto old_data = tag->array();
       new_mesh.add_tag(0, name, ncomps, old_data);
     }
+    for (auto& name : fields_to_remap[RemapType::LUMPED]) {
+      auto tag = old_mesh.get_tag<double>(0, name);
+      auto ncomps = tag->ncomps();
+      auto old_data = tag->array();
+      new_mesh.add_tag(0, name, ncomps, old_data);
+    }
   }
   void swap(Omega_h::Mesh& old_mesh, Omega_h::Mesh& new_mesh, int prod_dim,
       Omega_h::LOs keys2edges, Omega_h::LOs keys2prods,
@@ -428,6 +512,7 @@ struct Remap : public RemapBase {
     Omega_h::ScopedTimer timer("Remap::after_adapt");
     sim.fields[sim.position].storage =
         Omega_h::deep_copy(sim.disc.mesh.coords());
+    sim.fields[sim.position].bump_version();
     sim.fields.copy_from_omega_h(sim.disc, field_indices_to_remap);
     sim.fields.remove_from_omega_h(sim.disc, field_indices_to_remap);
     for (auto& name : fields_to_remap[RemapType::POSITIVE_DETERMINANT]) {
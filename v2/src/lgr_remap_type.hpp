@@ -6,6 +6,7 @@ namespace lgr {
 enum class RemapType {
   NONE,
   NODAL,
+  LUMPED,
   SHAPE,
   PER_UNIT_VOLUME,
   PER_UNIT_MASS,
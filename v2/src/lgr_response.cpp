@@ -8,4 +8,10 @@ Response::Response(Simulation& sim_in, Omega_h::InputMap& pl) : sim(sim_in) {
 
 void Response::out_of_line_virtual_method() {}
 
+std::vector<long long> Response::save_events() {
+  return std::vector<long long>();
+}
+
+void Response::restore_events(std::vector<long long> const&) {}
+
 }  // namespace lgr
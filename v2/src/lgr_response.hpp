@@ -3,6 +3,7 @@
 
 #include <lgr_when.hpp>
 #include <memory>
+#include <vector>
 
 namespace lgr {
 
@@ -15,6 +16,10 @@ struct Response {
   virtual ~Response() = default;
   virtual void out_of_line_virtual_method();
   virtual void respond() = 0;
+  // what decides the output of later events besides the time,
+  // saved and put back by Stepper snapshots
+  virtual std::vector<long long> save_events();
+  virtual void restore_events(std::vector<long long> const& events);
 };
 
 }  // namespace lgr
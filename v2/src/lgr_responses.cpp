@@ -1,10 +1,12 @@
 #include <Omega_h_profile.hpp>
+#include <lgr_buddy_checkpoint.hpp>
 #include <lgr_cmdline_hist.hpp>
 #include <lgr_comparison.hpp>
 #include <lgr_csv_hist.hpp>
 #include <lgr_osh_output.hpp>
 #include <lgr_responses.hpp>
 #include <lgr_simulation.hpp>
+#include <lgr_telemetry.hpp>
 #include <lgr_vtk_output.hpp>
 
 namespace lgr {
@@ -39,6 +41,8 @@ ResponseFactories get_builtin_response_factories() {
   out["comparison"] = comparison_factory;
   out["osh output"] = osh_output_factory;
   out["checkpoint"] = osh_output_factory;
+  out["telemetry"] = telemetry_factory;
+  out["buddy checkpoint"] = buddy_checkpoint_factory;
   return out;
 }
 
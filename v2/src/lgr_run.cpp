@@ -1,5 +1,7 @@
 #include <Omega_h_profile.hpp>
 #include <lgr_flood.hpp>
+#include <lgr_for.hpp>
+#include <lgr_hourglass.hpp>
 #include <lgr_hydro.hpp>
 #include <lgr_run.hpp>
 #include <lgr_simulation.hpp>
@@ -19,7 +21,7 @@ static void apply_acceleration_conditions(Simulation& sim) {
 }
 
 template <class Elem>
-static void initialize_state(Simulation& sim) {
+void initialize_state(Simulation& sim) {
   OMEGA_H_TIME_FUNCTION;
   if (sim.time == 0.0) {
     apply_conditions(sim);
@@ -39,7 +41,7 @@ static void initialize_state(Simulation& sim) {
 }
 
 template <class Elem>
-static void close_state(Simulation& sim) {
+void close_state(Simulation& sim) {
   OMEGA_H_TIME_FUNCTION;
   sim.models.before_field_update();
   sim.models.at_field_update();
@@ -48,7 +50,9 @@ static void close_state(Simulation& sim) {
   sim.models.at_material_model();
   sim.models.after_material_model();
   compute_point_time_steps<Elem>(sim);
+  sim.stable_time_step.update<Elem>();
   compute_stress_divergence<Elem>(sim);
+  apply_hourglass_forces(sim);
   apply_force_conditions(sim);
   compute_nodal_acceleration<Elem>(sim);
   apply_acceleration_conditions(sim);
@@ -60,14 +64,21 @@ static void close_state(Simulation& sim) {
 }
 
 template <class Elem>
-static void run_simulation(Simulation& sim) {
+void advance(Simulation& sim, double end_time, int end_step) {
   OMEGA_H_TIME_FUNCTION;
-  initialize_state<Elem>(sim);
-  close_state<Elem>(sim);
-  while (sim.time < sim.end_time && sim.step < sim.end_step) {
-    if (sim.adapter.adapt()) {
-      sim.flooder.flood();
+  // update_time() lands on sim.end_time, so the target stands in for it
+  auto const final_time = sim.end_time;
+  sim.end_time = Omega_h::min2(end_time, final_time);
+  end_step = Omega_h::min2(end_step, sim.end_step);
+  while (sim.time < sim.end_time && sim.step < end_step) {
+    auto const eroded = sim.eroder.erode<Elem>();
+    // smoothing first, so that adaptation only follows when it fails
+    auto const smoothed = sim.smoother.smooth<Elem>();
+    auto const adapted = sim.adapter.adapt();
+    if (adapted) sim.flooder.flood();
+    if (eroded || smoothed || adapted) {
       lump_masses<Elem>(sim);
+      sim.stable_time_step.forget();
       sim.prev_time = sim.time;
       sim.prev_dt = sim.dt;
       sim.dt = 0.0;
@@ -83,6 +94,16 @@ static void run_simulation(Simulation& sim) {
     correct_velocity<Elem>(sim);
     sim.models.after_correction();
   }
+  sim.end_time = final_time;
+}
+
+template <class Elem>
+static void run_simulation(Simulation& sim) {
+  OMEGA_H_TIME_FUNCTION;
+  initialize_state<Elem>(sim);
+  close_state<Elem>(sim);
+  advance<Elem>(sim, sim.end_time, sim.end_step);
+  if (sim.comm->rank() == 0) print_kernel_stats();
 }
 
 void run(
@@ -104,4 +125,11 @@ void run(
   Omega_h_fail("Unknown element type \"%s\"\n", elem.c_str());
 }
 
+#define LGR_EXPL_INST(Elem)                                                    \
+  template void initialize_state<Elem>(Simulation&);                           \
+  template void close_state<Elem>(Simulation&);                                \
+  template void advance<Elem>(Simulation&, double, int);
+LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+
 }  // namespace lgr
@@ -2,13 +2,33 @@
 #define LGR_RUN_HPP
 
 #include <Omega_h_input.hpp>
+#include <lgr_element_types.hpp>
 #include <lgr_factories.hpp>
 
 namespace lgr {
 
+struct Simulation;
+
 void run(Omega_h::CommPtr comm, Omega_h::InputMap& pl,
     Factories&& model_factories = Factories());
 
-}
+// applies initial conditions, or restores remapped fields on a restart
+template <class Elem>
+void initialize_state(Simulation& sim);
+// computes everything that follows from the current position and velocity
+template <class Elem>
+void close_state(Simulation& sim);
+// steps a closed state until end_time or end_step, whichever comes first
+template <class Elem>
+void advance(Simulation& sim, double end_time, int end_step);
+
+#define LGR_EXPL_INST(Elem)                                                    \
+  extern template void initialize_state<Elem>(Simulation&);                    \
+  extern template void close_state<Elem>(Simulation&);                         \
+  extern template void advance<Elem>(Simulation&, double, int);
+LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+
+}  // namespace lgr
 
 #endif
@@ -14,8 +14,13 @@ void Scalar::out_of_line_virtual_method() {}
 double Scalar::ask_value() {
   if (sim.time != cached_time_) {
     value_ = this->compute_value();
+    cached_time_ = sim.time;
   }
   return value_;
 }
 
+void Scalar::forget_value() {
+  cached_time_ = std::numeric_limits<double>::quiet_NaN();
+}
+
 }  // namespace lgr
@@ -13,6 +13,8 @@ struct Scalar {
   virtual ~Scalar() = default;
   virtual void out_of_line_virtual_method();
   double ask_value();
+  // the next ask_value() recomputes, even at the same time
+  void forget_value();
 
  protected:
   Simulation& sim;
@@ -1,5 +1,8 @@
+#include <Omega_h_array_ops.hpp>
+#include <lgr_erosion.hpp>
 #include <lgr_l2_error.hpp>
 #include <lgr_node_scalar.hpp>
+#include <lgr_quiescence.hpp>
 #include <lgr_scalars.hpp>
 #include <lgr_simulation.hpp>
 
@@ -16,12 +19,21 @@ double Scalars::ask_value(std::string const& name) {
   if (name == "time") return sim.time;
   if (name == "dt") return sim.dt;
   if (name == "step") return double(sim.step);
+  // the dt the next step would take, before landing on an event
+  if (name == "stable dt") {
+    return sim.stable_time_step.get_dt(
+        Omega_h::get_min(sim.comm, sim.get(sim.point_time_step)));
+  }
   auto it = by_name.find(name);
   if (it == by_name.end())
     Omega_h_fail("Request for undefined scalar \"%s\"\n", name.c_str());
   return (*it)->ask_value();
 }
 
+void Scalars::forget_values() {
+  for (auto& ptr : storage) ptr->forget_value();
+}
+
 void Scalars::setup(Omega_h::InputMap& pl) {
   ::lgr::setup(sim.factories.scalar_factories, sim, pl, storage, "scalar");
   for (auto& ptr : storage) {
@@ -33,6 +45,11 @@ ScalarFactories get_builtin_scalar_factories() {
   ScalarFactories out;
   out["node"] = node_scalar_factory;
   out["L2 error"] = l2_error_factory;
+  out["quiescent error"] = quiescent_error_factory;
+  out["eroded mass"] = eroded_mass_factory;
+  out["eroded energy"] = eroded_energy_factory;
+  out["eroded elements"] = eroded_elements_factory;
+  out["total mass"] = total_mass_factory;
   return out;
 }
 
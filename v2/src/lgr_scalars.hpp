@@ -20,6 +20,7 @@ struct Scalars {
   Scalars(Simulation& sim_in);
   void setup(Omega_h::InputMap& pl);
   double ask_value(std::string const& name);
+  void forget_values();
 };
 
 ScalarFactories get_builtin_scalar_factories();
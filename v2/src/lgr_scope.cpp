@@ -1,8 +1,31 @@
 #include <lgr_scope.hpp>
 #include <lgr_simulation.hpp>
 
+#include <cstring>
+
 namespace lgr {
 
-Scope::~Scope() { sim.fields.print_and_clear_set_fields(); }
+void ScopeTimes::add(char const* name, double seconds) {
+  totals[name] += seconds;
+}
+
+double ScopeTimes::total(char const* name) const {
+  // the same function name can reach us through different pointers
+  double out = 0.0;
+  for (auto& pair : totals) {
+    if (std::strcmp(pair.first, name) == 0) out += pair.second;
+  }
+  return out;
+}
+
+Scope::Scope(Simulation& sim_in, char const* name_in)
+    : sim(sim_in), name(name_in), timer(name) {
+  if (sim.scope_times.enabled) start = Omega_h::now();
+}
+
+Scope::~Scope() {
+  if (sim.scope_times.enabled) sim.scope_times.add(name, Omega_h::now() - start);
+  sim.fields.print_and_clear_set_fields();
+}
 
 }  // namespace lgr
@@ -2,17 +2,28 @@
 #define LGR_SCOPE_HPP
 
 #include <Omega_h_profile.hpp>
+#include <Omega_h_timer.hpp>
+#include <map>
 
 namespace lgr {
 
 struct Simulation;
 
+/* accumulated wall-clock time per LGR_SCOPE, only recorded when
+   something (e.g. the telemetry response) has asked for it */
+struct ScopeTimes {
+  bool enabled = false;
+  std::map<char const*, double> totals;
+  void add(char const* name, double seconds);
+  double total(char const* name) const;
+};
+
 struct Scope {
   Simulation& sim;
   char const* name;
   Omega_h::ScopedTimer timer;
-  Scope(Simulation& sim_in, char const* name_in)
-      : sim(sim_in), name(name_in), timer(name) {}
+  Omega_h::Now start;
+  Scope(Simulation& sim_in, char const* name_in);
   ~Scope();
 };
 
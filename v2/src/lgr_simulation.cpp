@@ -1,6 +1,8 @@
 #include <Omega_h_array_ops.hpp>
 #include <Omega_h_profile.hpp>
 #include <iostream>
+#include <lgr_buddy_checkpoint.hpp>
+#include <lgr_for.hpp>
 #include <lgr_simulation.hpp>
 
 namespace lgr {
@@ -19,6 +21,10 @@ Omega_h::LOs Simulation::elems_to_nodes() { return disc.ents_to_nodes(ELEMS); }
 
 Omega_h::Adj Simulation::nodes_to_elems() { return disc.nodes_to_ents(ELEMS); }
 
+PaddedAdj Simulation::padded_nodes_to_elems() {
+  return disc.padded_nodes_to_ents(ELEMS);
+}
+
 void Simulation::finalize_definitions() {
   fields.finalize_definitions(supports);
 }
@@ -66,6 +72,18 @@ MappedPointRead<Elem> Simulation::points_get(FieldIndex fi, Subset* subset) {
   return mr;
 }
 
+template <class Elem>
+UniformPointRead<Elem> Simulation::points_get_uniform(
+    FieldIndex fi, Subset* subset) {
+  UniformPointRead<Elem> ur;
+  auto& field = fields[fi];
+  ur.is_uniform = field.is_uniform;
+  ur.points.data = field.get_uniform_or_full();
+  auto bridge = subsets.get_bridge(subset, field.support->subset);
+  ur.points.mapping = bridge->mapping;
+  return ur;
+}
+
 template <class Elem>
 MappedPointWrite<Elem> Simulation::points_set(FieldIndex fi, Subset* subset) {
   MappedPointWrite<Elem> mw;
@@ -98,15 +116,20 @@ Simulation::Simulation(Omega_h::CommPtr comm_in, Factories&& factories_in)
       scalars(*this),
       responses(*this),
       adapter(*this),
-      flooder(*this) {}
+      smoother(*this),
+      flooder(*this),
+      eroder(*this),
+      stable_time_step(*this) {}
 
 void Simulation::setup(Omega_h::InputMap& pl) {
   OMEGA_H_CHECK(pl.used);
   OMEGA_H_TIME_FUNCTION;
   start_cpu_time_point = Omega_h::now();
   input_variables.setup(pl.get_map("input variables"));
+  if (pl.is_map("scheduling")) setup_scheduling(pl.get_map("scheduling"));
   // set up constants
-  cpu_time = get_double(pl, "start CPU time", "0.0");
+  start_cpu_time = get_double(pl, "start CPU time", "0.0");
+  cpu_time = start_cpu_time;
   time = get_double(pl, "start time", "0.0");
   prev_time = time;
   auto const dbl_max = std::to_string(std::numeric_limits<double>::max());
@@ -117,11 +140,16 @@ void Simulation::setup(Omega_h::InputMap& pl) {
   max_dt = get_double(pl, "max dt", dbl_max.c_str());
   min_dt = get_double(pl, "min dt", "0.0");
   cfl = get_double(pl, "CFL", "0.9");
+  hourglass_viscosity = get_double(pl, "hourglass viscosity", "0.1");
   step = pl.get<int>("start step", "0");
   end_step = pl.get<int>("end step", int_max.c_str());
   // done setting up constants
   // set up mesh
-  disc.setup(comm, pl.get_map("mesh"));
+  auto& mesh_pl = pl.get_map("mesh");
+  if (mesh_pl.is_map("buddy checkpoint")) {
+    read_buddy_checkpoint(*this, mesh_pl.get_map("buddy checkpoint"));
+  }
+  disc.setup(comm, mesh_pl);
   // done setting up mesh
   // start defining fields
   fields.setup(pl);
@@ -159,6 +187,7 @@ void Simulation::setup(Omega_h::InputMap& pl) {
   // done defining fields
   models.setup_material_models_and_modifiers(pl);
   flooder.setup(pl);
+  eroder.setup(pl);
   models.setup_field_updates();
   finalize_definitions();
   // setup conditions
@@ -178,6 +207,8 @@ void Simulation::setup(Omega_h::InputMap& pl) {
   responses.setup(pl.get_list("responses"));
   // done setting up responses
   adapter.setup(pl);
+  smoother.setup(pl);
+  stable_time_step.setup(pl);
   // echo parameters
   if (pl.get<bool>("echo parameters", "false")) {
     Omega_h::echo_input(std::cout, pl);
@@ -188,14 +219,12 @@ void Simulation::setup(Omega_h::InputMap& pl) {
 
 void apply_conditions(Simulation& sim, FieldIndex fi) {
   auto& f = sim.fields[fi];
-  f.apply_conditions(
-      sim.prev_time, sim.time, sim.get(sim.position), sim.fields);
+  f.apply_conditions(sim.prev_time, sim.time, sim.fields);
 }
 
 void apply_conditions(Simulation& sim) {
   for (auto& f : sim.fields.storage) {
-    f->apply_conditions(
-        sim.prev_time, sim.time, sim.get(sim.position), sim.fields);
+    f->apply_conditions(sim.prev_time, sim.time, sim.fields);
   }
 }
 
@@ -204,7 +233,7 @@ void update_time(Simulation& sim) {
   sim.prev_dt = sim.dt;
   auto points_to_dt = sim.get(sim.point_time_step);
   auto min_point_dt = Omega_h::get_min(sim.comm, points_to_dt);
-  sim.dt = min_point_dt * sim.cfl;
+  sim.dt = sim.stable_time_step.get_dt(min_point_dt);
   sim.dt = Omega_h::min2(sim.dt, sim.max_dt);
   sim.time = sim.prev_time + sim.dt;
   auto next_event = sim.fields.next_event(sim.prev_time);
@@ -224,7 +253,7 @@ void update_time(Simulation& sim) {
 void update_cpu_time(Simulation& sim) {
   sim.prev_cpu_time = sim.cpu_time;
   auto now = Omega_h::now();
-  sim.cpu_time = now - sim.start_cpu_time_point;
+  sim.cpu_time = sim.start_cpu_time + (now - sim.start_cpu_time_point);
 }
 
 double Simulation::get_double(
@@ -251,6 +280,8 @@ LGR_EXPL_INST_ELEMS
 #define LGR_EXPL_INST(Elem)                                                    \
   template MappedPointRead<Elem> Simulation::points_get<Elem>(                 \
       FieldIndex, Subset*);                                                    \
+  template UniformPointRead<Elem> Simulation::points_get_uniform<Elem>(        \
+      FieldIndex, Subset*);                                                    \
   template MappedPointWrite<Elem> Simulation::points_set<Elem>(                \
       FieldIndex, Subset*);                                                    \
   template MappedPointWrite<Elem> Simulation::points_getset<Elem>(             \
@@ -5,6 +5,7 @@
 #include <lgr_adapt.hpp>
 #include <lgr_disc.hpp>
 #include <lgr_element_types.hpp>
+#include <lgr_erosion.hpp>
 #include <lgr_factories.hpp>
 #include <lgr_field_access.hpp>
 #include <lgr_fields.hpp>
@@ -13,6 +14,9 @@
 #include <lgr_models.hpp>
 #include <lgr_responses.hpp>
 #include <lgr_scalars.hpp>
+#include <lgr_scope.hpp>
+#include <lgr_smooth.hpp>
+#include <lgr_stable_time_step.hpp>
 #include <lgr_subsets.hpp>
 #include <lgr_supports.hpp>
 
@@ -31,7 +35,10 @@ struct Simulation {
   Scalars scalars;
   Responses responses;
   Adapter adapter;
+  Smoother smoother;
   Flooder flooder;
+  Eroder eroder;
+  StableTimeStep stable_time_step;
   Simulation(Omega_h::CommPtr comm, Factories&& factories_in);
   double get_double(
       Omega_h::InputMap& pl, const char* name, const char* default_expr);
@@ -46,6 +53,7 @@ struct Simulation {
   int points();
   Omega_h::LOs elems_to_nodes();
   Omega_h::Adj nodes_to_elems();
+  PaddedAdj padded_nodes_to_elems();
   void finalize_definitions();
   bool has(FieldIndex fi);
   Omega_h::Read<double> get(FieldIndex fi);
@@ -57,6 +65,8 @@ struct Simulation {
   template <class Elem>
   MappedPointRead<Elem> points_get(FieldIndex fi, Subset* subset);
   template <class Elem>
+  UniformPointRead<Elem> points_get_uniform(FieldIndex fi, Subset* subset);
+  template <class Elem>
   MappedPointWrite<Elem> points_set(FieldIndex fi, Subset* subset);
   template <class Elem>
   MappedPointWrite<Elem> points_getset(FieldIndex fi, Subset* subset);
@@ -70,6 +80,7 @@ struct Simulation {
   int step;
   int end_step;
   double cfl;
+  double hourglass_viscosity;
   FieldIndex position;
   FieldIndex velocity;
   FieldIndex acceleration;
@@ -87,9 +98,12 @@ struct Simulation {
   FieldIndex traction;
   FieldIndex traction_weight;
   Omega_h::Now start_cpu_time_point;
+  // the CPU time at start_cpu_time_point
+  double start_cpu_time;
   double prev_cpu_time;
   double cpu_time;
   double min_dt;
+  ScopeTimes scope_times;
 };
 
 void apply_conditions(Simulation& sim, FieldIndex fi);
@@ -105,6 +119,8 @@ LGR_EXPL_INST_ELEMS
 #define LGR_EXPL_INST(Elem)                                                    \
   extern template MappedPointRead<Elem> Simulation::points_get<Elem>(          \
       FieldIndex, Subset*);                                                    \
+  extern template UniformPointRead<Elem>                                       \
+      Simulation::points_get_uniform<Elem>(FieldIndex, Subset*);               \
   extern template MappedPointWrite<Elem> Simulation::points_set<Elem>(         \
       FieldIndex, Subset*);                                                    \
   extern template MappedPointWrite<Elem> Simulation::points_getset<Elem>(      \
@@ -0,0 +1,572 @@
+#include <Omega_h_array_ops.hpp>
+#include <Omega_h_map.hpp>
+#include <Omega_h_profile.hpp>
+#include <iostream>
+#include <lgr_element_functions.hpp>
+#include <lgr_for.hpp>
+#include <lgr_hydro.hpp>
+#include <lgr_simulation.hpp>
+#include <lgr_smooth.hpp>
+
+namespace lgr {
+
+Smoother::Smoother(Simulation& sim_in) : sim(sim_in), enabled(false) {}
+
+void Smoother::setup(Omega_h::InputMap& pl) {
+  enabled = pl.is_map("smooth");
+  if (!enabled) return;
+  auto& smooth_pl = pl.get_map("smooth");
+  auto default_trigger_qual = sim.dim() == 3 ? "0.3" : "0.4";
+  trigger_quality =
+      sim.get_double(smooth_pl, "trigger quality", default_trigger_qual);
+  iterations = sim.get_int(smooth_pl, "iterations", "5");
+  relaxation = sim.get_double(smooth_pl, "relaxation", "0.5");
+  minimum_gain = sim.get_double(smooth_pl, "minimum gain", "0.02");
+  OMEGA_H_CHECK(iterations > 0);
+  OMEGA_H_CHECK(0.0 < relaxation && relaxation <= 1.0);
+  if (!(0.0 <= minimum_gain && minimum_gain < 1.0)) {
+    Omega_h_fail("smooth \"minimum gain\" must be in [0,1), not %g\n",
+        minimum_gain);
+  }
+  if (!sim.disc.is_simplex_) {
+    Omega_h_fail("smoothing is only supported on simplex meshes\n");
+  }
+  if (sim.comm->size() != 1) {
+    Omega_h_fail("smoothing is only supported in serial runs\n");
+  }
+  if (sim.disc.is_second_order_) {
+    Omega_h_fail("smoothing is not supported with mid edge nodes\n");
+  }
+}
+
+// Jacobi sweeps moving each interior node toward the mean of its neighbors
+Omega_h::Reals Smoother::relax(Omega_h::Reals old_coords) {
+  OMEGA_H_TIME_FUNCTION;
+  auto& mesh = sim.disc.mesh;
+  auto const dim = mesh.dim();
+  auto const nverts = mesh.nverts();
+  auto const verts_to_verts = mesh.ask_star(0);
+  auto const class_dims = mesh.get_array<Omega_h::I8>(0, "class_dim");
+  auto const omega = relaxation;
+  Omega_h::Reals coords = old_coords;
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    auto const new_coords = Omega_h::Write<double>(nverts * dim);
+    auto functor = OMEGA_H_LAMBDA(int vert) {
+      auto const begin = verts_to_verts.a2ab[vert];
+      auto const end = verts_to_verts.a2ab[vert + 1];
+      auto const is_interior = (class_dims[vert] == Omega_h::I8(dim));
+      for (int d = 0; d < dim; ++d) {
+        auto const x = coords[vert * dim + d];
+        if (!is_interior || begin == end) {
+          new_coords[vert * dim + d] = x;
+          continue;
+        }
+        double mean = 0.0;
+        for (auto vert_vert = begin; vert_vert < end; ++vert_vert) {
+          mean += coords[verts_to_verts.ab2b[vert_vert] * dim + d];
+        }
+        mean /= double(end - begin);
+        new_coords[vert * dim + d] = x + omega * (mean - x);
+      }
+    };
+    parallel_for("smooth relax", nverts, std::move(functor));
+    coords = new_coords;
+  }
+  return coords;
+}
+
+// volume-weighted average onto nodes of per-element values,
+// using only the elements where elems_are_used is nonzero
+static Omega_h::Reals average_to_nodes(Simulation& sim,
+    Omega_h::Reals elems_to_volume, Omega_h::Read<Omega_h::I8> elems_are_used,
+    Omega_h::Reals elem_data, int ncomps) {
+  auto const nodes_to_elems = sim.nodes_to_elems();
+  auto const nodes_to_data = Omega_h::Write<double>(sim.nodes() * ncomps);
+  auto functor = OMEGA_H_LAMBDA(int node) {
+    double volume = 0.0;
+    for (int comp = 0; comp < ncomps; ++comp) {
+      nodes_to_data[node * ncomps + comp] = 0.0;
+    }
+    auto const begin = nodes_to_elems.a2ab[node];
+    auto const end = nodes_to_elems.a2ab[node + 1];
+    for (auto node_elem = begin; node_elem < end; ++node_elem) {
+      auto const elem = nodes_to_elems.ab2b[node_elem];
+      if (!elems_are_used[elem]) continue;
+      auto const v = elems_to_volume[elem];
+      volume += v;
+      for (int comp = 0; comp < ncomps; ++comp) {
+        nodes_to_data[node * ncomps + comp] +=
+            v * elem_data[elem * ncomps + comp];
+      }
+    }
+    if (!(volume > 0.0)) return;
+    for (int comp = 0; comp < ncomps; ++comp) {
+      nodes_to_data[node * ncomps + comp] /= volume;
+    }
+  };
+  parallel_for("smooth average to nodes", sim.nodes(), std::move(functor));
+  return nodes_to_data;
+}
+
+/* volume-averaged gradient over each element of nodal values, stored as
+   (elem * ncomps + comp) * dim + d */
+template <class Elem>
+static Omega_h::Reals elem_gradients(Simulation& sim,
+    Omega_h::Reals elems_to_volume, Omega_h::Reals nodes_to_data,
+    int ncomps) {
+  auto const elems_to_nodes = sim.elems_to_nodes();
+  auto const points_to_grad = sim.get(sim.gradient);
+  auto const points_to_w = sim.get(sim.weight);
+  auto const out = Omega_h::Write<double>(sim.elems() * ncomps * Elem::dim);
+  auto functor = OMEGA_H_LAMBDA(int elem) {
+    auto const elem_nodes = getnodes<Elem>(elems_to_nodes, elem);
+    for (int i = 0; i < ncomps * Elem::dim; ++i) {
+      out[elem * ncomps * Elem::dim + i] = 0.0;
+    }
+    for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+      auto const point = elem * Elem::points + elem_pt;
+      auto const dN_dx = getgrads<Elem>(points_to_grad, point);
+      auto const w = points_to_w[point] / elems_to_volume[elem];
+      for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+        auto const node = elem_nodes[elem_node];
+        for (int comp = 0; comp < ncomps; ++comp) {
+          auto const value = nodes_to_data[node * ncomps + comp];
+          for (int d = 0; d < Elem::dim; ++d) {
+            out[(elem * ncomps + comp) * Elem::dim + d] +=
+                w * dN_dx[elem_node][d] * value;
+          }
+        }
+      }
+    }
+  };
+  parallel_for("smooth element gradients", sim.elems(), std::move(functor));
+  return out;
+}
+
+template <class Elem>
+static void log_or_exp(Omega_h::Write<double> points_to_F, bool is_log) {
+  auto functor = OMEGA_H_LAMBDA(int point) {
+    auto const F = getfull<Elem>(points_to_F, point);
+    if (is_log) {
+      OMEGA_H_CHECK(determinant(F) > 0.0);
+      setfull<Elem>(points_to_F, point, Omega_h::log_glp(F));
+    } else {
+      setfull<Elem>(points_to_F, point, Omega_h::exp_glp(F));
+    }
+  };
+  parallel_for("smooth log(F)",
+      divide_no_remainder(points_to_F.size(), Elem::dim * Elem::dim),
+      std::move(functor));
+}
+
+// the area-weighted normal of a side, oriented by its vertex ordering
+OMEGA_H_INLINE Vector<1> side_normal(Omega_h::Few<Vector<1>, 1>) {
+  Vector<1> normal;
+  normal[0] = 1.0;
+  return normal;
+}
+
+OMEGA_H_INLINE Vector<2> side_normal(Omega_h::Few<Vector<2>, 2> x) {
+  auto const t = x[1] - x[0];
+  return Omega_h::vector_2(t[1], -t[0]);
+}
+
+OMEGA_H_INLINE Vector<3> side_normal(Omega_h::Few<Vector<3>, 3> x) {
+  return Omega_h::cross(x[1] - x[0], x[2] - x[0]) / 2.0;
+}
+
+/* volume swept along side_normal by a side whose vertices move linearly
+   from x to x + dx. The normal is a polynomial of degree dim - 1 in the
+   motion, so Simpson's rule integrates it exactly, and the swept sides
+   of a simplex add up to its exact change in volume. */
+template <int dim>
+OMEGA_H_INLINE double swept_volume(
+    Omega_h::Few<Vector<dim>, dim> x, Omega_h::Few<Vector<dim>, dim> dx) {
+  Omega_h::Few<Vector<dim>, dim> middle;
+  Omega_h::Few<Vector<dim>, dim> end;
+  auto mean_dx = zero_vector<dim>();
+  for (int i = 0; i < dim; ++i) {
+    middle[i] = x[i] + dx[i] / 2.0;
+    end[i] = x[i] + dx[i];
+    mean_dx += dx[i];
+  }
+  mean_dx = mean_dx / double(dim);
+  auto const normal =
+      (side_normal(x) + 4.0 * side_normal(middle) + side_normal(end)) / 6.0;
+  return normal * mean_dx;
+}
+
+/* the volume each side sweeps, signed so that it is what the first
+   element around the side gains and the second one loses.
+   Boundary sides never move and sweep nothing. */
+template <class Elem>
+static Omega_h::Reals swept_volumes(
+    Simulation& sim, Omega_h::Reals old_coords, Omega_h::Reals new_coords) {
+  constexpr int dim = Elem::dim;
+  auto& mesh = sim.disc.mesh;
+  auto const nsides = mesh.nents(dim - 1);
+  auto const sides_to_verts =
+      dim == 1 ? Omega_h::LOs(nsides, 0, 1) : mesh.ask_verts_of(dim - 1);
+  auto const sides_to_elems = mesh.ask_up(dim - 1, dim);
+  auto const elems_to_nodes = sim.elems_to_nodes();
+  auto const sides_to_dv = Omega_h::Write<double>(nsides);
+  auto functor = OMEGA_H_LAMBDA(int side) {
+    auto const begin = sides_to_elems.a2ab[side];
+    if (sides_to_elems.a2ab[side + 1] - begin != 2) {
+      sides_to_dv[side] = 0.0;
+      return;
+    }
+    Omega_h::Few<Vector<dim>, dim> x;
+    Omega_h::Few<Vector<dim>, dim> dx;
+    auto side_centroid = zero_vector<dim>();
+    for (int i = 0; i < dim; ++i) {
+      auto const vert = sides_to_verts[side * dim + i];
+      x[i] = getvec<Elem>(old_coords, vert);
+      dx[i] = getvec<Elem>(new_coords, vert) - x[i];
+      side_centroid += x[i] / double(dim);
+    }
+    auto const elem = sides_to_elems.ab2b[begin];
+    auto const elem_nodes = getnodes<Elem>(elems_to_nodes, elem);
+    auto const elem_x = getvecs<Elem>(old_coords, elem_nodes);
+    auto elem_centroid = zero_vector<dim>();
+    for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+      elem_centroid += elem_x[elem_node] / double(Elem::nodes);
+    }
+    // a simplex's side centroid is always outward of its centroid
+    auto const is_outward =
+        side_normal(x) * (side_centroid - elem_centroid) > 0.0;
+    auto const dv = swept_volume(x, dx);
+    sides_to_dv[side] = is_outward ? dv : -dv;
+  };
+  parallel_for("smooth swept volumes", nsides, std::move(functor));
+  return sides_to_dv;
+}
+
+/* the amount in each element after the move, given an amount per unit
+   volume before it: each element gains what its sides sweep out of the
+   neighbor they move into and loses what they sweep out of itself.
+   This upwind (donor cell) flux is first order, but whatever one element
+   gains its neighbor loses, so totals are kept to roundoff, and positive
+   amounts stay positive as long as no element sweeps out more volume
+   than it has. Only elements where elems_are_used is nonzero trade. */
+template <class Elem>
+static Omega_h::Reals donor_cell(Simulation& sim, Omega_h::Reals sides_to_dv,
+    Omega_h::Read<Omega_h::I8> elems_are_used, Omega_h::Reals elems_to_volume,
+    Omega_h::Reals elems_to_density, int ncomps) {
+  constexpr int dim = Elem::dim;
+  constexpr int sides_per_elem = dim + 1;
+  auto& mesh = sim.disc.mesh;
+  auto const elems_to_sides = mesh.ask_down(dim, dim - 1).ab2b;
+  auto const sides_to_elems = mesh.ask_up(dim - 1, dim);
+  auto const elems_to_amount = Omega_h::Write<double>(sim.elems() * ncomps);
+  auto functor = OMEGA_H_LAMBDA(int elem) {
+    for (int comp = 0; comp < ncomps; ++comp) {
+      elems_to_amount[elem * ncomps + comp] =
+          elems_to_volume[elem] * elems_to_density[elem * ncomps + comp];
+    }
+    if (!elems_are_used[elem]) return;
+    for (int elem_side = 0; elem_side < sides_per_elem; ++elem_side) {
+      auto const side = elems_to_sides[elem * sides_per_elem + elem_side];
+      auto const dv = sides_to_dv[side];
+      if (dv == 0.0) continue;
+      auto const begin = sides_to_elems.a2ab[side];
+      auto const first = sides_to_elems.ab2b[begin];
+      auto const second = sides_to_elems.ab2b[begin + 1];
+      if (!(elems_are_used[first] && elems_are_used[second])) continue;
+      auto const gain = (elem == first) ? dv : -dv;
+      auto const donor = (dv > 0.0) ? second : first;
+      for (int comp = 0; comp < ncomps; ++comp) {
+        elems_to_amount[elem * ncomps + comp] +=
+            gain * elems_to_density[donor * ncomps + comp];
+      }
+    }
+  };
+  parallel_for("smooth donor cell", sim.elems(), std::move(functor));
+  return elems_to_amount;
+}
+
+// the least volume any element keeps of itself through the move
+template <class Elem>
+static double min_kept_volume(Simulation& sim, Omega_h::Reals sides_to_dv) {
+  constexpr int dim = Elem::dim;
+  constexpr int sides_per_elem = dim + 1;
+  auto& mesh = sim.disc.mesh;
+  auto const elems_to_sides = mesh.ask_down(dim, dim - 1).ab2b;
+  auto const sides_to_elems = mesh.ask_up(dim - 1, dim);
+  auto const points_to_w = sim.get(sim.weight);
+  auto const elems_to_kept = Omega_h::Write<double>(sim.elems());
+  auto functor = OMEGA_H_LAMBDA(int elem) {
+    double kept = 0.0;
+    for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+      kept += points_to_w[elem * Elem::points + elem_pt];
+    }
+    for (int elem_side = 0; elem_side < sides_per_elem; ++elem_side) {
+      auto const side = elems_to_sides[elem * sides_per_elem + elem_side];
+      auto const dv = sides_to_dv[side];
+      if (dv == 0.0) continue;
+      auto const first = sides_to_elems.ab2b[sides_to_elems.a2ab[side]];
+      auto const gain = (elem == first) ? dv : -dv;
+      if (gain < 0.0) kept += gain;
+    }
+    elems_to_kept[elem] = kept;
+  };
+  parallel_for("smooth kept volumes", sim.elems(), std::move(functor));
+  return Omega_h::get_min(sim.comm, Omega_h::Reals(elems_to_kept));
+}
+
+template <class Elem>
+void Smoother::advect(Omega_h::Reals old_coords, Omega_h::Reals new_coords,
+    Omega_h::Reals sides_to_dv) {
+  OMEGA_H_TIME_FUNCTION;
+  constexpr int dim = Elem::dim;
+  auto const nnodes = sim.nodes();
+  auto const nelems = sim.elems();
+  auto const elems_to_nodes = sim.elems_to_nodes();
+  auto const points_to_w = sim.get(sim.weight);
+  auto const points_to_rho = sim.get(sim.density);
+  auto const nodes_to_dx = Omega_h::subtract_each(new_coords, old_coords);
+  auto const elems_to_volume = Omega_h::Write<double>(nelems);
+  auto const elems_to_rho = Omega_h::Write<double>(nelems);
+  auto const elems_are_moved = Omega_h::Write<Omega_h::I8>(nelems);
+  auto elem_functor = OMEGA_H_LAMBDA(int elem) {
+    double volume = 0.0;
+    double mass = 0.0;
+    for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+      auto const point = elem * Elem::points + elem_pt;
+      volume += points_to_w[point];
+      mass += points_to_rho[point] * points_to_w[point];
+    }
+    elems_to_volume[elem] = volume;
+    elems_to_rho[elem] = mass / volume;
+    auto const elem_nodes = getnodes<Elem>(elems_to_nodes, elem);
+    auto const dx = getvecs<Elem>(nodes_to_dx, elem_nodes);
+    bool is_moved = false;
+    for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+      is_moved = is_moved || !(Omega_h::norm(dx[elem_node]) == 0.0);
+    }
+    elems_are_moved[elem] = Omega_h::I8(is_moved);
+  };
+  parallel_for("smooth element volumes", nelems, std::move(elem_functor));
+  auto const all_elems = Omega_h::Read<Omega_h::I8>(nelems, Omega_h::I8(1));
+  auto const ones = Omega_h::Reals(nelems, 1.0);
+  auto const new_volumes = donor_cell<Elem>(
+      sim, sides_to_dv, all_elems, elems_to_volume, ones, 1);
+  auto const new_masses = donor_cell<Elem>(
+      sim, sides_to_dv, all_elems, elems_to_volume, elems_to_rho, 1);
+  auto& density_field = sim.fields[sim.density];
+  auto& velocity_field = sim.fields[sim.velocity];
+  for (auto& field_ptr : sim.fields.storage) {
+    auto& field = *field_ptr;
+    if (field.remap_type == RemapType::NONE) continue;
+    if (field.remap_type == RemapType::SHAPE) continue;
+    // lumped values belong to their node wherever it moves
+    if (field.remap_type == RemapType::LUMPED) continue;
+    // mass and momentum are moved together below
+    if (&field == &density_field || &field == &velocity_field) continue;
+    if (!field.has() || field.is_uniform) continue;
+    auto const ncomps = field.ncomps;
+    auto const& mapping = field.support->subset->mapping;
+    auto const data = field.getset();
+    if (field.entity_type == NODES) {
+      // nodal values are interpolants, not amounts: shift them
+      auto const nodes_to_data =
+          mapping.is_identity
+              ? Omega_h::Reals(data)
+              : Omega_h::map_onto(Omega_h::Reals(data), mapping.things,
+                    nnodes, 0.0, ncomps);
+      auto const grads =
+          elem_gradients<Elem>(sim, elems_to_volume, nodes_to_data, ncomps);
+      auto const nodes_to_grads = average_to_nodes(
+          sim, elems_to_volume, all_elems, grads, ncomps * dim);
+      auto const nsubset = divide_no_remainder(data.size(), ncomps);
+      auto functor = OMEGA_H_LAMBDA(int subset_node) {
+        auto const node = mapping[subset_node];
+        auto const dx = getvec<Elem>(nodes_to_dx, node);
+        for (int comp = 0; comp < ncomps; ++comp) {
+          double shift = 0.0;
+          for (int d = 0; d < dim; ++d) {
+            shift += nodes_to_grads[(node * ncomps + comp) * dim + d] * dx[d];
+          }
+          data[subset_node * ncomps + comp] += shift;
+        }
+      };
+      parallel_for("smooth advect nodes", nsubset, std::move(functor));
+    } else if (field.entity_type == ELEMS && field.on_points) {
+      auto const is_log = field.remap_type == RemapType::POSITIVE_DETERMINANT;
+      auto const is_per_mass = field.remap_type == RemapType::PER_UNIT_MASS;
+      if (is_log) log_or_exp<Elem>(data, true);
+      // per-element amounts per unit volume, on the field's elements
+      auto const nsubset_elems =
+          divide_no_remainder(data.size(), ncomps * Elem::points);
+      auto const elems_are_used = Omega_h::Write<Omega_h::I8>(
+          nelems, mapping.is_identity ? Omega_h::I8(1) : Omega_h::I8(0));
+      auto const elems_to_data = Omega_h::Write<double>(nelems * ncomps, 0.0);
+      auto average_functor = OMEGA_H_LAMBDA(int subset_elem) {
+        auto const elem = mapping[subset_elem];
+        elems_are_used[elem] = Omega_h::I8(1);
+        auto const factor = is_per_mass ? elems_to_rho[elem] : 1.0;
+        for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+          auto const w = points_to_w[elem * Elem::points + elem_pt] /
+                         elems_to_volume[elem];
+          auto const subset_point = subset_elem * Elem::points + elem_pt;
+          for (int comp = 0; comp < ncomps; ++comp) {
+            elems_to_data[elem * ncomps + comp] +=
+                factor * w * data[subset_point * ncomps + comp];
+          }
+        }
+      };
+      parallel_for(
+          "smooth average points", nsubset_elems, std::move(average_functor));
+      auto const elems_to_amount = donor_cell<Elem>(sim, sides_to_dv,
+          elems_are_used, elems_to_volume, elems_to_data, ncomps);
+      auto set_functor = OMEGA_H_LAMBDA(int subset_elem) {
+        auto const elem = mapping[subset_elem];
+        if (!elems_are_moved[elem]) return;
+        auto const measure =
+            is_per_mass ? new_masses[elem] : new_volumes[elem];
+        if (!(measure > 0.0)) return;
+        for (int comp = 0; comp < ncomps; ++comp) {
+          auto const value = elems_to_amount[elem * ncomps + comp] / measure;
+          for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+            auto const subset_point = subset_elem * Elem::points + elem_pt;
+            data[subset_point * ncomps + comp] = value;
+          }
+        }
+      };
+      parallel_for(
+          "smooth advect points", nsubset_elems, std::move(set_functor));
+      if (is_log) log_or_exp<Elem>(data, false);
+    }
+  }
+  // element velocities and the momentum each element trades
+  auto const nodes_to_v = sim.get(sim.velocity);
+  auto const elems_to_rho_v = Omega_h::Write<double>(nelems * dim);
+  auto rho_v_functor = OMEGA_H_LAMBDA(int elem) {
+    auto const elem_nodes = getnodes<Elem>(elems_to_nodes, elem);
+    auto const v = getvecs<Elem>(nodes_to_v, elem_nodes);
+    auto elem_v = zero_vector<dim>();
+    for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+      elem_v += Elem::lumping_factor(elem_node) * v[elem_node];
+    }
+    setvec<Elem>(elems_to_rho_v, elem, elems_to_rho[elem] * elem_v);
+  };
+  parallel_for("smooth element momenta", nelems, std::move(rho_v_functor));
+  auto const new_momenta = donor_cell<Elem>(
+      sim, sides_to_dv, all_elems, elems_to_volume, elems_to_rho_v, dim);
+  auto const old_nodal_mass = Omega_h::Reals(
+      Omega_h::deep_copy(sim.get(sim.nodal_mass), "old nodal mass"));
+  Omega_h::copy_into(new_coords, sim.set(sim.position));
+  initialize_configuration<Elem>(sim);
+  auto const new_points_to_w = sim.get(sim.weight);
+  auto const new_points_to_rho = sim.getset(sim.density);
+  auto rho_functor = OMEGA_H_LAMBDA(int elem) {
+    if (!elems_are_moved[elem]) return;
+    double volume = 0.0;
+    for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+      volume += new_points_to_w[elem * Elem::points + elem_pt];
+    }
+    for (int elem_pt = 0; elem_pt < Elem::points; ++elem_pt) {
+      new_points_to_rho[elem * Elem::points + elem_pt] =
+          new_masses[elem] / volume;
+    }
+  };
+  parallel_for("smooth density", nelems, std::move(rho_functor));
+  lump_masses<Elem>(sim);
+  /* Nodes off the interior of a region keep their velocity, since their
+     conditions constrain it. The momentum they would have gained,
+     relative to what their new mass carries at that velocity, goes to the
+     interior nodes of the same element, so the total is kept and a
+     uniform velocity stays uniform. */
+  auto const class_dims =
+      sim.disc.mesh.get_array<Omega_h::I8>(0, "class_dim");
+  auto const elems_to_dp = Omega_h::Write<double>(nelems * dim);
+  auto const elems_to_share = Omega_h::Write<double>(nelems * dim);
+  auto share_functor = OMEGA_H_LAMBDA(int elem) {
+    auto const elem_nodes = getnodes<Elem>(elems_to_nodes, elem);
+    auto const v = getvecs<Elem>(nodes_to_v, elem_nodes);
+    auto const dp = getvec<Elem>(new_momenta, elem) -
+                    elems_to_volume[elem] * getvec<Elem>(elems_to_rho_v, elem);
+    auto const dm =
+        new_masses[elem] - elems_to_volume[elem] * elems_to_rho[elem];
+    auto residual = zero_vector<dim>();
+    int ninterior = 0;
+    for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+      if (class_dims[elem_nodes[elem_node]] == Omega_h::I8(dim)) {
+        ++ninterior;
+      } else {
+        residual +=
+            Elem::lumping_factor(elem_node) * (dp - dm * v[elem_node]);
+      }
+    }
+    setvec<Elem>(elems_to_dp, elem, dp);
+    setvec<Elem>(elems_to_share, elem,
+        ninterior ? residual / double(ninterior) : zero_vector<dim>());
+  };
+  parallel_for("smooth momentum shares", nelems, std::move(share_functor));
+  auto const nodes_to_elems = sim.nodes_to_elems();
+  auto const nodes_to_mass = sim.get(sim.nodal_mass);
+  auto const nodes_to_new_v = sim.getset(sim.velocity);
+  auto node_functor = OMEGA_H_LAMBDA(int node) {
+    if (class_dims[node] != Omega_h::I8(dim)) return;
+    if (!(nodes_to_mass[node] > 0.0)) return;
+    auto p = old_nodal_mass[node] * getvec<Elem>(nodes_to_v, node);
+    auto const begin = nodes_to_elems.a2ab[node];
+    auto const end = nodes_to_elems.a2ab[node + 1];
+    for (auto node_elem = begin; node_elem < end; ++node_elem) {
+      auto const elem = nodes_to_elems.ab2b[node_elem];
+      auto const elem_nodes = getnodes<Elem>(elems_to_nodes, elem);
+      for (int elem_node = 0; elem_node < Elem::nodes; ++elem_node) {
+        if (elem_nodes[elem_node] != node) continue;
+        p += Elem::lumping_factor(elem_node) *
+                 getvec<Elem>(elems_to_dp, elem) +
+             getvec<Elem>(elems_to_share, elem);
+      }
+    }
+    setvec<Elem>(nodes_to_new_v, node, p / nodes_to_mass[node]);
+  };
+  parallel_for("smooth momentum", nnodes, std::move(node_functor));
+}
+
+template <class Elem>
+bool Smoother::smooth() {
+  if (!enabled) return false;
+  OMEGA_H_TIME_FUNCTION;
+  auto& mesh = sim.disc.mesh;
+  auto const old_coords = Omega_h::Reals(
+      Omega_h::deep_copy(sim.get(sim.position), "old position"));
+  mesh.set_coords(old_coords);  // linear specific!
+  auto const old_quality = mesh.min_quality();
+  if (old_quality >= trigger_quality) return false;
+  rebuild_times.clear();
+  auto t = Omega_h::now();
+  auto const new_coords = relax(old_coords);
+  t = rebuild_times.lap("relax", t);
+  mesh.set_coords(new_coords);
+  auto const new_quality = mesh.min_quality();
+  t = rebuild_times.lap("quality", t);
+  // too small a gain would just smooth again next step
+  if (!(new_quality >= old_quality + minimum_gain)) {
+    mesh.set_coords(old_coords);
+    return false;
+  }
+  auto const sides_to_dv = swept_volumes<Elem>(sim, old_coords, new_coords);
+  if (!(min_kept_volume<Elem>(sim, sides_to_dv) > 0.0)) {
+    mesh.set_coords(old_coords);
+    return false;
+  }
+  t = rebuild_times.lap("sweep", t);
+  advect<Elem>(old_coords, new_coords, sides_to_dv);
+  rebuild_times.lap("advect", t);
+  if (sim.comm->rank() == 0) {
+    std::cout << "smoothed mesh quality " << old_quality << " -> "
+              << new_quality << '\n';
+    rebuild_times.print("smoothing", std::cout);
+  }
+  return true;
+}
+
+#define LGR_EXPL_INST(Elem) template bool Smoother::smooth<Elem>();
+LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+
+}  // namespace lgr
@@ -0,0 +1,59 @@
+#ifndef LGR_SMOOTH_HPP
+#define LGR_SMOOTH_HPP
+
+#include <Omega_h_input.hpp>
+#include <lgr_adapt.hpp>
+#include <lgr_element_types.hpp>
+
+namespace lgr {
+
+struct Simulation;
+
+/* Opt-in ALE relaxation of node positions, a cheap first answer to
+   mesh distortion that keeps the topology and so rebuilds nothing.
+   smooth:
+     trigger quality: 0.3   # smooth when the minimum quality drops below
+     iterations: 5          # Laplacian sweeps per smoothing
+     relaxation: 0.5        # fraction of the move toward the neighbor mean
+     minimum gain: 0.02     # least rise in minimum quality to accept
+   Only nodes classified on the interior of a region move, so boundaries,
+   material interfaces and the sets built on them are kept.
+   The new positions are accepted only if they raise the minimum quality
+   by the minimum gain and no element sweeps out all of its volume;
+   otherwise the mesh is left alone and adaptation, when enabled, runs
+   as before. Smoothing runs just before adaptation each step, so
+   adaptation only triggers when smoothing could not restore quality.
+   Point fields are amounts per unit volume (or per unit mass, or the
+   logarithm of F for POSITIVE_DETERMINANT, as in Remap) and move by
+   donor cell fluxes through the volume each side sweeps, so mass, every
+   such amount, and momentum are kept to roundoff. The transfer is first
+   order: each smoothing diffuses a field by about its jump times the
+   fraction of an element swept. Other NODAL fields are interpolants and
+   are shifted by a first-order Taylor expansion. SHAPE fields are
+   recomputed. Simplex meshes only. */
+struct Smoother {
+  Simulation& sim;
+  bool enabled;
+  double trigger_quality;
+  int iterations;
+  double relaxation;
+  double minimum_gain;
+  RebuildTimes rebuild_times;
+  Smoother(Simulation& sim_in);
+  void setup(Omega_h::InputMap& pl);
+  // returns true if the nodes were moved
+  template <class Elem>
+  bool smooth();
+  Omega_h::Reals relax(Omega_h::Reals old_coords);
+  template <class Elem>
+  void advect(Omega_h::Reals old_coords, Omega_h::Reals new_coords,
+      Omega_h::Reals sides_to_dv);
+};
+
+#define LGR_EXPL_INST(Elem) extern template bool Smoother::smooth<Elem>();
+LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+
+}  // namespace lgr
+
+#endif
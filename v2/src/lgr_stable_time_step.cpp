@@ -0,0 +1,232 @@
+#include <Omega_h_array_ops.hpp>
+#include <Omega_h_profile.hpp>
+#include <cmath>
+#include <lgr_for.hpp>
+#include <lgr_hydro.hpp>
+#include <lgr_simulation.hpp>
+#include <lgr_stable_time_step.hpp>
+#include <limits>
+#include <vector>
+
+namespace lgr {
+
+StableTimeStep::StableTimeStep(Simulation& sim_in)
+    : sim(sim_in), enabled(false), ratio(0.0), last_step(-1) {}
+
+void StableTimeStep::setup(Omega_h::InputMap& pl) {
+  enabled = pl.is_map("stable time step");
+  if (!enabled) return;
+  auto& stable_pl = pl.get_map("stable time step");
+  iterations = sim.get_int(stable_pl, "iterations", "20");
+  period = sim.get_int(stable_pl, "period", "10");
+  safety_factor = sim.get_double(stable_pl, "safety factor", "0.9");
+  OMEGA_H_CHECK(iterations > 0);
+  OMEGA_H_CHECK(period > 0);
+  // the estimate is not a guaranteed bound, see the header
+  if (!(safety_factor > 0.0 && safety_factor <= 1.0)) {
+    Omega_h_fail("stable time step safety factor %g is not in (0, 1]\n",
+        safety_factor);
+  }
+}
+
+void StableTimeStep::forget() {
+  ratio = 0.0;
+  last_step = -1;
+}
+
+double StableTimeStep::get_dt(double min_point_dt) {
+  if (ratio > 0.0) return min_point_dt * ratio;
+  return min_point_dt * sim.cfl;
+}
+
+template <class Elem>
+void StableTimeStep::update() {
+  if (!enabled) return;
+  if (last_step >= 0 && sim.step - last_step < period) return;
+  OMEGA_H_TIME_FUNCTION;
+  last_step = sim.step;
+  ratio = 0.0;
+  auto const min_point_dt =
+      Omega_h::get_min(sim.comm, sim.get(sim.point_time_step));
+  auto const max_eigenvalue = estimate_max_eigenvalue<Elem>();
+  // a failed estimate leaves the element estimate in place
+  if (!(max_eigenvalue > 0.0) || !std::isfinite(max_eigenvalue)) return;
+  if (!(min_point_dt < std::numeric_limits<double>::max())) return;
+  auto const dt = safety_factor * 2.0 / std::sqrt(max_eigenvalue);
+  ratio = dt / min_point_dt;
+}
+
+// largest eigenvalue of the symmetric tridiagonal matrix with diagonal
+// alpha and off-diagonal beta by cyclic Jacobi rotations, and the last
+// component of its unit eigenvector
+static void largest_ritz_pair(std::vector<double> const& alpha,
+    std::vector<double> const& beta, double& theta, double& last) {
+  auto const n = int(alpha.size());
+  std::vector<double> a(std::size_t(n * n), 0.0);
+  std::vector<double> v(std::size_t(n * n), 0.0);
+  for (int i = 0; i < n; ++i) {
+    a[i * n + i] = alpha[i];
+    v[i * n + i] = 1.0;
+    if (i + 1 < n) a[i * n + i + 1] = a[(i + 1) * n + i] = beta[i];
+  }
+  for (int sweep = 0; sweep < 100; ++sweep) {
+    double off = 0.0;
+    double diag = 0.0;
+    for (int p = 0; p < n; ++p) {
+      diag += square(a[p * n + p]);
+      for (int q = p + 1; q < n; ++q) off += square(a[p * n + q]);
+    }
+    if (off <= 1.0e-30 * diag) break;
+    for (int p = 0; p < n; ++p) {
+      for (int q = p + 1; q < n; ++q) {
+        auto const apq = a[p * n + q];
+        if (apq == 0.0) continue;
+        auto const tau = (a[q * n + q] - a[p * n + p]) / (2.0 * apq);
+        auto const t = ((tau < 0.0) ? -1.0 : 1.0) /
+                       (std::abs(tau) + std::sqrt(1.0 + tau * tau));
+        auto const c = 1.0 / std::sqrt(1.0 + t * t);
+        auto const s = t * c;
+        for (int k = 0; k < n; ++k) {
+          auto const akp = a[k * n + p];
+          auto const akq = a[k * n + q];
+          a[k * n + p] = c * akp - s * akq;
+          a[k * n + q] = s * akp + c * akq;
+        }
+        for (int k = 0; k < n; ++k) {
+          auto const apk = a[p * n + k];
+          auto const aqk = a[q * n + k];
+          a[p * n + k] = c * apk - s * aqk;
+          a[q * n + k] = s * apk + c * aqk;
+        }
+        for (int k = 0; k < n; ++k) {
+          auto const vkp = v[k * n + p];
+          auto const vkq = v[k * n + q];
+          v[k * n + p] = c * vkp - s * vkq;
+          v[k * n + q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+  int largest = 0;
+  for (int i = 1; i < n; ++i) {
+    if (a[i * n + i] > a[largest * n + largest]) largest = i;
+  }
+  theta = a[largest * n + largest];
+  last = v[(n - 1) * n + largest];
+}
+
+// sum over nodal vector entries of a * b, weighted by the
+// nodal mass when one is given
+template <class Elem>
+static double nodal_dot(Simulation& sim, Omega_h::Reals nodes_to_m,
+    Omega_h::Reals a, Omega_h::Reals b) {
+  auto const products = Omega_h::Write<double>(a.size());
+  auto const is_weighted = nodes_to_m.exists();
+  auto functor = OMEGA_H_LAMBDA(int i) {
+    auto const m = is_weighted ? nodes_to_m[i / Elem::dim] : 1.0;
+    products[i] = m * a[i] * b[i];
+  };
+  parallel_for("stable dt dot", a.size(), std::move(functor));
+  return Omega_h::get_sum(sim.comm, Omega_h::Reals(products));
+}
+
+template <class Elem>
+double StableTimeStep::estimate_max_eigenvalue() {
+  auto const nnodes = sim.nodes();
+  auto const ndofs = nnodes * Elem::dim;
+  auto const nodes_to_m = sim.get(sim.nodal_mass);
+  auto const points_to_rho = sim.get(sim.density);
+  auto const points_to_c = sim.get(sim.wave_speed);
+  auto const points_to_grad = sim.get(sim.gradient);
+  auto const elems_to_nodes = sim.elems_to_nodes();
+  auto const points_to_sigma =
+      Omega_h::Write<double>(sim.points() * Omega_h::symm_ncomps(Elem::dim));
+  auto const nodes_to_f = Omega_h::Write<double>(ndofs);
+  // the shear modulus where a model defines one, zero elsewhere
+  auto const points_to_mu = Omega_h::Write<double>(sim.points(), 0.0);
+  auto const mu_fi = sim.fields.find("shear modulus");
+  if (mu_fi.is_valid() && sim.fields[mu_fi].has()) {
+    auto const subset_points_to_mu = sim.fields[mu_fi].broadcast();
+    auto const mapping = sim.fields[mu_fi].support->subset->mapping;
+    auto functor = OMEGA_H_LAMBDA(int subset_point) {
+      auto const elem = mapping[subset_point / Elem::points];
+      auto const point = elem * Elem::points + subset_point % Elem::points;
+      points_to_mu[point] = subset_points_to_mu[subset_point];
+    };
+    parallel_for("stable dt shear modulus", subset_points_to_mu.size(),
+        std::move(functor));
+  }
+  // w = M^{-1} K q, returning q^T K q
+  auto apply = [&](Omega_h::Reals q, Omega_h::Write<double> w) -> double {
+    auto stress_functor = OMEGA_H_LAMBDA(int point) {
+      auto const elem = point / Elem::points;
+      auto const elem_nodes = getnodes<Elem>(elems_to_nodes, elem);
+      auto const q_nodes = getvecs<Elem>(q, elem_nodes);
+      auto const dN_dx = getgrads<Elem>(points_to_grad, point);
+      auto const grad_q = grad<Elem>(dN_dx, q_nodes);
+      auto const e = 0.5 * (grad_q + transpose(grad_q));
+      // lambda + 2 mu is the plane wave modulus rho c^2
+      auto const mu = points_to_mu[point];
+      auto const lambda =
+          points_to_rho[point] * square(points_to_c[point]) - 2.0 * mu;
+      auto const sigma =
+          lambda * trace(e) * identity_matrix<Elem::dim, Elem::dim>() +
+          (2.0 * mu) * e;
+      setsymm<Elem>(points_to_sigma, point, sigma);
+    };
+    parallel_for("stable dt stress", sim.points(), std::move(stress_functor));
+    // the stress divergence is -K q
+    compute_stress_divergence<Elem>(sim, points_to_sigma, nodes_to_f);
+    auto mass_functor = OMEGA_H_LAMBDA(int i) {
+      auto const m = nodes_to_m[i / Elem::dim];
+      w[i] = (m > 0.0) ? (-nodes_to_f[i] / m) : 0.0;
+    };
+    parallel_for("stable dt mass", ndofs, std::move(mass_functor));
+    return -nodal_dot<Elem>(sim, Omega_h::Reals(), q, nodes_to_f);
+  };
+  // a fixed pseudo-random start vector, so that every mode is present
+  auto const start = Omega_h::Write<double>(ndofs);
+  auto start_functor = OMEGA_H_LAMBDA(int i) {
+    auto const u = std::sin(12.9898 * double(i + 1)) * 43758.5453;
+    start[i] = u - std::floor(u) - 0.5;
+  };
+  parallel_for("stable dt start", ndofs, std::move(start_functor));
+  auto const start_norm =
+      std::sqrt(nodal_dot<Elem>(sim, nodes_to_m, start, start));
+  if (!(start_norm > 0.0)) return 0.0;
+  // Lanczos in the M inner product, where M^{-1} K is self-adjoint
+  Omega_h::Reals q =
+      Omega_h::multiply_each_by(Omega_h::Reals(start), 1.0 / start_norm);
+  Omega_h::Reals q_prev(ndofs, 0.0);
+  auto const w = Omega_h::Write<double>(ndofs);
+  std::vector<double> alpha;
+  std::vector<double> beta;
+  double beta_prev = 0.0;
+  double beta_last = 0.0;
+  for (int j = 0; j < iterations; ++j) {
+    auto const alpha_j = apply(q, w);
+    alpha.push_back(alpha_j);
+    auto orthogonalize = OMEGA_H_LAMBDA(int i) {
+      w[i] -= alpha_j * q[i] + beta_prev * q_prev[i];
+    };
+    parallel_for("stable dt lanczos", ndofs, std::move(orthogonalize));
+    auto const beta_j = std::sqrt(nodal_dot<Elem>(sim, nodes_to_m, w, w));
+    beta_last = beta_j;
+    // the last step, or an invariant subspace in which theta is exact
+    if (j + 1 == iterations || !(beta_j > 1.0e-12 * std::abs(alpha_j))) break;
+    beta.push_back(beta_j);
+    q_prev = q;
+    q = Omega_h::multiply_each_by(Omega_h::Reals(w), 1.0 / beta_j);
+    beta_prev = beta_j;
+  }
+  // the largest Ritz value and its residual bound
+  double theta, last;
+  largest_ritz_pair(alpha, beta, theta, last);
+  return theta + beta_last * std::abs(last);
+}
+
+#define LGR_EXPL_INST(Elem) template void StableTimeStep::update<Elem>();
+LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+
+}  // namespace lgr
@@ -0,0 +1,67 @@
+#ifndef LGR_STABLE_TIME_STEP_HPP
+#define LGR_STABLE_TIME_STEP_HPP
+
+#include <Omega_h_input.hpp>
+#include <lgr_element_types.hpp>
+
+namespace lgr {
+
+struct Simulation;
+
+/* Optional global stable time step from an estimate of the largest
+   eigenvalue of M^{-1} K. On uniform meshes this is about the
+   per-element h / c estimate, but where small or thin elements share
+   nodes with larger ones it can be several times larger.
+   stable time step:
+     iterations: 20      # Lanczos steps per estimate
+     period: 10          # steps between estimates
+     safety factor: 0.9  # in (0, 1]
+   K is the stress divergence operator applied to a linearized isotropic
+   material whose stress at each point is
+     sigma = lambda tr(e) I + 2 mu e,   lambda + 2 mu = rho c^2
+   for the symmetric velocity gradient e, the current density and
+   (viscosity-augmented) wave speed c, and the "shear modulus" field where
+   a model defines it, otherwise mu = 0 as for a fluid.
+   M is the lumped nodal mass.
+   Lanczos iterations in the M inner product give the largest Ritz value
+   theta and its residual bound r, and
+     dt = safety factor * 2 / sqrt(theta + r).
+   theta + r bounds the distance from theta to some eigenvalue, not
+   necessarily the largest, so it can still fall short of the largest
+   eigenvalue when the start vector barely contains its mode. The safety
+   factor, at most one, is the margin against that.
+   Between estimates the ratio of this dt to the smallest element
+   estimate h / c is kept, so dt still follows the deforming mesh.
+   When an estimate fails, or the mesh has changed since the last one,
+   the CFL times the element estimate is used instead. */
+struct StableTimeStep {
+  Simulation& sim;
+  bool enabled;
+  int iterations;
+  int period;
+  double safety_factor;
+  // the estimated dt divided by the smallest element h / c,
+  // or zero when the element estimate is in use
+  double ratio;
+  int last_step;
+  StableTimeStep(Simulation& sim_in);
+  void setup(Omega_h::InputMap& pl);
+  // forces a new estimate at the next update, e.g. after the mesh changed
+  void forget();
+  // re-estimates if due, after the point time steps are computed
+  template <class Elem>
+  void update();
+  template <class Elem>
+  double estimate_max_eigenvalue();
+  // the global dt given the smallest element h / c
+  double get_dt(double min_point_dt);
+};
+
+#define LGR_EXPL_INST(Elem)                                                    \
+  extern template void StableTimeStep::update<Elem>();
+LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+
+}  // namespace lgr
+
+#endif
@@ -0,0 +1,228 @@
+#include <Omega_h_array_ops.hpp>
+#include <Omega_h_profile.hpp>
+#include <lgr_run.hpp>
+#include <lgr_stepper.hpp>
+
+namespace lgr {
+
+static Factories get_factories(
+    Omega_h::InputMap& pl, Factories&& factories_in) {
+  Factories factories(std::move(factories_in));
+  if (factories.empty()) {
+    factories = Factories(pl.get<std::string>("element type"));
+  }
+  return factories;
+}
+
+Stepper::Stepper(Omega_h::CommPtr comm, Omega_h::InputMap& pl,
+    Factories&& factories_in)
+    : sim(comm, get_factories(pl, std::move(factories_in))),
+      advance_function(nullptr) {
+  OMEGA_H_TIME_FUNCTION;
+  auto const elem = pl.get<std::string>("element type");
+#define LGR_EXPL_INST(Elem)                                                    \
+  if (elem == Elem::name()) {                                                  \
+    sim.set_elem<Elem>();                                                      \
+    sim.setup(pl);                                                             \
+    initialize_state<Elem>(sim);                                               \
+    close_state<Elem>(sim);                                                    \
+    advance_function = lgr::advance<Elem>;                                     \
+  }
+  LGR_EXPL_INST_ELEMS
+#undef LGR_EXPL_INST
+  if (advance_function == nullptr) {
+    Omega_h_fail("Unknown element type \"%s\"\n", elem.c_str());
+  }
+}
+
+// the caller may have written through any field it was given since
+// the last step, so every cache keyed on their versions is dropped
+void Stepper::mark_exported_fields() {
+  for (auto const fi : exported_fields) sim.fields[fi].bump_version();
+}
+
+void Stepper::advance(int nsteps) {
+  OMEGA_H_CHECK(nsteps >= 0);
+  mark_exported_fields();
+  auto const end_step = (sim.end_step - sim.step < nsteps)
+                            ? sim.end_step
+                            : sim.step + nsteps;
+  advance_function(sim, sim.end_time, end_step);
+}
+
+void Stepper::advance_to(double time) {
+  mark_exported_fields();
+  advance_function(sim, time, sim.end_step);
+}
+
+bool Stepper::is_done() {
+  return !(sim.time < sim.end_time && sim.step < sim.end_step);
+}
+
+static Field& find_field(Simulation& sim, std::string const& name) {
+  auto const fi = sim.fields.find(name);
+  if (!fi.is_valid()) {
+    Omega_h_fail("Stepper: no field named \"%s\"\n", name.c_str());
+  }
+  return sim.fields[fi];
+}
+
+bool Stepper::has_field(std::string const& name) {
+  auto const fi = sim.fields.find(name);
+  return fi.is_valid() && sim.fields[fi].has();
+}
+
+Omega_h::Write<double> Stepper::field(std::string const& name) {
+  auto& field = find_field(sim, name);
+  auto const fi = sim.fields.find(name);
+  bool is_exported = false;
+  for (auto const other : exported_fields) {
+    if (other.storage_index == fi.storage_index) is_exported = true;
+  }
+  if (!is_exported) exported_fields.push_back(fi);
+  // the caller may write through the result, so derived caches are dropped
+  return field.getset();
+}
+
+int Stepper::field_components(std::string const& name) {
+  return find_field(sim, name).ncomps;
+}
+
+bool Stepper::can_set_parameter(std::string const& name) {
+  return name == "CFL" || name == "end time" || name == "end step" ||
+         name == "max dt" || name == "min dt" ||
+         name == "hourglass viscosity" ||
+         sim.input_variables.env.variables.count(name);
+}
+
+bool Stepper::can_get_parameter(std::string const& name) {
+  return can_set_parameter(name) || name == "time" || name == "dt" ||
+         name == "step" || name == "CPU time";
+}
+
+void Stepper::set_parameter(std::string const& name, double value) {
+  if (name == "CFL") {
+    sim.cfl = value;
+  } else if (name == "end time") {
+    sim.end_time = value;
+  } else if (name == "end step") {
+    sim.end_step = static_cast<int>(value);
+  } else if (name == "max dt") {
+    sim.max_dt = value;
+  } else if (name == "min dt") {
+    sim.min_dt = value;
+  } else if (name == "hourglass viscosity") {
+    sim.hourglass_viscosity = value;
+  } else if (sim.input_variables.env.variables.count(name)) {
+    sim.input_variables.env.register_variable(name, Omega_h::any(value));
+    // conditions copy the input variables and cache their values
+    for (auto& field_ptr : sim.fields.storage) {
+      for (auto& condition : field_ptr->conditions) {
+        condition.forget_disc();
+        condition.learn_disc();
+      }
+    }
+  } else {
+    Omega_h_fail("Stepper: no parameter named \"%s\"\n", name.c_str());
+  }
+}
+
+double Stepper::get_parameter(std::string const& name) {
+  if (name == "CFL") return sim.cfl;
+  if (name == "end time") return sim.end_time;
+  if (name == "end step") return double(sim.end_step);
+  if (name == "max dt") return sim.max_dt;
+  if (name == "min dt") return sim.min_dt;
+  if (name == "hourglass viscosity") return sim.hourglass_viscosity;
+  if (name == "time") return sim.time;
+  if (name == "dt") return sim.dt;
+  if (name == "step") return double(sim.step);
+  if (name == "CPU time") return sim.cpu_time;
+  auto& variables = sim.input_variables.env.variables;
+  auto it = variables.find(name);
+  if (it != variables.end()) return Omega_h::any_cast<double>(it->second);
+  Omega_h_fail("Stepper: no parameter named \"%s\"\n", name.c_str());
+  return 0.0;
+}
+
+int Stepper::snapshot() {
+  OMEGA_H_TIME_FUNCTION;
+  Snapshot s;
+  // mesh arrays are never modified in place, so sharing them is enough
+  s.mesh = sim.disc.mesh;
+  for (auto& field_ptr : sim.fields.storage) {
+    s.is_uniform.push_back(field_ptr->is_uniform);
+    if (field_ptr->has()) {
+      s.storage.push_back(
+          Omega_h::deep_copy(field_ptr->storage, field_ptr->long_name));
+    } else {
+      s.storage.push_back(Omega_h::Write<double>());
+    }
+  }
+  s.time = sim.time;
+  s.prev_time = sim.prev_time;
+  s.dt = sim.dt;
+  s.prev_dt = sim.prev_dt;
+  s.step = sim.step;
+  s.cpu_time = sim.cpu_time;
+  s.prev_cpu_time = sim.prev_cpu_time;
+  s.eroded_mass = sim.eroder.eroded_mass;
+  s.eroded_energy = sim.eroder.eroded_energy;
+  s.eroded_elements = sim.eroder.eroded_elements;
+  s.adapt_old_quality = sim.adapter.old_quality;
+  s.adapt_old_length = sim.adapter.old_length;
+  for (auto& response : sim.responses.storage) {
+    s.response_events.push_back(response->save_events());
+  }
+  snapshots.push_back(std::move(s));
+  return int(snapshots.size()) - 1;
+}
+
+void Stepper::restore(int handle) {
+  OMEGA_H_TIME_FUNCTION;
+  OMEGA_H_CHECK(0 <= handle && handle < int(snapshots.size()));
+  auto const& s = snapshots[std::size_t(handle)];
+  // rebuild on the saved mesh as adaptation does, then put back every
+  // field exactly, so the closed state needs no recomputation
+  sim.fields.forget_disc();
+  sim.supports.forget_disc();
+  sim.subsets.forget_disc();
+  sim.disc.mesh = s.mesh;
+  sim.disc.update_from_mesh();
+  sim.subsets.learn_disc();
+  sim.fields.learn_disc();
+  sim.models.learn_disc();
+  for (std::size_t i = 0; i < sim.fields.storage.size(); ++i) {
+    auto& field = *(sim.fields.storage[i]);
+    field.is_uniform = s.is_uniform[i];
+    if (s.storage[i].exists()) {
+      field.storage = Omega_h::deep_copy(s.storage[i], field.long_name);
+    } else {
+      field.storage = Omega_h::Write<double>();
+    }
+    field.bump_version();
+  }
+  sim.time = s.time;
+  sim.prev_time = s.prev_time;
+  sim.dt = s.dt;
+  sim.prev_dt = s.prev_dt;
+  sim.step = s.step;
+  // the clock goes on from the saved CPU time
+  sim.start_cpu_time_point = Omega_h::now();
+  sim.start_cpu_time = s.cpu_time;
+  sim.cpu_time = s.cpu_time;
+  sim.prev_cpu_time = s.prev_cpu_time;
+  sim.eroder.eroded_mass = s.eroded_mass;
+  sim.eroder.eroded_energy = s.eroded_energy;
+  sim.eroder.eroded_elements = s.eroded_elements;
+  sim.adapter.old_quality = s.adapt_old_quality;
+  sim.adapter.old_length = s.adapt_old_length;
+  for (std::size_t i = 0; i < sim.responses.storage.size(); ++i) {
+    sim.responses.storage[i]->restore_events(s.response_events[i]);
+  }
+  sim.stable_time_step.forget();
+  // scalars cache their value by time, which has just gone back
+  sim.scalars.forget_values();
+}
+
+}  // namespace lgr
@@ -0,0 +1,84 @@
+#ifndef LGR_STEPPER_HPP
+#define LGR_STEPPER_HPP
+
+#include <Omega_h_input.hpp>
+#include <lgr_factories.hpp>
+#include <lgr_simulation.hpp>
+#include <string>
+#include <vector>
+
+namespace lgr {
+
+/* A Simulation that is driven from outside instead of by run(), for
+   embedding LGR in another code or a scripting language.
+   Construction sets up the deck and closes the initial state, exactly as
+   run() does before its first step; after that the caller advances by a
+   number of steps or to a time, and may in between:
+   - read and write fields in place: field() returns the storage itself,
+     so writes are seen by the next step without any copy.
+     Every field handed out is marked modified again at the start of
+     each advance, so caches derived from it see later writes.
+     The array is only valid until the mesh changes (adaptation, erosion
+     or restore()), after which field() has to be called again.
+   - change scalar parameters: "CFL", "end time", "end step", "max dt",
+     "min dt", "hourglass viscosity", or any of the "input variables",
+     which are pushed into every condition expression.
+   - take in-memory snapshots and restore them, including the mesh, so a
+     run can be rewound across adaptation and erosion. restore() puts
+     back copies of the saved arrays, so arrays from earlier field()
+     calls are detached from the simulation afterwards.
+     A snapshot also keeps the CPU time, the qualities adaptation is
+     triggered against, and the event state of each response, so the
+     restored run adapts, writes output and checkpoints as the original
+     did. Smoothing is decided by the current mesh quality alone, which
+     the saved mesh already carries. */
+struct Stepper {
+  struct Snapshot {
+    Omega_h::Mesh mesh;
+    std::vector<bool> is_uniform;
+    std::vector<Omega_h::Write<double>> storage;
+    double time;
+    double prev_time;
+    double dt;
+    double prev_dt;
+    int step;
+    double cpu_time;
+    double prev_cpu_time;
+    double eroded_mass;
+    double eroded_energy;
+    int eroded_elements;
+    double adapt_old_quality;
+    double adapt_old_length;
+    std::vector<std::vector<long long>> response_events;
+  };
+  Simulation sim;
+  void (*advance_function)(Simulation&, double, int);
+  std::vector<Snapshot> snapshots;
+  // fields handed out by field(), which the caller may write at any time
+  std::vector<FieldIndex> exported_fields;
+  Stepper(Omega_h::CommPtr comm, Omega_h::InputMap& pl,
+      Factories&& factories_in = Factories());
+  // takes at most nsteps steps, stopping early at the end time
+  void advance(int nsteps);
+  // steps until the given time, landing on it exactly
+  void advance_to(double time);
+  bool is_done();
+  // whether field() can hand out the named field: it exists and has values
+  bool has_field(std::string const& name);
+  Omega_h::Write<double> field(std::string const& name);
+  int field_components(std::string const& name);
+  bool can_set_parameter(std::string const& name);
+  bool can_get_parameter(std::string const& name);
+  void set_parameter(std::string const& name, double value);
+  double get_parameter(std::string const& name);
+  // returns a handle for restore()
+  int snapshot();
+  void restore(int handle);
+
+ private:
+  void mark_exported_fields();
+};
+
+}  // namespace lgr
+
+#endif
@@ -24,6 +24,13 @@ void Subset::learn_disc() {
   }
 }
 
+bool Subset::uses_any(ClassNames const& names) const {
+  for (auto& name : names) {
+    if (class_names.count(name)) return true;
+  }
+  return false;
+}
+
 int Subset::count() {
   if (mapping.is_identity) return disc.count(entity_type);
   return mapping.things.size();
@@ -22,6 +22,7 @@ struct Subset {
   bool is_identity();
   void forget_disc();
   void learn_disc();
+  bool uses_any(ClassNames const& names) const;
   int count();
   MappedElemsToNodes ents_to_nodes();
 };
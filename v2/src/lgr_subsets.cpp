@@ -33,6 +33,26 @@ void TypeSubsets::learn_disc(Subsets& subsets) {
   }
 }
 
+/* when entity numbering is unchanged (e.g. after flooding), only subsets
+   that use one of the changed classes need new mappings, and only bridges
+   touching those subsets need to be rebuilt */
+void TypeSubsets::relearn_disc(
+    Subsets& subsets, ClassNames const& changed_class_names) {
+  std::set<Subset*> changed;
+  for (auto& s : by_class_names) {
+    if (s.is_identity() || !s.uses_any(changed_class_names)) continue;
+    s.forget_disc();
+    s.learn_disc();
+    changed.insert(&s);
+  }
+  if (changed.empty()) return;
+  for (auto& b : bridges) {
+    if (!b.touches(changed)) continue;
+    b.forget_disc();
+    b.learn_disc(subsets, *this);
+  }
+}
+
 Subsets::Subsets(Disc& disc_in) : disc(disc_in) {}
 
 Subset* Subsets::get_subset(EntityType type, ClassNames const& class_names) {
@@ -80,6 +100,10 @@ void SubsetBridge::learn_disc(Subsets& all_subsets, TypeSubsets& type_subsets) {
   }
 }
 
+bool SubsetBridge::touches(std::set<Subset*> const& subsets_in) const {
+  return subsets_in.count(subsets.first) || subsets_in.count(subsets.second);
+}
+
 SubsetBridge* Subsets::get_bridge(Subset* from, Subset* to) {
   if (!(from->entity_type == to->entity_type)) {
     Omega_h_fail("entity type %d != %d\n", from->entity_type, to->entity_type);
@@ -112,6 +136,13 @@ void Subsets::learn_disc() {
   }
 }
 
+void Subsets::relearn_disc(ClassNames const& changed_class_names) {
+  Omega_h::ScopedTimer timer("Subsets::relearn_disc");
+  for (int i = 0; i < 4; ++i) {
+    by_type[i].relearn_disc(*this, changed_class_names);
+  }
+}
+
 Omega_h::LOs Subsets::acquire_inverse(Omega_h::LOs a2b, int nb) {
   if (!inverse_buffer.exists() || inverse_buffer.size() < nb) {
     inverse_buffer = decltype(inverse_buffer)(nb, -1);
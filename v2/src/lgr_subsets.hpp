@@ -4,6 +4,7 @@
 #include <Omega_h_rbtree.hpp>
 #include <lgr_subset.hpp>
 #include <memory>
+#include <set>
 #include <vector>
 
 namespace lgr {
@@ -22,6 +23,7 @@ struct SubsetBridge {
   Mapping mapping;
   void forget_disc();
   void learn_disc(Subsets&, TypeSubsets&);
+  bool touches(std::set<Subset*> const& subsets_in) const;
 };
 
 struct SubsetPairOfSubsetBridge {
@@ -33,6 +35,7 @@ struct TypeSubsets {
   Omega_h::rb_tree<SubsetPair, SubsetBridge, SubsetPairOfSubsetBridge> bridges;
   void forget_disc();
   void learn_disc(Subsets&);
+  void relearn_disc(Subsets&, ClassNames const& changed_class_names);
 };
 
 struct Subsets {
@@ -43,6 +46,7 @@ struct Subsets {
   SubsetBridge* get_bridge(Subset* from, Subset* to);
   void forget_disc();
   void learn_disc();
+  void relearn_disc(ClassNames const& changed_class_names);
   Omega_h::LOs acquire_inverse(Omega_h::LOs a2b, int nb);
   void release_inverse(Omega_h::LOs a2b);
   Omega_h::Write<int> inverse_buffer;
@@ -1,6 +1,7 @@
 #include <Omega_h_map.hpp>
 #include <lgr_disc.hpp>
 #include <lgr_element_functions.hpp>
+#include <lgr_field.hpp>
 #include <lgr_for.hpp>
 #include <lgr_subset.hpp>
 #include <lgr_support.hpp>
@@ -8,20 +9,29 @@
 namespace lgr {
 
 Support::Support(Disc& disc_in, Subset* subset_in)
-    : disc(disc_in),
-      subset(subset_in),
-      cached_time(std::numeric_limits<double>::quiet_NaN()) {}
+    : disc(disc_in), subset(subset_in) {}
 
 void Support::out_of_line_virtual_method() {}
 
-Omega_h::Read<double> Support::ask_coords(
-    double time, Omega_h::Read<double> node_coords) {
-  if ((time != cached_time) || (!cached_coords.exists())) {
-    cached_coords = this->interpolate_nodal(disc.dim(), node_coords);
+Omega_h::Read<double> Support::ask_coords(Field& position) {
+  return ask_interpolated(position);
+}
+
+Omega_h::Read<double> Support::ask_interpolated(Field& nodal_field) {
+  OMEGA_H_CHECK(nodal_field.entity_type == NODES);
+  auto it = interpolated.find(&nodal_field);
+  if (it != interpolated.end() && it->second.version == nodal_field.version) {
+    return it->second.data;
   }
-  return cached_coords;
+  VersionedArray entry;
+  entry.version = nodal_field.version;
+  entry.data = this->interpolate_nodal(nodal_field.ncomps, nodal_field.get());
+  interpolated[&nodal_field] = entry;
+  return entry.data;
 }
 
+void Support::forget_disc() { interpolated.clear(); }
+
 struct EntitySupport : public Support {
   EntitySupport(Disc& disc_in, Subset* subset_in)
       : Support(disc_in, subset_in) {}
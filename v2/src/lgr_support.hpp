@@ -1,22 +1,32 @@
 #ifndef LGR_SUPPORT_HPP
 #define LGR_SUPPORT_HPP
 
+#include <cstdint>
 #include <lgr_element_types.hpp>
+#include <map>
 
 namespace lgr {
 
 struct Subset;
 struct Disc;
+struct Field;
+
+// a derived array and the version of the field it was derived from
+struct VersionedArray {
+  std::uint64_t version;
+  Omega_h::Read<double> data;
+};
 
 struct Support {
   Disc& disc;
   Subset* subset;
-  Omega_h::Read<double> cached_coords;
-  double cached_time;
+  // nodal fields interpolated onto this support, reused until they change
+  std::map<Field const*, VersionedArray> interpolated;
   Support(Disc& disc_in, Subset* subset_in);
   virtual ~Support() = default;
-  Omega_h::Read<double> ask_coords(
-      double time, Omega_h::Read<double> node_coords);
+  Omega_h::Read<double> ask_coords(Field& position);
+  Omega_h::Read<double> ask_interpolated(Field& nodal_field);
+  void forget_disc();
   virtual void out_of_line_virtual_method();
   virtual int count() = 0;
   virtual Omega_h::Read<double> interpolate_nodal(
@@ -36,6 +36,10 @@ Support* Supports::get_support(Subset* subset, bool on_points) {
   return out;
 }
 
+void Supports::forget_disc() {
+  for (auto& support : storage) support->forget_disc();
+}
+
 template <class Elem>
 void Supports::set_elem() {
   this->point_support_factory = lgr::point_support_factory<Elem>;
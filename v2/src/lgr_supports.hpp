@@ -29,6 +29,7 @@ struct Supports {
   Support* get_support(
       EntityType entity_type, bool on_points, ClassNames const& class_names);
   Support* get_support(Subset* subset, bool on_points);
+  void forget_disc();
   template <class Elem>
   void set_elem();
 };
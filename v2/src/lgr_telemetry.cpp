@@ -0,0 +1,156 @@
+#include <lgr_response.hpp>
+#include <lgr_simulation.hpp>
+#include <lgr_telemetry.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstring>
+#include <new>
+
+namespace lgr {
+
+static std::uint64_t align(std::uint64_t n) { return (n + 63) / 64 * 64; }
+
+static std::uint64_t records_offset_for(std::uint64_t nnames) {
+  return align(sizeof(TelemetryHeader) + nnames * telemetry_name_length);
+}
+
+static std::uint64_t record_size_for(std::uint64_t nnames) {
+  return align(sizeof(std::uint64_t) + nnames * sizeof(double));
+}
+
+std::uint64_t telemetry_size(std::uint64_t nnames, std::uint64_t capacity) {
+  return records_offset_for(nnames) + capacity * record_size_for(nnames);
+}
+
+TelemetryHeader* telemetry_create(void* base_in,
+    std::vector<std::string> const& scalars,
+    std::vector<std::string> const& scopes, std::uint64_t capacity) {
+  OMEGA_H_CHECK(capacity > 0);
+  auto const base = static_cast<char*>(base_in);
+  auto const nnames = std::uint64_t(scalars.size() + scopes.size());
+  auto header = new (base) TelemetryHeader;
+  header->version = telemetry_version;
+  header->nscalars = std::uint32_t(scalars.size());
+  header->nscopes = std::uint32_t(scopes.size());
+  header->name_length = telemetry_name_length;
+  header->capacity = capacity;
+  header->record_size = record_size_for(nnames);
+  header->names_offset = sizeof(TelemetryHeader);
+  header->records_offset = records_offset_for(nnames);
+  header->head.store(0, std::memory_order_relaxed);
+  auto names = base + header->names_offset;
+  for (auto& name : scalars) {
+    std::strncpy(names, name.c_str(), telemetry_name_length - 1);
+    names += telemetry_name_length;
+  }
+  for (auto& name : scopes) {
+    std::strncpy(names, name.c_str(), telemetry_name_length - 1);
+    names += telemetry_name_length;
+  }
+  // readers check the magic last so they never see a half-built header
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(header->magic, telemetry_magic, sizeof(telemetry_magic));
+  return header;
+}
+
+void telemetry_append(TelemetryHeader* header, double const* values) {
+  auto const nnames = std::size_t(header->nscalars + header->nscopes);
+  auto const records = reinterpret_cast<char*>(header) + header->records_offset;
+  auto const n = header->head.load(std::memory_order_relaxed);
+  auto const slot = records + (n % header->capacity) * header->record_size;
+  auto const seq = reinterpret_cast<std::atomic<std::uint64_t>*>(slot);
+  seq->store(2 * n + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(slot + sizeof(std::uint64_t), values, nnames * sizeof(double));
+  seq->store(2 * n + 2, std::memory_order_release);
+  header->head.store(n + 1, std::memory_order_release);
+}
+
+bool telemetry_read(
+    TelemetryHeader const* header, std::uint64_t n, double* values) {
+  auto const nnames = std::size_t(header->nscalars + header->nscopes);
+  auto const records =
+      reinterpret_cast<char const*>(header) + header->records_offset;
+  auto const slot = records + (n % header->capacity) * header->record_size;
+  auto const seq = reinterpret_cast<std::atomic<std::uint64_t> const*>(slot);
+  auto const before = seq->load(std::memory_order_acquire);
+  if (before != 2 * n + 2) return false;
+  std::memcpy(values, slot + sizeof(std::uint64_t), nnames * sizeof(double));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  auto const after = seq->load(std::memory_order_relaxed);
+  return after == before;
+}
+
+struct Telemetry : public Response {
+  std::vector<std::string> scalars;
+  std::vector<std::string> scopes;
+  std::vector<double> values;
+  bool is_writer;
+  void* mapping;
+  std::size_t mapping_size;
+  TelemetryHeader* header;
+  Telemetry(Simulation& sim_in, Omega_h::InputMap& pl)
+      : Response(sim_in, pl),
+        is_writer(sim_in.comm->rank() == 0),
+        mapping(nullptr),
+        mapping_size(0),
+        header(nullptr) {
+    auto& scalars_in = pl.get_list("scalars");
+    for (int i = 0; i < scalars_in.size(); ++i) {
+      scalars.push_back(scalars_in.get<std::string>(i));
+    }
+    if (pl.is_list("scopes")) {
+      auto& scopes_in = pl.get_list("scopes");
+      for (int i = 0; i < scopes_in.size(); ++i) {
+        scopes.push_back(scopes_in.get<std::string>(i));
+      }
+      sim.scope_times.enabled = true;
+    }
+    values.resize(scalars.size() + scopes.size());
+    auto const capacity = std::uint64_t(pl.get<int>("capacity", "1024"));
+    OMEGA_H_CHECK(capacity > 0);
+    auto const path = pl.get<std::string>("path", "/dev/shm/lgr_telemetry");
+    if (!is_writer) return;
+    mapping_size = std::size_t(telemetry_size(values.size(), capacity));
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+      Omega_h_fail("telemetry: could not open \"%s\"\n", path.c_str());
+    }
+    if (::ftruncate(fd, off_t(mapping_size)) != 0) {
+      ::close(fd);
+      Omega_h_fail("telemetry: could not size \"%s\"\n", path.c_str());
+    }
+    mapping = ::mmap(
+        nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      Omega_h_fail("telemetry: could not map \"%s\"\n", path.c_str());
+    }
+    header = telemetry_create(mapping, scalars, scopes, capacity);
+  }
+  ~Telemetry() override {
+    if (mapping) ::munmap(mapping, mapping_size);
+  }
+  void respond() override final {
+    // every rank asks, since scalars may involve collectives
+    std::size_t j = 0;
+    for (auto& name : scalars) values[j++] = sim.scalars.ask_value(name);
+    for (auto& name : scopes) {
+      values[j++] = sim.scope_times.total(name.c_str());
+    }
+    if (!is_writer) return;
+    telemetry_append(header, values.data());
+  }
+  void out_of_line_virtual_method() override;
+};
+
+void Telemetry::out_of_line_virtual_method() {}
+
+Response* telemetry_factory(
+    Simulation& sim, std::string const&, Omega_h::InputMap& pl) {
+  return new Telemetry(sim, pl);
+}
+
+}  // namespace lgr
@@ -0,0 +1,80 @@
+#ifndef LGR_TELEMETRY_HPP
+#define LGR_TELEMETRY_HPP
+
+#include <Omega_h_input.hpp>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lgr {
+
+struct Response;
+struct Simulation;
+
+/* Binary layout of the file written by the "telemetry" response.
+   All integers are native-endian and the file is meant to be mapped by a
+   reader on the same node.
+
+   offset 0              TelemetryHeader
+   names_offset          (nscalars + nscopes) names, name_length bytes each,
+                         NUL padded; scalars first, then scope names
+   records_offset        capacity records of record_size bytes each
+
+   A record is one std::uint64_t sequence number followed by
+   (nscalars + nscopes) doubles.  Scope values are the accumulated
+   wall-clock seconds spent in that LGR_SCOPE since the start of the run.
+
+   The simulation is the single producer.  The n-th record (n = 0, 1, ...)
+   goes to slot n % capacity; its sequence number is set to 2n+1 while
+   the values are being written and to 2n+2 once they are complete, after
+   which head is advanced to n+1.  A reader loads head, copies the slot,
+   and keeps the copy only if the sequence number read before and after
+   the copy is the same even value 2n+2.  No locks or syscalls are
+   involved on either side. */
+
+constexpr char telemetry_magic[8] = {'L', 'G', 'R', 'T', 'E', 'L', 'E', '\0'};
+constexpr std::uint32_t telemetry_version = 1;
+constexpr std::uint32_t telemetry_name_length = 64;
+
+struct TelemetryHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t nscalars;
+  std::uint32_t nscopes;
+  std::uint32_t name_length;
+  std::uint64_t capacity;
+  std::uint64_t record_size;
+  std::uint64_t names_offset;
+  std::uint64_t records_offset;
+  std::atomic<std::uint64_t> head;
+};
+
+static_assert(sizeof(std::atomic<std::uint64_t>) == sizeof(std::uint64_t),
+    "telemetry requires address-free 64-bit atomics");
+
+/* total size of a telemetry file with nnames = nscalars + nscopes
+   columns and the given number of record slots */
+std::uint64_t telemetry_size(std::uint64_t nnames, std::uint64_t capacity);
+
+/* lays out the header and names in the zeroed, 64-byte aligned region
+   base of telemetry_size() bytes and publishes the magic last */
+TelemetryHeader* telemetry_create(void* base,
+    std::vector<std::string> const& scalars,
+    std::vector<std::string> const& scopes, std::uint64_t capacity);
+
+/* producer side: appends one record of nscalars + nscopes values */
+void telemetry_append(TelemetryHeader* header, double const* values);
+
+/* consumer side: copies the values of record n, returning false if that
+   record is not complete yet, has been overwritten, or was torn by a
+   concurrent append (in which case the caller may simply retry) */
+bool telemetry_read(
+    TelemetryHeader const* header, std::uint64_t n, double* values);
+
+Response* telemetry_factory(
+    Simulation& sim, std::string const&, Omega_h::InputMap& pl);
+
+}  // namespace lgr
+
+#endif
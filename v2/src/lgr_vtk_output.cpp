@@ -19,6 +19,8 @@ struct VtkOutput : public Response {
     void set_fields(Omega_h::InputMap& pl);
     void out_of_line_virtual_method() override final;
     void respond() override final;
+    std::vector<long long> save_events() override final;
+    void restore_events(std::vector<long long> const& events) override final;
   public:
     bool compress;
     std::string path;
@@ -262,7 +264,7 @@ Omega_h::Read<T> gather_pt(Omega_h::Read<T> data, int nents, int npoints,
 static void write_multi_point_lgr_field(std::ostream& file,
     Simulation& sim, Field& field, int ent_dim, bool compress) {
   OMEGA_H_CHECK(ent_dim = sim.disc.dim());
-  auto data = field.get();
+  auto data = field.broadcast();
   auto ncomps = field.ncomps;
   auto nents = sim.disc.count(ELEMS);
   auto npoints = sim.disc.points_per_ent(ELEMS);
@@ -284,7 +286,7 @@ static void write_lgr_fields(std::ostream& file, Simulation& sim,
       write_multi_point_lgr_field(file, sim, field, ent_dim, compress);
     } else {
       Omega_h::vtk::write_array(file, field.long_name, field.ncomps,
-          field.get(), compress);
+          field.broadcast(), compress);
     }
   }
 }
@@ -338,6 +340,16 @@ void VtkOutput::respond() {
   }
 }
 
+// the end of the last entry in the PVD file, so a restored run
+// overwrites the entries written after the snapshot
+std::vector<long long> VtkOutput::save_events() {
+  return {static_cast<long long>(pvd_pos)};
+}
+
+void VtkOutput::restore_events(std::vector<long long> const& events) {
+  pvd_pos = std::streampos(std::streamoff(events.at(0)));
+}
+
 void VtkOutput::out_of_line_virtual_method() {
 }
 
@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <lgr_fast_math.hpp>
+
+// reports the cost per call of each fast_math tier against libm.
+// not a test: timings depend on the machine and on whether the
+// loops vectorize, so this is built but not run by ctest
+
+namespace {
+
+using lgr::MathAccuracy;
+
+std::vector<double> uniform_samples(double lo, double hi, int n) {
+  std::mt19937_64 engine(42);
+  std::uniform_real_distribution<double> distribution(lo, hi);
+  std::vector<double> samples(std::size_t(n), 0.0);
+  for (auto& sample : samples) sample = distribution(engine);
+  return samples;
+}
+
+// the results go to an array so that the loop can vectorize
+template <class F>
+double seconds_per_call(F f, std::vector<double> const& x, double& checksum) {
+  std::vector<double> y(x.size(), 0.0);
+  auto const n = x.size();
+  auto const start = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < 10; ++rep) {
+    for (std::size_t i = 0; i < n; ++i) y[i] = f(x[i]);
+  }
+  auto const end = std::chrono::steady_clock::now();
+  // keep the loop from being optimized away
+  checksum += y[n / 2];
+  return std::chrono::duration<double>(end - start).count() /
+         (10.0 * double(n));
+}
+
+template <class F, class G>
+void benchmark(char const* name, std::vector<double> const& x, F fast,
+    G reference, double& checksum) {
+  auto const t_std = seconds_per_call(reference, x, checksum);
+  auto const t_high = seconds_per_call(
+      [&](double xi) { return fast(xi, MathAccuracy::HIGH); }, x, checksum);
+  auto const t_low = seconds_per_call(
+      [&](double xi) { return fast(xi, MathAccuracy::LOW); }, x, checksum);
+  std::printf("%-5s std %6.2f ns, high %6.2f ns, low %6.2f ns\n", name,
+      t_std * 1e9, t_high * 1e9, t_low * 1e9);
+}
+
+}  // namespace
+
+int main() {
+  auto const x = uniform_samples(0.01, 100.0, 1 << 16);
+  double checksum = 0.0;
+  benchmark("exp", x, [](double xi, MathAccuracy a) {
+    return lgr::fast_exp(xi, a); }, [](double xi) { return std::exp(xi); },
+      checksum);
+  benchmark("log", x, [](double xi, MathAccuracy a) {
+    return lgr::fast_log(xi, a); }, [](double xi) { return std::log(xi); },
+      checksum);
+  benchmark("pow", x, [](double xi, MathAccuracy a) {
+    return lgr::fast_pow(xi, 0.31, a); },
+      [](double xi) { return std::pow(xi, 0.31); }, checksum);
+  benchmark("cbrt", x, [](double xi, MathAccuracy a) {
+    return lgr::fast_cbrt(xi, a); }, [](double xi) { return std::cbrt(xi); },
+      checksum);
+  std::printf("checksum %g\n", checksum);
+  return 0;
+}
@@ -0,0 +1,124 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <lgr_fast_math.hpp>
+#include "lgr_gtest.hpp"
+
+namespace {
+
+using lgr::MathAccuracy;
+
+double tier_tolerance(MathAccuracy accuracy) {
+  return (accuracy == MathAccuracy::HIGH) ? 1.0e-12 : 1.0e-7;
+}
+
+double relative_error(double value, double expected) {
+  return std::abs(value - expected) / std::abs(expected);
+}
+
+std::vector<double> uniform_samples(double lo, double hi, int n) {
+  std::mt19937_64 engine(42);
+  std::uniform_real_distribution<double> distribution(lo, hi);
+  std::vector<double> samples(std::size_t(n), 0.0);
+  for (auto& sample : samples) sample = distribution(engine);
+  return samples;
+}
+
+void check_exp(MathAccuracy accuracy) {
+  auto const tol = tier_tolerance(accuracy);
+  for (auto x : uniform_samples(-700.0, 700.0, 100000)) {
+    ASSERT_LT(relative_error(lgr::fast_exp(x, accuracy), std::exp(x)), tol)
+        << "x = " << x;
+  }
+  EXPECT_EQ(lgr::fast_exp(0.0, accuracy), 1.0);
+  EXPECT_EQ(lgr::fast_exp(-800.0, accuracy), 0.0);
+  EXPECT_TRUE(std::isinf(lgr::fast_exp(800.0, accuracy)));
+}
+
+void check_log(MathAccuracy accuracy) {
+  auto const tol = tier_tolerance(accuracy);
+  for (auto e : uniform_samples(-300.0, 300.0, 100000)) {
+    auto const x = std::pow(10.0, e);
+    ASSERT_LT(relative_error(lgr::fast_log(x, accuracy), std::log(x)), tol)
+        << "x = " << x;
+  }
+  // near one, where log(x) itself is small
+  for (auto d : uniform_samples(-1.0e-3, 1.0e-3, 10000)) {
+    auto const x = 1.0 + d;
+    if (x == 1.0) continue;
+    ASSERT_LT(relative_error(lgr::fast_log(x, accuracy), std::log(x)), tol)
+        << "x = " << x;
+  }
+  auto const subnormal = 1.0e-310;
+  EXPECT_LT(relative_error(lgr::fast_log(subnormal, accuracy),
+                std::log(subnormal)),
+      tol);
+  EXPECT_EQ(lgr::fast_log(1.0, accuracy), 0.0);
+  EXPECT_TRUE(std::isinf(lgr::fast_log(0.0, accuracy)));
+  EXPECT_TRUE(std::isnan(lgr::fast_log(-1.0, accuracy)));
+}
+
+void check_pow(MathAccuracy accuracy) {
+  auto const tol = tier_tolerance(accuracy);
+  auto const bases = uniform_samples(1.0e-4, 1.0e2, 10000);
+  auto const exponents = uniform_samples(-1.0, 1.0, 10000);
+  for (std::size_t i = 0; i < bases.size(); ++i) {
+    auto const x = bases[i];
+    auto const y = exponents[i];
+    ASSERT_LT(relative_error(lgr::fast_pow(x, y, accuracy), std::pow(x, y)),
+        tol)
+        << "x = " << x << ", y = " << y;
+  }
+  EXPECT_EQ(lgr::fast_pow(0.0, 0.31, accuracy), 0.0);
+  EXPECT_EQ(lgr::fast_pow(1.0, 0.31, accuracy), 1.0);
+  EXPECT_TRUE(std::isinf(lgr::fast_pow(0.0, -0.31, accuracy)));
+  EXPECT_TRUE(std::isnan(lgr::fast_pow(-2.0, 0.5, accuracy)));
+  EXPECT_EQ(lgr::fast_pow(3.0, 0.0, accuracy), 1.0);
+}
+
+void check_cbrt(MathAccuracy accuracy) {
+  auto const tol = tier_tolerance(accuracy);
+  for (auto e : uniform_samples(-300.0, 300.0, 100000)) {
+    auto const x = std::pow(10.0, e);
+    ASSERT_LT(relative_error(lgr::fast_cbrt(x, accuracy), std::cbrt(x)), tol)
+        << "x = " << x;
+    ASSERT_LT(relative_error(lgr::fast_cbrt(-x, accuracy), std::cbrt(-x)),
+        tol)
+        << "x = " << -x;
+  }
+  EXPECT_EQ(lgr::fast_cbrt(0.0, accuracy), 0.0);
+}
+
+}  // namespace
+
+TEST(fast_math, exp) {
+  check_exp(MathAccuracy::HIGH);
+  check_exp(MathAccuracy::LOW);
+}
+
+TEST(fast_math, log) {
+  check_log(MathAccuracy::HIGH);
+  check_log(MathAccuracy::LOW);
+}
+
+TEST(fast_math, pow) {
+  check_pow(MathAccuracy::HIGH);
+  check_pow(MathAccuracy::LOW);
+}
+
+TEST(fast_math, cbrt) {
+  check_cbrt(MathAccuracy::HIGH);
+  check_cbrt(MathAccuracy::LOW);
+}
+
+TEST(fast_math, full_is_std) {
+  for (auto x : uniform_samples(0.1, 10.0, 100)) {
+    EXPECT_EQ(lgr::fast_exp(x, MathAccuracy::FULL), std::exp(x));
+    EXPECT_EQ(lgr::fast_log(x, MathAccuracy::FULL), std::log(x));
+    EXPECT_EQ(lgr::fast_pow(x, 0.31, MathAccuracy::FULL), std::pow(x, 0.31));
+    EXPECT_EQ(lgr::fast_cbrt(x, MathAccuracy::FULL), std::cbrt(x));
+  }
+}
+
+LGR_END_TESTS
@@ -0,0 +1,84 @@
+#include <lgr_hourglass.hpp>
+#include "lgr_gtest.hpp"
+
+using Omega_h::are_close;
+
+// a convex, non-parallelogram quadrilateral
+static lgr::Matrix<2, 4> distorted_quad() {
+  lgr::Matrix<2, 4> x;
+  x[0] = Omega_h::vector_2(0.0, 0.0);
+  x[1] = Omega_h::vector_2(2.0, 0.1);
+  x[2] = Omega_h::vector_2(1.8, 1.5);
+  x[3] = Omega_h::vector_2(-0.2, 1.0);
+  return x;
+}
+
+static lgr::Matrix<2, 4> linear_velocity(lgr::Matrix<2, 4> x) {
+  lgr::Matrix<2, 4> v;
+  for (int node = 0; node < 4; ++node) {
+    v[node][0] = 0.3 + 1.5 * x[node][0] - 0.7 * x[node][1];
+    v[node][1] = -0.2 + 0.4 * x[node][0] + 2.0 * x[node][1];
+  }
+  return v;
+}
+
+TEST(quad4r, area) {
+  auto const x = distorted_quad();
+  auto const shape = lgr::Quad4R::shape(x);
+  // shoelace formula
+  double area = 0.0;
+  for (int node = 0; node < 4; ++node) {
+    auto const a = x[node];
+    auto const b = x[(node + 1) % 4];
+    area += 0.5 * (a[0] * b[1] - b[0] * a[1]);
+  }
+  EXPECT_TRUE(are_close(shape.weights[0], area));
+}
+
+TEST(quad4r, linear_gradient) {
+  auto const x = distorted_quad();
+  auto const shape = lgr::Quad4R::shape(x);
+  auto const v = linear_velocity(x);
+  // the centroid gradient reproduces a linear field exactly
+  auto const grad_v = v * Omega_h::transpose(shape.basis_gradients[0]);
+  EXPECT_TRUE(are_close(grad_v[0][0], 1.5));
+  EXPECT_TRUE(are_close(grad_v[1][0], -0.7));
+  EXPECT_TRUE(are_close(grad_v[0][1], 0.4));
+  EXPECT_TRUE(are_close(grad_v[1][1], 2.0));
+}
+
+TEST(quad4r, hourglass_ignores_linear_fields) {
+  auto const x = distorted_quad();
+  auto const shape = lgr::Quad4R::shape(x);
+  auto const v = linear_velocity(x);
+  auto const f = lgr::get_hourglass_forces(
+      x, v, shape.basis_gradients[0], shape.weights[0], 1000.0, 5000.0, 0.1);
+  for (int node = 0; node < 4; ++node) {
+    EXPECT_TRUE(are_close(f[node][0], 0.0, 1e-10, 1e-10));
+    EXPECT_TRUE(are_close(f[node][1], 0.0, 1e-10, 1e-10));
+  }
+}
+
+TEST(quad4r, hourglass_resists_hourglass_mode) {
+  auto const x = distorted_quad();
+  auto const shape = lgr::Quad4R::shape(x);
+  auto const h = lgr::Quad4R::hourglass_base();
+  lgr::Matrix<2, 4> v;
+  for (int node = 0; node < 4; ++node) {
+    v[node] = Omega_h::vector_2(h[node], 0.5 * h[node]);
+  }
+  auto const f = lgr::get_hourglass_forces(
+      x, v, shape.basis_gradients[0], shape.weights[0], 1000.0, 5000.0, 0.1);
+  double power = 0.0;
+  auto total = Omega_h::zero_vector<2>();
+  for (int node = 0; node < 4; ++node) {
+    power += f[node] * v[node];
+    total += f[node];
+  }
+  // no net force, and the forces remove energy from the mode
+  EXPECT_TRUE(are_close(total[0], 0.0, 1e-10, 1e-10));
+  EXPECT_TRUE(are_close(total[1], 0.0, 1e-10, 1e-10));
+  EXPECT_LT(power, 0.0);
+}
+
+LGR_END_TESTS